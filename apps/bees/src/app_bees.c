@@ -98,19 +98,24 @@ u8 app_launch(u8 firstrun) {
     render_boot("launching default DSP...");
 
     files_load_dsp_name("aleph-waves.ldr");
-    
-    render_boot("waiting for DSP init...");
-    print_dbg("\r\n DSP booted, waiting to query params...");
-    print_dbg(" requesting param report...");
-    bfin_wait_ready();
-
-    //    print_dbg(" requesting param report...");
-    render_boot("requesting DSP params");
-    net_report_params();
 
-    //    print_dbg("\r\n enable DSP audio...");
-    render_boot("enabling audio");
-    bfin_enable();
+    if(bfin_halted()) {
+      print_dbg("\r\n default DSP load failed");
+      render_boot("default DSP load failed!");
+    } else {
+      render_boot("waiting for DSP init...");
+      print_dbg("\r\n DSP booted, waiting to query params...");
+      print_dbg(" requesting param report...");
+      bfin_wait_ready();
+
+      //    print_dbg(" requesting param report...");
+      render_boot("requesting DSP params");
+      net_report_params();
+
+      //    print_dbg("\r\n enable DSP audio...");
+      render_boot("enabling audio");
+      bfin_enable();
+    }
 
     //    render_boot("writing default dsp to flash...");
     //    files_store_default_dsp_name("aleph-waves.ldr");
@@ -39,18 +39,19 @@ static softTimer_t screenTimer = { .next = NULL };
 // poll encoders
 static softTimer_t encTimer = { .next = NULL };
 
-// poll monome device 
-static softTimer_t monomePollTimer = { .next = NULL };
+// poll monome devices
+static softTimer_t monomePollTimer[MONOME_MAX_DEVICES];
 
-// refresh monome device 
-static softTimer_t monomeRefreshTimer  = { .next = NULL };
+// refresh monome devices
+static softTimer_t monomeRefreshTimer[MONOME_MAX_DEVICES];
+// device index of each monome timer pair, passed as the timer argument
+static u8 monomeTimerDev[MONOME_MAX_DEVICES];
 
 // poll midi device 
 static softTimer_t midiPollTimer = { .next = NULL };
 
 // refresh midi device 
-/// TODO:
-// static softTimer_t midiRefreshTimer;
+static softTimer_t midiRefreshTimer = { .next = NULL };
 
 // poll adc 
 static softTimer_t adcPollTimer = { .next = NULL };
@@ -80,16 +81,15 @@ static void screen_timer_callback(void* obj) {
 
 // encoder accumulator polling callback
 static void enc_timer_callback(void* obj) {
-  static s16 val, valAbs;
+  s16 val;
   u8 i;
 
   for(i=0; i<NUM_ENC; i++) {
-    val = enc[i].val;
-    valAbs = (val & 0x8000 ? (val ^ 0xffff) + 1 : val);
-    if(valAbs > enc[i].thresh) {
+    // acceleration is applied per edge; this just coalesces
+    val = take_enc_delta(i);
+    if(val != 0) {
       e.type = enc[i].event;
       e.data = val;
-      enc[i].val = 0;
       event_post(&e);
     }
   }
@@ -108,22 +108,30 @@ static void midi_poll_timer_callback(void* obj) {
   midi_read();
 }
 
+// midi refresh callback
+static void midi_refresh_timer_callback(void* obj) {
+  if(midiOutDirty) {
+    e.type = kEventMidiRefresh;
+    event_post(&e);
+  }
+}
+
 // monome polling callback
 static void monome_poll_timer_callback(void* obj) {
   // asynchronous, non-blocking read
   // UHC callback spawns appropriate events
-  ftdi_read();
+  // timer argument points to the device index
+  ftdi_read(*((u8*)obj));
 }
 
 // monome refresh callback
 static void monome_refresh_timer_callback(void* obj) {
-  //  if (monomeConnect) {
-  //    print_dbg("\r\n posting monome refresh event");
-  if(monomeFrameDirty > 0) {
+  u8 dev = *((u8*)obj);
+  if(monomeFrameDirty[dev] > 0) {
     e.type = kEventMonomeRefresh;
+    e.data = dev;
     event_post(&e);
   }
-  //  }
 }
 
 //----------------------------
@@ -131,37 +139,41 @@ static void monome_refresh_timer_callback(void* obj) {
 
 void init_app_timers(void) {
   timer_add(&screenTimer, 50, &screen_timer_callback, NULL );
-  timer_add(&encTimer, 50, &enc_timer_callback, NULL );
+  timer_add(&encTimer, ENC_POLL_PERIOD_DEFAULT, &enc_timer_callback, NULL );
 }
 
-// monome: start polling
-void timers_set_monome(void) {
-  print_dbg("\r\n setting monome timers");
-  timer_add(&monomePollTimer, 	 20, &monome_poll_timer_callback, NULL );
-  timer_add(&monomeRefreshTimer, 50, &monome_refresh_timer_callback, NULL );
+// monome: start polling a device
+void timers_set_monome(u8 dev) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  print_dbg("\r\n setting monome timers, device: ");
+  print_dbg_ulong(dev);
+  monomeTimerDev[dev] = dev;
+  timer_add(&(monomePollTimer[dev]), 20, &monome_poll_timer_callback, &(monomeTimerDev[dev]) );
+  timer_add(&(monomeRefreshTimer[dev]), 50, &monome_refresh_timer_callback, &(monomeTimerDev[dev]) );
 }
 
-// monome stop polling
-void timers_unset_monome(void) {
-  print_dbg("\r\n unsetting monome timers");
-  timer_remove( &monomePollTimer );
-  timer_remove( &monomeRefreshTimer ); 
+// monome: stop polling a device
+void timers_unset_monome(u8 dev) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  print_dbg("\r\n unsetting monome timers, device: ");
+  print_dbg_ulong(dev);
+  timer_remove( &(monomePollTimer[dev]) );
+  timer_remove( &(monomeRefreshTimer[dev]) ); 
 }
 
 // midi : start polling
 void timers_set_midi(void) {
   print_dbg("\r\n setting midi timers");
   timer_add( &midiPollTimer, 20, &midi_poll_timer_callback, NULL );
-  // TODO:
-  //  timer_add(&midiRefreshTimer, eMidiRefreshTimerTag, 50,  &midi_refresh_timer_callback, NULL, 1);
+  // short period for note latency; output is coalesced in between
+  timer_add( &midiRefreshTimer, 5, &midi_refresh_timer_callback, NULL );
 }
 
 // midi : stop polling
 void timers_unset_midi(void) {
   print_dbg("\r\n unsetting midi timers");
   timer_remove( &midiPollTimer );
-  // TODO:
-  //  timer_remove(eMidiRefreshTimerTag); 
+  timer_remove( &midiRefreshTimer );
 }
 
 // adc : start polling
@@ -177,6 +189,11 @@ void timers_unset_adc(void) {
   timer_remove( &adcPollTimer );
 } 
 
+// change period of encoder delta delivery
+void timers_set_enc_period(u32 period) {
+  encTimer.ticks = period;
+}
+
 // change period of adc polling timer
 void timers_set_adc_period(u32 period) {
   adcPollTimer.ticks = period;
@@ -189,6 +206,16 @@ void timers_set_custom(softTimer_t* timer, u32 period, void* obj) {
   timer_add(timer, period, &app_custom_event_callback, obj );
 }
 
+// set custom callback with a period in milliseconds.
+// deadlines are absolute and keep the fractional tick, so periodic timers don't drift.
+void timers_set_custom_ms(softTimer_t* timer, u32 ms, void* obj, u8 periodic) {
+  timer_add_fine(timer, timer_ms_to_fine(ms), &app_custom_event_callback, obj, periodic);
+}
+
+// change period of custom timer, counting from its last deadline
+void timers_set_custom_period_ms(softTimer_t* timer, u32 ms) {
+  timer_set_period_fine(timer, timer_ms_to_fine(ms));
+}
 
 // unset metro callback
 void timers_unset_custom(softTimer_t* timer) {
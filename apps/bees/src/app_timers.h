@@ -14,14 +14,17 @@
 /*   eMidiRefreshTimerTag, */
 /* }; */
 
+// default period of encoder delta delivery, in ticks
+#define ENC_POLL_PERIOD_DEFAULT 20
+
 // create application timers
 extern void init_app_timers(void);
 
-// start monome polling/refresh timers
-extern void timers_set_monome(void);
+// start monome polling/refresh timers for a device
+extern void timers_set_monome(u8 dev);
 
-// stop monome polling/refresh timers
-extern void timers_unset_monome(void);
+// stop monome polling/refresh timers for a device
+extern void timers_unset_monome(u8 dev);
 
 // start midi polling/refresh timers
 extern void timers_set_midi(void);
@@ -29,6 +32,9 @@ extern void timers_set_midi(void);
 // stop midi polling/refresh timers
 extern void timers_unset_midi(void);
 
+// change period of encoder delta delivery
+extern void timers_set_enc_period(u32 period);
+
 // start adc polling timer
 extern void timers_set_adc(u32 period);
 
@@ -41,6 +47,12 @@ extern void timers_set_adc_period(u32 period);
 // set metro timer
 extern void timers_set_custom(softTimer_t* timer, u32 period, void* obj);
 
+// set custom timer with period in ms, periodic or one-shot
+extern void timers_set_custom_ms(softTimer_t* timer, u32 ms, void* obj, u8 periodic);
+
+// change period of custom timer in ms, effective immediately
+extern void timers_set_custom_period_ms(softTimer_t* timer, u32 ms);
+
 // unset metro timer
 extern void timers_unset_custom(softTimer_t* timer);
 
@@ -29,23 +29,53 @@
 
 // ---- directory list class
 // params
-#define DIR_LIST_MAX_NUM 64
+#define DIR_LIST_MAX_NUM 1024
 #define DIR_LIST_NAME_LEN 64
 #define DIR_LIST_NAME_LEN_1 63
-#define DIR_LIST_NAME_BUF_SIZE 4096 // len * num
+// hash slots, power of 2 and at least twice the entry count
+#define DIR_LIST_HASH_SIZE 2048
+#define DIR_LIST_HASH_MASK (DIR_LIST_HASH_SIZE - 1)
+// empty hash slot
+#define DIR_LIST_HASH_NONE 0xffff
 
 #define DSP_PATH     "/mod/"
 #define SCENES_PATH  "/data/bees/scenes/"
 #define SCALERS_PATH  "/data/bees/scalers/"
 
+// persistent directory indices (kept outside the indexed dirs)
+#define DSP_INDEX_PATH     "/data/bees/mod.idx"
+#define SCENES_INDEX_PATH  "/data/bees/scenes.idx"
+#define SCALERS_INDEX_PATH "/data/bees/scalers.idx"
+#define DIR_INDEX_MAGIC 0x42494458 // "BIDX"
+#define DIR_INDEX_VERSION 1
+
 // endinanness
 // #define SCALER_LE
 
-//  stupid datatype with fixed number of fixed-length filenames
-// storing this for speed when UI asks us for a lot of strings
+// directory entry: name, first cluster and size
+typedef struct _dirEntry {
+  char name[DIR_LIST_NAME_LEN];
+  u32 cluster;
+  u32 size;
+} dirEntry_t;
+
+// header of persistent index file; entries follow
+typedef struct _dirIndexHeader {
+  u32 magic;
+  u32 version;
+  // directory signature at time of scan
+  u32 sig;
+  u32 num;
+} dirIndexHeader_t;
+
+// directory list: entries in directory order (for the UI),
+// plus an open-addressed hash of names for lookup.
+// entries and hash live in SDRAM.
 typedef struct _dirList {
   char path[64];
-  volatile char nameBuf[DIR_LIST_NAME_BUF_SIZE];
+  const char* indexPath;
+  dirEntry_t* entries;
+  u16* hash;
   u32 num;
 } dirList_t;
 
@@ -60,38 +90,33 @@ static dirList_t dspList;
 static dirList_t sceneList;
 static dirList_t scalerList;
 
+// name of the last module that loaded completely
+#define DSP_LOADED_NAME_LEN 64
+static char dspLoaded[DSP_LOADED_NAME_LEN] = "";
+
 //----------------------------------
 //---- static functions
 
-// populate list with filenames and count
+// allocate list storage
+static void list_init(dirList_t* list, const char* path, const char* indexPath);
+// populate list with filenames and count, from index if still valid
 static void list_scan(dirList_t* list, const char* path);
 // get name at idx
-static const char* list_get_name(dirList_t* list, u8 idx);
+static const char* list_get_name(dirList_t* list, u16 idx);
+// find entry by name, or NULL
+static dirEntry_t* list_find(dirList_t* list, const char* name);
 // get read file pointer if found (caller must close)
 // set size by pointer
 static void* list_open_file_name(dirList_t* list, const char* name, const char* mode, u32* size);
 
-//// FIXME: dumb and slow seek/read functions because the real ones are broken
-//// fseek: no offset arg, assume its the first seek since file was opened 
-/* // not used
-static void fake_fseek(void* fp, u32 loc) {
-  u32 n = 0;
-  u8 dum;
-  while(n < loc) {
-    dum = fl_fgetc(fp);
-    n++;
-  }
-}
-*/
-
-// fread: no size arg
-static void fake_fread(volatile u8* dst, u32 size, void* fp) {
-  u32 n = 0;
-  while(n < size) {
-    *dst = fl_fgetc(fp);
-    n++;
-    dst++;
-  }
+// read from an open file into a buffer.
+// fl_fread transfers whole sectors straight to the destination,
+// one cluster per media access.
+// return count of bytes read
+static u32 file_read_into(volatile u8* dst, u32 size, void* fp) {
+  int n = fl_fread((void*)dst, 1, size, fp);
+  if(n < 0) { return 0; }
+  return (u32)n;
 }
 
 // strip space from the end of a string
@@ -110,38 +135,37 @@ static void strip_space(char* str, u8 len) {
 void files_init(void) {
   // scan directories
   print_dbg("\r\n BEES file_init, scanning directories..");
+  list_init(&dspList, DSP_PATH, DSP_INDEX_PATH);
+  list_init(&sceneList, SCENES_PATH, SCENES_INDEX_PATH);
+  list_init(&scalerList, SCALERS_PATH, SCALERS_INDEX_PATH);
   list_scan(&dspList, DSP_PATH);
   list_scan(&sceneList, SCENES_PATH);
   list_scan(&scalerList, SCALERS_PATH);
+  fat_print_cache_stats();
 }
 
-
 ////////////////////////
 //// modules
 
 // return filename for DSP given index in list
-const volatile char* files_get_dsp_name(u8 idx) {
+const volatile char* files_get_dsp_name(u16 idx) {
   return list_get_name(&dspList, idx);
 }
 
 // load a blacfkin executable by index */
-u8 files_load_dsp(u8 idx) {  
+u8 files_load_dsp(u16 idx) {  
   //  app_notify("loading dsp...");
   return files_load_dsp_name((const char*)files_get_dsp_name(idx));
 }
 
-// search for specified dsp file and load it
-u8 files_load_dsp_name(const char* name) {
+// search for specified dsp file and stream it to the dsp
+static u8 files_stream_dsp_name(const char* name) {
   void* fp;
   u32 size = 0;
   u8 ret;
   char nameTry[64];
   //  ModuleVersion modVers;
 
-  delay_ms(10);
-
-  app_pause();
-
   fp = list_open_file_name(&dspList, name, "r", &size);
 
   if(fp == NULL) {
@@ -155,15 +179,17 @@ u8 files_load_dsp_name(const char* name) {
   if( fp != NULL) {	  
     print_dbg("\r\n found file, loading dsp: ");
     print_dbg(name);
-    fake_fread(bfinLdrData, size, fp);
+    if(size > BFIN_LDR_MAX_BYTES) {
+      print_dbg("\r\n warning: dsp file is > ldr buffer, truncating");
+      size = BFIN_LDR_MAX_BYTES;
+    }
+    // reboot the dsp, sending each chunk as the next one is read.
+    // the whole image also ends up in the RAM buffer.
+    size = bfin_load_stream(&file_read_into, fp, size);
 
     fl_fclose(fp);
-    bfinLdrSize = size;
 
-    if(bfinLdrSize > 0) {
-      print_dbg("\r\n loading bfin from buf");
-      // reboot the dsp with new firmware in RAM
-      bfin_load_buf();
+    if(size > 0) {
       print_dbg("\r\n finished load");
       // write module name in global scene data
 
@@ -181,15 +207,39 @@ u8 files_load_dsp_name(const char* name) {
       print_dbg("\r\n sceneData->moduleName : ");
       print_dbg(name);
 
+      strncpy(dspLoaded, name, DSP_LOADED_NAME_LEN - 1);
       ret = 1;
     } else {
-      print_dbg("\r\n bfin ldr size was <=0, aborting");
+      print_dbg("\r\n bfin ldr stream failed, aborting");
       ret = 0;
     }
   } else {
     print_dbg("\r\n error: fp was null in files_load_dsp_name \r\n");
     ret = 0;
   }
+  return ret;
+}
+
+// search for specified dsp file and load it.
+// if the stream fails after the dsp was reset, reload the last good module;
+// if that fails too, the dsp is left in reset (see bfin_halted()).
+u8 files_load_dsp_name(const char* name) {
+  u8 ret;
+  char nameTry[DSP_LOADED_NAME_LEN];
+
+  delay_ms(10);
+
+  app_pause();
+
+  ret = files_stream_dsp_name(name);
+
+  if( !ret && bfin_halted() && (dspLoaded[0] != 0) && strcmp(dspLoaded, name) ) {
+    print_dbg("\r\n reloading last dsp module: ");
+    print_dbg(dspLoaded);
+    strcpy(nameTry, dspLoaded);
+    files_stream_dsp_name(nameTry);
+  }
+
   app_resume();
   return ret;
 }
@@ -197,7 +247,7 @@ u8 files_load_dsp_name(const char* name) {
 
 // store .ldr as default in internal flash, given index
 #if 0
-void files_store_default_dsp(u8 idx) {
+void files_store_default_dsp(u16 idx) {
   files_store_default_dsp_name((const char*)files_get_dsp_name(idx));
   /* const char* name; */
   /* void* fp;	   */
@@ -242,7 +292,7 @@ void files_store_default_dsp_name(const char* name) {
     print_dbg(" , size: ");
     print_dbg_ulong(size);
     //    fl_fread((void*)bfinLdrData, 1, size, fp);
-    fake_fread((void*)bfinLdrData, size, fp);
+    file_read_into(bfinLdrData, size, fp);
 
     // TEST: print module data
 #if 0
@@ -269,7 +319,7 @@ void files_store_default_dsp_name(const char* name) {
 
 
 // return count of dsp files
-u8 files_get_dsp_count(void) {
+u16 files_get_dsp_count(void) {
   return dspList.num;
 }
 
@@ -277,7 +327,7 @@ u8 files_get_dsp_count(void) {
 //// scenes
 
 // return filename for scene given index in list
-const volatile char* files_get_scene_name(u8 idx) {
+const volatile char* files_get_scene_name(u16 idx) {
   /// DEBUG
   /* char buf[SCENE_NAME_LEN]; */
   /* u8 j; */
@@ -297,7 +347,7 @@ const volatile char* files_get_scene_name(u8 idx) {
 }
 
 // load scene by index */
-u8 files_load_scene(u8 idx) {  
+u8 files_load_scene(u16 idx) {  
   return files_load_scene_name((const char*)files_get_scene_name(idx));
 }
 
@@ -313,7 +363,7 @@ u8 files_load_scene_name(const char* name) {
   fp = list_open_file_name(&sceneList, name, "r", &size);
 
   if( fp != NULL) {	  
-    fake_fread((volatile u8*)sceneData, sizeof(sceneData_t), fp);
+    file_read_into((volatile u8*)sceneData, sizeof(sceneData_t), fp);
     fl_fclose(fp);
     scene_read_buf();
 
@@ -331,7 +381,7 @@ u8 files_load_scene_name(const char* name) {
 
 
 // store scene to sdcard at idx
-void files_store_scene(u8 idx) {
+void files_store_scene(u16 idx) {
   files_store_scene_name((const char*)files_get_scene_name(idx), 0);
 }
 
@@ -372,7 +422,7 @@ void files_store_scene_name(const char* name, u8 ext) {
 
 
 // return count of scene files
-u8 files_get_scene_count(void) {
+u16 files_get_scene_count(void) {
   return sceneList.num;
 }
 
@@ -381,7 +431,7 @@ u8 files_get_scene_count(void) {
 
 
 // return filename for scaler given index in list
-const volatile char* files_get_scaler_name(u8 idx) {
+const volatile char* files_get_scaler_name(u16 idx) {
   return list_get_name(&scalerList, idx);
 }
 
@@ -390,12 +440,9 @@ const volatile char* files_get_scaler_name(u8 idx) {
 u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
   void* fp;
   u32 size = 0;
-  u32 i;
+  u32 i, n;
   union { u32 u; s32 s; u8 b[4]; } swap;
   u8 ret = 0;
-  //// test
-  //s32* p = dst;
-  ///
 
   app_pause();
   fp = list_open_file_name(&scalerList, name, "r", &size);
@@ -403,16 +450,19 @@ u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
 
     print_dbg("\r\n scaler file pointer: 0x");
     print_dbg_hex((u32)fp);
+    // first word is data size in words
+    if(file_read_into(swap.b, 4, fp) != 4) {
+      print_dbg("\r\n error: scaler file has no header");
+      for(i=0; i<dstSize; ++i) {
+	dst[i] = 0;
+      }
+      fl_fclose(fp);
+      app_resume();
+      return 0;
+    }
 #ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
+    swap.u = ( (u32)swap.b[0] ) | ( (u32)swap.b[1] << 8 )
+      | ( (u32)swap.b[2] << 16 ) | ( (u32)swap.b[3] << 24 );
 #endif
     size = swap.u;
 
@@ -421,57 +471,26 @@ u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
 
     if(size > dstSize) {
       print_dbg("\r\n warning: requested scaler data is > target, truncating");
-      for(i=0; i<dstSize; ++i) {
-
-#ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
-#endif
-	*dst++ = swap.s;
-      }
+      size = dstSize;
     } else if (size < dstSize) {
       print_dbg("\r\n warning: requested scaler data is < target, padding");
-      for(i=0; i<size; ++i) {
-#ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
-#endif
-	*dst++ = swap.s;
-      }
-      // remainder
-      size = dstSize - size;
-      for(i=0; i<size; ++i) {
-	*dst++ = 0;
-      }
-    } else {
-      for(i=0; i<size; ++i) {
+    }
+    // words are stored big-endian, same as avr32; read them in place
+    n = file_read_into((volatile u8*)dst, size * 4, fp) / 4;
+    if(n < size) {
+      print_dbg("\r\n warning: scaler file is shorter than its header, padding");
+      size = n;
+    }
 #ifdef SCALER_LE
-    swap.b[3] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[0] = fl_fgetc(fp);
-#else
-    swap.b[0] = fl_fgetc(fp);
-    swap.b[1] = fl_fgetc(fp);
-    swap.b[2] = fl_fgetc(fp);
-    swap.b[3] = fl_fgetc(fp);
+    for(i=0; i<size; ++i) {
+      swap.s = dst[i];
+      dst[i] = (s32)( ( (u32)swap.b[0] ) | ( (u32)swap.b[1] << 8 )
+		      | ( (u32)swap.b[2] << 16 ) | ( (u32)swap.b[3] << 24 ) );
+    }
 #endif
-	*dst++ = swap.s;
-      }
+    // remainder
+    for(i=size; i<dstSize; ++i) {
+      dst[i] = 0;
     }
     fl_fclose(fp);
     ret = 1;
@@ -482,11 +501,6 @@ u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
 
   print_dbg("\r\n finished loading scaler file (?)");
 
-  ///// TEST: verify
-  /* for(i=0; i<size; i++) { */
-  /*   print_dbg(" 0x"); print_dbg_hex(p[i]); if((i%4)==0) { print_dbg("\r\n"); } */
-  /* } */
-
   app_resume();
   return ret;
 }
@@ -495,100 +509,173 @@ u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize) {
 //---------------------
 //------ static
 
-const char* list_get_name(dirList_t* list, u8 idx) {
-  return (const char*) ( list->nameBuf + (idx * DIR_LIST_NAME_LEN) );
+// FNV-1a hash of a name string
+static u32 name_hash(const char* name) {
+  u32 h = 2166136261UL;
+  while(*name != '\0') {
+    h = (h ^ (u8)(*name)) * 16777619UL;
+    name++;
+  }
+  return h;
+}
+
+// clear and rebuild name hash from entries
+static void list_build_hash(dirList_t* list) {
+  u32 i, slot;
+  for(i=0; i<DIR_LIST_HASH_SIZE; ++i) {
+    list->hash[i] = DIR_LIST_HASH_NONE;
+  }
+  for(i=0; i<list->num; ++i) {
+    slot = name_hash(list->entries[i].name) & DIR_LIST_HASH_MASK;
+    // linear probe
+    while(list->hash[slot] != DIR_LIST_HASH_NONE) {
+      slot = (slot + 1) & DIR_LIST_HASH_MASK;
+    }
+    list->hash[slot] = (u16)i;
+  }
+}
+
+// try to load list from its persistent index.
+// return 1 if the index exists and matches the directory signature.
+static u8 list_read_index(dirList_t* list, u32 sig) {
+  dirIndexHeader_t head;
+  void* fp;
+  u32 n;
+  u8 ret = 0;
+
+  fp = fl_fopen(list->indexPath, "r");
+  if(fp == NULL) { return 0; }
+  n = file_read_into((volatile u8*)&head, sizeof(dirIndexHeader_t), fp);
+  if( (n == sizeof(dirIndexHeader_t))
+      && (head.magic == DIR_INDEX_MAGIC)
+      && (head.version == DIR_INDEX_VERSION)
+      && (head.sig == sig)
+      && (head.num <= DIR_LIST_MAX_NUM) ) {
+    n = head.num * sizeof(dirEntry_t);
+    if(file_read_into((volatile u8*)list->entries, n, fp) == n) {
+      list->num = head.num;
+      ret = 1;
+    }
+  }
+  fl_fclose(fp);
+  return ret;
+}
+
+// store list to its persistent index
+static void list_write_index(dirList_t* list, u32 sig) {
+  dirIndexHeader_t head;
+  void* fp;
+
+  head.magic = DIR_INDEX_MAGIC;
+  head.version = DIR_INDEX_VERSION;
+  head.sig = sig;
+  head.num = list->num;
+
+  fp = fl_fopen(list->indexPath, "wb");
+  if(fp == NULL) {
+    print_dbg("\r\n failed to open directory index for writing: ");
+    print_dbg(list->indexPath);
+    return;
+  }
+  fl_fwrite((const void*)&head, sizeof(dirIndexHeader_t), 1, fp);
+  fl_fwrite((const void*)list->entries, sizeof(dirEntry_t), list->num, fp);
+  fl_fclose(fp);
+}
+
+void list_init(dirList_t* list, const char* path, const char* indexPath) {
+  strcpy(list->path, path);
+  list->indexPath = indexPath;
+  list->entries = (dirEntry_t*)alloc_mem(DIR_LIST_MAX_NUM * sizeof(dirEntry_t));
+  list->hash = (u16*)alloc_mem(DIR_LIST_HASH_SIZE * sizeof(u16));
+  list->num = 0;
+}
+
+const char* list_get_name(dirList_t* list, u16 idx) {
+  if(idx >= list->num) { return ""; }
+  return (const char*)(list->entries[idx].name);
+}
+
+dirEntry_t* list_find(dirList_t* list, const char* name) {
+  u32 slot = name_hash(name) & DIR_LIST_HASH_MASK;
+  u16 i;
+  while( (i = list->hash[slot]) != DIR_LIST_HASH_NONE ) {
+    if(strcmp(list->entries[i].name, name) == 0) {
+      return &(list->entries[i]);
+    }
+    slot = (slot + 1) & DIR_LIST_HASH_MASK;
+  }
+  return NULL;
 }
 
 void list_scan(dirList_t* list, const char* path) {
   FL_DIR dirstat; 
   struct fs_dir_ent dirent;
-  int i;
-
-  // clear out the buffers...
-  for(i=0; i<DIR_LIST_NAME_BUF_SIZE; ++i) {
-    list->nameBuf[i] = '\0';
-  }
+  dirEntry_t* ent;
+  uint32 sig = 0;
+  u8 haveSig;
 
   list->num = 0;
   strcpy(list->path, path);
 
-  if( fl_opendir(path, &dirstat) ) {      
-    while (fl_readdir(&dirstat, &dirent) == 0) {
-      if( !(dirent.is_dir) ) {
-	strncpy((char*)(list->nameBuf + (list->num * DIR_LIST_NAME_LEN)), dirent.filename, DIR_LIST_NAME_LEN_1);
-	*(list->nameBuf + (list->num * DIR_LIST_NAME_LEN) + DIR_LIST_NAME_LEN_1) = '\0';
-	print_dbg("\r\n added file: ");
-	print_dbg(dirent.filename);
-	print_dbg(" , count: ");
-	print_dbg_ulong(list->num);
-	list->num += 1;
+  // the index is only valid if the directory hasn't changed since
+  haveSig = fl_dir_signature(path, &sig);
+  if(haveSig && list_read_index(list, sig)) {
+    print_dbg("\r\n loaded directory index for path: ");
+    print_dbg(list->path);
+  } else {
+    if( fl_opendir(path, &dirstat) ) {      
+      while (fl_readdir(&dirstat, &dirent) == 0) {
+	if( !(dirent.is_dir) ) {
+	  if(list->num == DIR_LIST_MAX_NUM) {
+	    print_dbg("\r\n directory list is full, ignoring remaining files");
+	    break;
+	  }
+	  ent = &(list->entries[list->num]);
+	  strncpy(ent->name, dirent.filename, DIR_LIST_NAME_LEN_1);
+	  ent->name[DIR_LIST_NAME_LEN_1] = '\0';
+	  ent->cluster = dirent.cluster;
+	  ent->size = dirent.size;
+	  list->num += 1;
+	}
       }
     }
+    print_dbg("\r\n scanned directory at path: ");
+    print_dbg(list->path);
+    if(haveSig) {
+      list_write_index(list, sig);
+    }
   }
-  print_dbg("\r\n scanned list at path: ");
-  print_dbg(list->path);
-  print_dbg(" , contents : \r\n");
-
-\
-  /* for(i=0; i<list->num; i++) { */
-  /*   char buf[32]; */
-  /*   u8 j; */
-  /*   strncpy( buf, list_get_name(list, i), 32 ); */
-
-  /*   print_dbg(buf); */
-
-  /*   for(j=0; j<32; j++) { */
-  /*     print_dbg( " 0x"); */
-  /*     print_dbg_hex(buf[j]); */
-  /*     print_dbg( " " ); */
-  /*     if(!(j%8)) { print_dbg("\r\n"); } */
-  /*   } */
-  /*   print_dbg("\r\n"); */
-  /* } */
-  /* print_dbg("\r\n"); */
+  print_dbg(" , count: ");
+  print_dbg_ulong(list->num);
+
+  list_build_hash(list);
 }
 
 // search for a given filename in a listed directory. set size by pointer
 void* list_open_file_name(dirList_t* list, const char* name, const char* mode, u32* size) {
-  FL_DIR dirstat;
-  struct fs_dir_ent dirent;
+  dirEntry_t* ent;
   char path[64];
   void* fp;
 
   print_dbg("\r\n *list_open_file_name: "); 
-  print_dbg(path); 
-  print_dbg(" at ");
   print_dbg(list->path);
   print_dbg(" request: ");
   print_dbg(name);
 
-
-  strcpy(path, list->path);
-
-  if(fl_opendir(path, &dirstat)) {
-    
-    while (fl_readdir(&dirstat, &dirent) == 0) {
-      print_dbg("\r\n ... checking against "); 
-      print_dbg(dirent.filename);
-
-      if (strcmp(dirent.filename, name) == 0) {
-	strncat(path, dirent.filename, 58);
-	
-	print_dbg("\r\n ... found, opening at:  "); 
-	print_dbg(path);
-      
-	fp = fl_fopen(path, mode);
-	*size = dirent.size;
-	break;
-      } else { // no match on this entry
-	*size = 0;
-	fp = NULL;
-      }
-    } // end loop
-  } else { // dir error
-    print_dbg("\r\n directory error.");
+  ent = list_find(list, name);
+  if(ent == NULL) {
     *size = 0;
-    fp = NULL;
+    return NULL;
+  }
+
+  if( (mode[0] == 'r') && (mode[1] == '\0') ) {
+    // read-only: open straight from the indexed cluster
+    fp = fl_fopen_cluster(ent->cluster, ent->size);
+  } else {
+    strcpy(path, list->path);
+    strncat(path, ent->name, 63 - strlen(path));
+    fp = fl_fopen(path, mode);
   }
+  *size = ent->size;
   return fp;
 }
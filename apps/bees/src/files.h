@@ -17,17 +17,19 @@ extern void files_check_dsp(void);
 // populate the dsp filelist with names and return count
 // extern void files_scan_dsp(void);
 // return dsp filename for given index
-extern const volatile char* files_get_dsp_name(u8 idx);
+extern const volatile char* files_get_dsp_name(u16 idx);
 // return count of dsp files
-extern u8 files_get_dsp_count(void);
+extern u16 files_get_dsp_count(void);
 // load a blackfin executable by index
-extern u8 files_load_dsp(u8 idx);
+extern u8 files_load_dsp(u16 idx);
 // load a blackfin executable by filename
-// return 1 on success, 0 on failure
+// return 1 on success, 0 on failure.
+// on failure the previous module is reloaded if possible,
+// otherwise the dsp is held in reset (see bfin_halted()).
 extern u8 files_load_dsp_name(const char* name);
 // store dsp in flash, by index
 // return 1 on success, 0 on failure
-extern void files_store_default_dsp(u8 idx);
+extern void files_store_default_dsp(u16 idx);
 // store .ldr as default in internal flash, given name
 extern void files_store_default_dsp_name(const char* name);
 
@@ -35,28 +37,28 @@ extern void files_store_default_dsp_name(const char* name);
 // populate scene filelist with names and return count
 // extern void files_scan_scene(void);
 // return scene filename for given index
-extern const volatile char* files_get_scene_name(u8 idx);
+extern const volatile char* files_get_scene_name(u16 idx);
 // return count of scene files
-extern u8 files_get_scene_count(void);
+extern u16 files_get_scene_count(void);
 // load scene by index
 // return 1 on success, 0 on failure
-extern u8 files_load_scene(u8 idx);
+extern u8 files_load_scene(u16 idx);
 // load scene by filename
 // return 1 on success, 0 on failure
 extern u8 files_load_scene_name(const char* name);
 extern u8 files_load_scene_path(const char* name);
 
 // store scene by index
-extern void files_store_scene(u8 idx);
+extern void files_store_scene(u16 idx);
 // store scene by filename
 extern void files_store_scene_name(const char* name, u8 ext);
 
 
 //----- scalers
 // return dsp filename for given index
-extern const volatile char* files_get_scaler_name(u8 idx);
+extern const volatile char* files_get_scaler_name(u16 idx);
 // return count of dsp files
-extern u8 files_get_scaler_count(void);
+extern u16 files_get_scaler_count(void);
 // load scaler by filename
 // return 1 on success, 0 on failure
 extern u8 files_load_scaler_name(const char* name, s32* dst, u32 dstSize);
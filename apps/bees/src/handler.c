@@ -103,23 +103,25 @@ static void handle_Switch7(s32 data) {
 } 
 
 static void handle_MonomeConnect(s32 data) { 
+  eMonomeDevice type;
+  u8 w, h;
+  u8 dev = monome_event_device(data);
   print_dbg("\r\n received MonomeConnect event in BEES");
-  timers_set_monome();
+  monome_connect_parse_event_data(data, &type, &w, &h);
+  net_monome_connect(dev, type);
+  timers_set_monome(dev);
 }
 
 static void handle_MonomeDisconnect(s32 data) { 
-  timers_unset_monome();
+  // event data is the device index
+  net_monome_disconnect((u8)data);
+  timers_unset_monome((u8)data);
 }
 
 static void handle_MonomeGridKey(s32 data) { 
-  // net_monome.c defines a dynamic pointer to a single grid event handle.
-  // this is so bees can arbitrate focus between multiple grid ops.
-  /// FIXME: we need to differentiate between multiple devices.
-  /// of course, first we need USB hub support.
-  
-  print_dbg("\r\n monome grid key event in BEES.");
-
-  (*monome_grid_key_handler)(monomeOpFocus, data);
+  // net_monome.c routes the event to the operator
+  // focused on the source device.
+  net_monome_grid_key(data);
 }
 
 static void handle_MonomeGridTilt(s32 data) { 
@@ -127,7 +129,7 @@ static void handle_MonomeGridTilt(s32 data) {
 }
 
 static void handle_MonomeRingEnc(s32 data) {
-  (*monome_ring_enc_handler)(monomeOpFocus, data);
+  net_monome_ring_enc(data);
 }
 
 static void handle_MonomeRingKey(s32 data) { 
@@ -191,166 +193,3 @@ void assign_bees_event_handlers(void) {
   app_event_handlers[ kEventHidDisconnect ]	= &handle_HidDisconnect ;
   app_event_handlers[ kEventHidByte ]	= &handle_HidByte ;
 }
-
-//------------------------
-//--- knob scaling
-
-
-#if IO_BITS == 16
-// full-scale
-io_t scale_knob_value_small(io_t val) {
-  // ha!
-  return val;
-}
-
-// lower slope
-io_t scale_knob_value(io_t val) {
-  static const u32 kNumKnobScales_1 = 23;
-  static const u32 knobScale[24] = {
-    ///--- 3 linear segments:
-    // slope = 1
-    0x00000001, // 1
-    0x00000002, // 2
-    0x00000003, // 3
-    // slope = 0x10
-    0x00000030, // 4
-    0x00000040, // 5
-    0x00000050, // 6
-    0x00000060, // 7
-    0x00000070, // 8
-    0x00000080, // 9
-    0x00000090 ,  // 10
-    0x000000a0 , // 11
-    0x000000b0 , // 12
-    0x000000c0 , // 13
-    0x000000d0 , // 14
-    0x000000e0 , // 15
-    0x000000f0 , // 16
-    // slope == 0x100
-    0x00000100 , // 17
-    0x00000200 , // 18
-    0x00000300 , // 19
-    0x00000400 , // 20
-    0x00000500 , // 21
-    0x00000600 , // 22
-    0x00000700 , // 23
-    0x00000800 , // 24
-  };
-
-  s16 vabs = BIT_ABS_16(val);
-  s16 ret = val;
-
-  if(vabs > kNumKnobScales_1) {
-    vabs = kNumKnobScales_1;
-  }
-  /* print_dbg("\r\n knob scaling, input: 0x"); */
-  /* print_dbg_hex(val); */
-  /* print_dbg(", abs: 0x"); */
-  /* print_dbg_hex(vabs); */
-
-  ret = knobScale[vabs - 1];
-  if(val < 0) {
-    ret = BIT_NEG_ABS_16(ret);
-  }
-  //  print_dbg(", result: 0x");
-  //  print_dbg_hex(ret);
-
-  return ret;
-}
-#endif
-
-#if IO_BITS == 32
-/* // full-scale */
-/* s32 scale_knob_value(s32 val) { */
-/*   static const u32 kNumKnobScales_1 = 23; */
-/*   static const u32 knobScale[24] = { */
-/*     ///--- 3 linear segments: */
-/*     // slope = 1 */
-/*     0x00000001, // 1 */
-/*     0x00000002, // 2 */
-/*     // slope = 0x10 */
-/*     0x00000030, // 3 */
-/*     0x00000030, // 4 */
-/*     0x00000040, // 5 */
-/*     0x00000050, // 6 */
-/*     0x00000060, // 7 */
-/*     0x00000070, // 8 */
-/*     0x00000080, // 9 */
-/*     0x00000090 ,  // 10 */
-/*     0x000000a0 , // 11 */
-/*     0x000000b0 , // 12 */
-/*     // slope = 0x100 */
-/*     0x00000c00 , // 13 */
-/*     0x00000d00 , // 14 */
-/*     0x00000e00 , // 15 */
-/*     0x00000f00 , // 16 */
-/*     0x00001000 , // 17 */
-/*     0x00001100 , // 18 */
-/*     0x00001200 , // 19 */
-/*     0x00001300 , // 20 */
-/*     0x00001400 , // 21 */
-/*     0x00001500 , // 22 */
-/*     // ultra fast */
-/*     0x10000000 , // 23 */
-/*     0x20000000 , // 24 */
-/*   }; */
-/*   s32 vabs = BIT_ABS(val); */
-/*   s32 ret = val; */
-
-/*   if(vabs > kNumKnobScales_1) { */
-/*     vabs = kNumKnobScales_1; */
-/*   } */
-/*   ret = knobScale[vabs - 1]; */
-/*   if(val < 0) { */
-/*     ret = BIT_NEG_ABS(ret); */
-/*   } */
-/*   return ret; */
-/* } */
-
-/* // lower slope */
-/* s32 scale_knob_value_small(s32 val) { */
-/*   static const u32 kNumKnobScales_1 = 23; */
-/*   static const u32 knobScale[24] = { */
-/*     ///--- 3 linear segments: */
-/*     // slope = 1 */
-/*     0x00000001, // 1 */
-/*     0x00000002, // 2 */
-/*     // slope = 0x10 */
-/*     0x00000030, // 3 */
-/*     0x00000030, // 4 */
-/*     0x00000040, // 5 */
-/*     0x00000050, // 6 */
-/*     0x00000060, // 7 */
-/*     0x00000070, // 8 */
-/*     0x00000080, // 9 */
-/*     0x00000090 ,  // 10 */
-/*     0x000000a0 , // 11 */
-/*     0x000000b0 , // 12 */
-/*     0x000000c0 , // 13 */
-/*     0x000000d0 , // 14 */
-/*     0x000000e0 , // 15 */
-/*     0x000000f0 , // 16 */
-/*     // slope == 0x100 */
-/*     0x00000100 , // 17 */
-/*     0x00000200 , // 18 */
-/*     0x00000300 , // 19 */
-/*     0x00000400 , // 20 */
-/*     0x00000500 , // 21 */
-/*     0x00000600 , // 22 */
-/*     0x00000700 , // 23 */
-/*     0x00000800 , // 24 */
-/*   }; */
-
-/*   s32 vabs = BIT_ABS(val); */
-/*   s32 ret = val; */
-
-/*   if(vabs > kNumKnobScales_1) { */
-/*     vabs = kNumKnobScales_1; */
-/*   } */
-/*   ret = knobScale[vabs - 1]; */
-/*   if(val < 0) { */
-/*     ret = BIT_NEG_ABS(ret); */
-/*   } */
-/*   return ret; */
-/* } */
-#endif
@@ -8,7 +8,4 @@
 // assign ui handlers  
 extern void assign_bees_event_handlers(void);
 
-extern io_t scale_knob_value(io_t val);
-extern io_t scale_knob_value_small(io_t val);
-
 #endif 
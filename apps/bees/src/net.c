@@ -26,6 +26,7 @@
 
 // bees
 #include "net.h"
+#include "net_monome.h"
 #include "net_protected.h"
 #include "op.h" 
 #include "op_derived.h"
@@ -238,6 +239,8 @@ void net_init(void) {
 
   print_dbg("\r\n initialized ctlnet, byte count: ");
   print_dbg_hex(sizeof(ctlnet_t));
+  // no monome operators or devices yet
+  net_monome_init();
   add_sys_ops();
   // ???
   netActive = 1;
@@ -359,6 +362,55 @@ void net_activate(s16 inIdx, const io_t val, void* op) {
   
 }
 
+// activate a run of outputs, stepping through values by the given stride.
+// the active and play-mode checks are made once for the whole run,
+// then each connected target is set in output order.
+static void net_activate_run(const op_out_t* outs, const io_t* vals, u8 stride,
+			     const u8 num, void* op) {
+  inode_t* pIn;
+  s16 inIdx;
+  s16 pIndex;
+  u8 play;
+  u8 i;
+
+  if(!netActive) {
+    if(op != NULL) {
+      return;
+    }
+  }
+
+  // play-mode processing applies unless operators have focus
+  play = (pageIdx == ePagePlay) && !opPlay;
+
+  for(i=0; i<num; i++, vals += stride) {
+    inIdx = outs[i];
+    if(inIdx < 0) {
+      continue;
+    }
+    if(inIdx < net->numIns) {
+      pIn = &(net->ins[inIdx]);
+      op_set_in_val(net->ops[pIn->opIdx], pIn->opInIdx, *vals);
+    } else {
+      pIndex = inIdx - net->numIns;
+      if (pIndex >= net->numParams) { continue; }
+      set_param_value(pIndex, *vals);
+    }
+    if(play && net_get_in_play(inIdx)) {
+      play_input(inIdx);
+    }
+  }
+}
+
+// activate consecutive outputs of an operator, each with its own value
+void net_activate_outs(const op_out_t* outs, const io_t* vals, const u8 num, void* op) {
+  net_activate_run(outs, vals, 1, num, op);
+}
+
+// activate consecutive outputs of an operator with the same value
+void net_activate_outs_val(const op_out_t* outs, const io_t val, const u8 num, void* op) {
+  net_activate_run(outs, &val, 0, num, op);
+}
+
 // attempt to allocate a new operator from the static memory pool, return index
 s16 net_add_op(op_id_t opId) {
   u16 ins, outs;
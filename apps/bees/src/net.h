@@ -60,6 +60,13 @@ extern void net_remove_op(const u32 idx);
 // activate an input node with some input data
 extern void net_activate(s16 inIdx, const io_t val, void* srcOp);
 
+// activate consecutive outputs of an operator, each with its own value.
+// cheaper than separate net_activate() calls for ops with many outputs.
+extern void net_activate_outs(const op_out_t* outs, const io_t* vals, const u8 num, void* srcOp);
+
+// activate consecutive outputs of an operator with the same value
+extern void net_activate_outs_val(const op_out_t* outs, const io_t val, const u8 num, void* srcOp);
+
 // get current count of operators
 extern u16 net_num_ops(void);
 
@@ -1,65 +1,151 @@
+/* net_midi.c
+   bees
+   aleph
+
+   routes midi messages to operators.
+   the routing table holds a bitfield of operator slots
+   for each channel message type and channel, and for each system status.
+   each packet is parsed once, and only matching operators are called.
+*/
+
 // asf
 #include "print_funcs.h"
 
 // bees
 #include "net_midi.h"
 
-
 //--------------
-//--- types
-
-// list structure
-typedef struct _op_midi_list {
-  op_midi_t* top;
-  op_midi_t* cur;
-  u32 num;
-} op_midi_list_t;
+//--- defines
 
+// count of channel message types
+#define NET_MIDI_NUM_MSG 7
+// count of channels
+#define NET_MIDI_NUM_CHAN 16
+// count of system statuses
+#define NET_MIDI_NUM_SYS 16
 
 //-----------------------------
 //-- static variables
 
-// list of midi operators
-static op_midi_list_t ml = {
-  .top = NULL,
-  .cur = NULL,
-  .num = 0
-};
+// operators by slot
+static op_midi_t* ops[NET_MIDI_OPS_MAX] = { NULL };
 
-//--------------------------
-//-----  extern functions
+// slot bitfields for channel messages, by type and channel
+static u32 chanRoute[NET_MIDI_NUM_MSG][NET_MIDI_NUM_CHAN] = { { 0 } };
+// slot bitfields for system messages, by status low nibble
+static u32 sysRoute[NET_MIDI_NUM_SYS] = { 0 };
+
+//-----------------------------
+//-- static functions
+
+// set or clear an operator's slot bit in all the routes it matches
+static void net_midi_route(op_midi_t* op, u8 set) {
+  u32 bit = (u32)1 << op->slot;
+  u8 m, c, c0, c1;
 
-// push an op to the top of the list
-void net_midi_list_push(op_midi_t* op) {
-  if(ml.num == 0) {
-    ml.top = op;
-    op->prev = op;
-    op->next = op;
+  if(op->chan < 0 || op->chan >= NET_MIDI_NUM_CHAN) {
+    c0 = 0;
+    c1 = NET_MIDI_NUM_CHAN;
   } else {
-    op->prev = (ml.top)->prev;
-    op->next = ml.top;
-    ((ml.top)->prev)->next = op;
-    ml.top->prev = op;
-    ml.top = op;
+    c0 = (u8)(op->chan);
+    c1 = c0 + 1;
+  }
+  for(m=0; m<NET_MIDI_NUM_MSG; ++m) {
+    if(op->msgMask & (1 << m)) {
+      for(c=c0; c<c1; ++c) {
+	if(set) {
+	  chanRoute[m][c] |= bit;
+	} else {
+	  chanRoute[m][c] &= ~bit;
+	}
+      }
+    }
+  }
+  for(m=0; m<NET_MIDI_NUM_SYS; ++m) {
+    if(op->sysMask & (1 << m)) {
+      if(set) {
+	sysRoute[m] |= bit;
+      } else {
+	sysRoute[m] &= ~bit;
+      }
+    }
   }
-  ml.num += 1;
 }
 
+//--------------------------
+//-----  extern functions
+
+// add an operator to the routing table
+void net_midi_add(op_midi_t* op) {
+  u8 i;
+  for(i=0; i<NET_MIDI_OPS_MAX; ++i) {
+    if(ops[i] == op) {
+      // already added
+      return;
+    }
+  }
+  for(i=0; i<NET_MIDI_OPS_MAX; ++i) {
+    if(ops[i] == NULL) {
+      ops[i] = op;
+      op->slot = i;
+      net_midi_route(op, 1);
+      return;
+    }
+  }
+  op->slot = -1;
+  print_dbg("\r\n net_midi: routing table full, operator not added");
+}
 
 // remove an operator
-op_midi_t* net_midi_list_remove(op_midi_t* op) {
-  ///... todo, i guess
-  return ml.top;
+void net_midi_remove(op_midi_t* op) {
+  if(op->slot < 0 || ops[(u8)(op->slot)] != op) {
+    return;
+  }
+  net_midi_route(op, 0);
+  ops[(u8)(op->slot)] = NULL;
+  op->slot = -1;
+}
+
+// re-route an operator after changing its masks or channel
+void net_midi_update(op_midi_t* op) {
+  u32 bit;
+  u32 i, j;
+  if(op->slot < 0 || ops[(u8)(op->slot)] != op) {
+    return;
+  }
+  // clear every route, since the old masks are gone
+  bit = ~((u32)1 << op->slot);
+  for(i=0; i<NET_MIDI_NUM_MSG; ++i) {
+    for(j=0; j<NET_MIDI_NUM_CHAN; ++j) {
+      chanRoute[i][j] &= bit;
+    }
+  }
+  for(i=0; i<NET_MIDI_NUM_SYS; ++i) {
+    sysRoute[i] &= bit;
+  }
+  net_midi_route(op, 1);
 }
 
 // handle incoming midi packet
 void net_handle_midi_packet(u32 data) {
+  u8 status = data >> 24;
+  u32 route;
   u32 i;
-  op_midi_t* op = ml.top;
-  //  print_dbg("\r\n net_handle_midi_packet, num ops: ");
-  // print_dbg_ulong(ml.num);
-  for(i=0; i < ml.num; ++i) {
+  op_midi_t* op;
+
+  if(status >= 0xf0) {
+    route = sysRoute[status & 0xf];
+  } else if(status >= 0x80) {
+    route = chanRoute[(status >> 4) - 8][status & 0xf];
+  } else {
+    return;
+  }
+
+  while(route != 0) {
+    // lowest set slot
+    i = __builtin_ctz(route);
+    route &= route - 1;
+    op = ops[i];
     (*(op->handler))(op, data);
-    op = op->next;
   }
 }
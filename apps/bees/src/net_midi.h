@@ -2,7 +2,8 @@
    net_midi.h
 
    midi management routines for the bees control network.
-   handles operator focus, routes handler/refresh requests
+   routes each incoming message to the operators that asked for it,
+   by message type and channel.
 
 */
 
@@ -13,31 +14,57 @@
 #include "types.h"
 #include "midi.h"
 
+//-----------------------
+//---- defines
+
+// max count of midi operators
+#define NET_MIDI_OPS_MAX 32
+
+// channel message types, as bits for op_midi_t.msgMask.
+// indexed by (status >> 4) - 8.
+#define NET_MIDI_NOTE_OFF	(1 << 0)
+#define NET_MIDI_NOTE_ON	(1 << 1)
+#define NET_MIDI_POLY_PRESSURE	(1 << 2)
+#define NET_MIDI_CC		(1 << 3)
+#define NET_MIDI_PROGRAM	(1 << 4)
+#define NET_MIDI_CHAN_PRESSURE	(1 << 5)
+#define NET_MIDI_PITCH_BEND	(1 << 6)
+
+// system messages, as bits for op_midi_t.sysMask.
+// indexed by the low nibble of status 0xf0 - 0xff.
+#define NET_MIDI_SYS(status)	(1 << ((status) & 0xf))
+
 //-----------------------
 //---- types
 typedef void(*midi_handler_t)(void* op, u32 event);
 
-// abstract superclass for midi operators
-// has event handler and focus flag
+// abstract superclass for midi operators.
+// the handler is only called for messages matching the masks and channel,
+// with event data as described in midi.h.
 typedef struct _op_midi {
   // handler function, will connect to app event handler
   midi_handler_t handler;
   // pointer to operator subclass
   void* sub;
-  // pointers to adjacent list elements
-  struct _op_midi* next;
-  struct _op_midi* prev;
-
+  // channel message types to receive
+  u8 msgMask;
+  // channel to receive, or -1 for all channels
+  s8 chan;
+  // system messages to receive
+  u16 sysMask;
+  // index in routing table, or -1 if not added
+  s8 slot;
 } op_midi_t;
 
 //-------------------------
 //--- extern functions
 
-// add op pointer after the current position
-//extern void net_midi_list_add(op_midi_t* op);
-extern void net_midi_list_push(op_midi_t* op);
-// delete op pointer at current position, return next pointer in list
-extern op_midi_t* net_midi_list_remove(op_midi_t* op);
+// add an operator to the routing table, using its masks and channel
+extern void net_midi_add(op_midi_t* op);
+// remove an operator from the routing table
+extern void net_midi_remove(op_midi_t* op);
+// re-route an operator after changing its masks or channel
+extern void net_midi_update(op_midi_t* op);
 // handle incoming midi packet
 extern void net_handle_midi_packet(u32 data);
 
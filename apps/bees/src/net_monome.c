@@ -4,89 +4,221 @@
 
    monome driver <-> operator glue layer
 
-   keeps pointers to handler functions,
-   manages operator focus
+   keeps a table of connected devices,
+   manages operator focus for each device
 */
 
 #include "print_funcs.h"
 #include "net_monome.h"
 
+//---------------------------------
+//---- static types
+
+// per-device state
+typedef struct {
+  // connection flag
+  u8 connected;
+  // device type
+  eMonomeDevice type;
+  // operator holding focus, or NULL
+  op_monome_t* focus;
+} netMonomeDev_t;
+
+//---------------------------------
+//---- static variables
+
+// device table, indexed as in avr32_lib/monome.c
+static netMonomeDev_t netDev[MONOME_MAX_DEVICES];
+
+// operators with focus set, waiting for a device of their type
+static op_monome_t* pending = NULL;
 
-// dummy handler
-static void dummyHandler(void* op, u32 edata) { return; }
+//---------------------------------
+//---- static functions
 
 // use led state buffer and dirty flags
-static void monome_grid_key_loopback(void* op, u32 edata) {
+static void monome_grid_key_loopback(u8 dev, u32 edata) {
   u8 x, y, z;
-  /// FIXME: this stuff should really be abstracted
   monome_grid_key_parse_event_data(edata, &x, &y, &z);
-  monomeLedBuffer[x | (y << 4)] = z;
-  monome_calc_quadrant_flag(x, y);
+  monome_led_set(dev, x, y, z);
 }
 
 // use led state buffer and dirty flags
-static void monome_ring_enc_loopback(void* op, u32 edata) {
+static void monome_ring_enc_loopback(u8 dev, u32 edata) {
   u8 n;
   s8 val;
   monome_ring_enc_parse_event_data(edata, &n, &val);
   if(val > 0) {
-    monomeLedBuffer[val + (n<<6)] = 15;
-    monomeFrameDirty |= (1<<n);
+    monome_ring_set(dev, n, val, MONOME_LED_MAX_LEVEL);
   }
 }
 
+// add an operator to the pending list, if not there already
+static void pending_push(op_monome_t* op_monome) {
+  op_monome_t* p = pending;
+  while(p != NULL) {
+    if(p == op_monome) { return; }
+    p = p->next;
+  }
+  op_monome->next = pending;
+  pending = op_monome;
+}
 
-//---------------------------------
-// extern variables, initialized here.
-
-
-// FIXME: a similar problem to avr32_lib/monome.c
-// we are assuming there is only one connected device,
-// but of course we would like to implement hub support
-// and allow for multiple devices in the future.
-
-// this would means that multiple operators might be mapped
-// arbitrarily to different sources! oy...
+// remove an operator from the pending list
+static void pending_remove(op_monome_t* op_monome) {
+  op_monome_t** pp = &pending;
+  while(*pp != NULL) {
+    if(*pp == op_monome) {
+      *pp = op_monome->next;
+      op_monome->next = NULL;
+      return;
+    }
+    pp = &((*pp)->next);
+  }
+}
 
-monome_handler_t monome_grid_key_handler = &monome_grid_key_loopback;
-monome_handler_t monome_ring_enc_handler = &monome_ring_enc_loopback;
-op_monome_t* monomeOpFocus = NULL;
+// give a device's focus to an operator
+static void focus_bind(op_monome_t* op_monome, u8 dev) {
+  op_monome_t* prev = netDev[dev].focus;
+  if(prev != NULL && prev != op_monome) {
+    /// stealing focus, inform the previous holder
+    prev->focus = 0;
+    prev->dev = MONOME_NO_DEVICE;
+  }
+  netDev[dev].focus = op_monome;
+  op_monome->dev = dev;
+  op_monome->focus = 1;
+  print_dbg("\r\n bound monome operator to device: ");
+  print_dbg_ulong(dev);
+}
 
-/// TODO: tilt and key press should be decoupled from grid/ring??? yeah probly. 
-/// specialized operators are not really appropriate,
-//// have system create additional instances of adc/sw ?? hm
-//monome_handler_t monome_grid_tilt_handler = NULL;
-//monome_handler_t monome_ring_key_handler = NULL;
+// find a connected device of the given type, preferring one without focus.
+// return MONOME_NO_DEVICE if none is connected.
+static u8 focus_find(eMonomeDevice type) {
+  u8 i;
+  u8 dev = MONOME_NO_DEVICE;
+  for(i=0; i<MONOME_MAX_DEVICES; ++i) {
+    if(netDev[i].connected && netDev[i].type == type) {
+      if(netDev[i].focus == NULL) {
+	return i;
+      }
+      if(dev == MONOME_NO_DEVICE) {
+	dev = i;
+      }
+    }
+  }
+  return dev;
+}
 
 //--------------------------
 //---- extern functions
 // init
 extern void net_monome_init(void) {
-  //...
+  u8 i;
+  for(i=0; i<MONOME_MAX_DEVICES; ++i) {
+    netDev[i].connected = 0;
+    netDev[i].type = eDeviceNumDevices;
+    netDev[i].focus = NULL;
+  }
+  pending = NULL;
 }
 
 // set focus
 extern void net_monome_set_focus(op_monome_t* op_monome, u8 focus) {
-  print_dbg("\r\n setting monome device focu, op pointer: 0x");
+  u8 dev;
+  print_dbg("\r\n setting monome device focus, op pointer: 0x");
   print_dbg_hex((u32)op_monome);
   print_dbg(" , value: ");
   print_dbg_ulong(focus);
 
   if(focus > 0) {
-    if(monomeOpFocus != NULL ){
-      /// stealing focus, inform the previous holder
-      monomeOpFocus->focus = 0;
+    if(op_monome->dev < MONOME_MAX_DEVICES
+       && netDev[op_monome->dev].focus == op_monome) {
+      // already bound
+      op_monome->focus = 1;
+      return;
+    }
+    dev = focus_find(op_monome->type);
+    if(dev == MONOME_NO_DEVICE) {
+      // nothing to focus on yet; wait for a connection
+      op_monome->dev = MONOME_NO_DEVICE;
+      op_monome->focus = 1;
+      pending_push(op_monome);
+    } else {
+      focus_bind(op_monome, dev);
     }
-    monome_grid_key_handler = op_monome->handler;
-    monomeOpFocus = op_monome;
-    op_monome->focus = 1;
   } else {
-    // release focus if we had it, otherwise do nothing
-    if( monomeOpFocus == op_monome) {
-      monome_grid_key_handler = (monome_handler_t)&dummyHandler;
-      monomeOpFocus = NULL;
-      op_monome->focus = 0;
+    // release focus if we had it
+    pending_remove(op_monome);
+    dev = op_monome->dev;
+    if(dev < MONOME_MAX_DEVICES && netDev[dev].focus == op_monome) {
+      netDev[dev].focus = NULL;
     }
+    op_monome->dev = MONOME_NO_DEVICE;
+    op_monome->focus = 0;
+  }
+}
+
+// a device was connected
+extern void net_monome_connect(u8 dev, eMonomeDevice type) {
+  op_monome_t* p;
+  op_monome_t* match;
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  netDev[dev].connected = 1;
+  netDev[dev].type = type;
+  netDev[dev].focus = NULL;
+  // give it to the longest-waiting operator of this type.
+  // the list is pushed at the head, so that is the last match.
+  match = NULL;
+  p = pending;
+  while(p != NULL) {
+    if(p->type == type) { match = p; }
+    p = p->next;
+  }
+  if(match != NULL) {
+    pending_remove(match);
+    focus_bind(match, dev);
+  }
+}
+
+// a device was disconnected
+extern void net_monome_disconnect(u8 dev) {
+  op_monome_t* op_monome;
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  op_monome = netDev[dev].focus;
+  netDev[dev].connected = 0;
+  netDev[dev].type = eDeviceNumDevices;
+  netDev[dev].focus = NULL;
+  if(op_monome != NULL) {
+    // keep focus and wait for a reconnection
+    op_monome->dev = MONOME_NO_DEVICE;
+    pending_push(op_monome);
+  }
+}
+
+// grid key event
+extern void net_monome_grid_key(u32 data) {
+  u8 dev = monome_event_device(data);
+  op_monome_t* op_monome;
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  op_monome = netDev[dev].focus;
+  if(op_monome != NULL) {
+    (*(op_monome->handler))(op_monome, data);
+  } else {
+    monome_grid_key_loopback(dev, data);
+  }
+}
+
+// ring encoder event
+extern void net_monome_ring_enc(u32 data) {
+  u8 dev = monome_event_device(data);
+  op_monome_t* op_monome;
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  op_monome = netDev[dev].focus;
+  if(op_monome != NULL) {
+    (*(op_monome->handler))(op_monome, data);
+  } else {
+    monome_ring_enc_loopback(dev, data);
   }
 }
 
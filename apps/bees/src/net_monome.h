@@ -27,26 +27,38 @@ typedef struct _op_monome {
   monome_handler_t handler;
   // focus flag
   u8 focus;
+  // type of device this operator wants focus on
+  eMonomeDevice type;
+  // index of the device holding this operator's focus,
+  // or MONOME_NO_DEVICE if unbound
+  u8 dev;
+  // next operator waiting for a device
+  struct _op_monome* next;
   // pointer to operator subclass
   void* op;
 } op_monome_t;
 
-//---------------------
-//----- variables
-
-extern monome_handler_t monome_grid_key_handler;
-extern monome_handler_t monome_grid_key_handler;
-extern monome_handler_t monome_ring_enc_handler;
-op_monome_t* monomeOpFocus;
-
 //------------------------
 //----- functions
 
 // initialize
-void net_monome_init(void);
+extern void net_monome_init(void);
+
+// set/release focus.
+// an operator is bound to a connected device of its type,
+// preferring one that no other operator has focused.
+// if none is connected, it waits for the next connection.
+extern void net_monome_set_focus(op_monome_t* op_monome, u8 focus);
+
+// a device was connected at the given index
+extern void net_monome_connect(u8 dev, eMonomeDevice type);
+
+// a device was disconnected; its operator waits for a reconnection
+extern void net_monome_disconnect(u8 dev);
 
-// set/release focus
-extern void net_monome_set_focus(op_monome_t* grid, u8 focus);
+// route input events to the operator focused on the source device
+extern void net_monome_grid_key(u32 data);
+extern void net_monome_ring_enc(u32 data);
 
 // set operator attributes from connected grid device
 extern void net_monome_set_attributes( /* ...???... */void);
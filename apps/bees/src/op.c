@@ -178,6 +178,21 @@ const op_desc_t op_registry[numOpClasses] = {
     .size = sizeof(op_route_t),
     .init = &op_route_init,
     .deinit = NULL
+  }, {
+    .name = "MOUTNOTE",
+    .size = sizeof(op_midi_out_note_t),
+    .init = &op_midi_out_note_init,
+    .deinit = NULL
+  }, {
+    .name = "MOUTCC",
+    .size = sizeof(op_midi_out_cc_t),
+    .init = &op_midi_out_cc_init,
+    .deinit = NULL
+  }, {
+    .name = "GRIDLVL",
+    .size = sizeof(op_mgrid_level_t),
+    .init = &op_mgrid_level_init,
+    .deinit = &op_mgrid_level_deinit
   }
 
 };
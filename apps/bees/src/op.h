@@ -26,6 +26,7 @@ typedef enum {
   eOpFlagMonomeGrid, // op is a monome grid controller
   eOpFlagMonomeRing, // op is a monome arc controller
   eOpFlagMidiIn, // op is a midi input
+  eOpFlagMidiOut, // op is a midi output
   // op is gfx?
   //...
 } op_flag_t;
@@ -66,6 +67,9 @@ typedef enum {
   eOpSplit4,
   eOpDelay,
   eOpRoute,
+  eOpMidiOutNote,
+  eOpMidiOutCC,
+  eOpMonomeGridLevel,
   numOpClasses // dummy/count 
 } op_id_t;
 
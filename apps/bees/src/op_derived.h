@@ -26,7 +26,10 @@
 #include "ops/op_logic.h"
 #include "ops/op_metro.h"
 #include "ops/op_midi_note.h"
+#include "ops/op_midi_out_cc.h"
+#include "ops/op_midi_out_note.h"
 #include "ops/op_mod.h"
+#include "ops/op_monome_grid_level.h"
 #include "ops/op_monome_grid_raw.h"
 #include "ops/op_mul.h"
 #include "ops/op_preset.h"
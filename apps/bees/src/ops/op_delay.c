@@ -99,7 +99,7 @@ void op_delay_in_time (op_delay_t* delay, const io_t v) {
   } else {
     delay->ms = v;
   }
-  delay->timer.ticks = op_to_int(delay->ms);
+  timers_set_custom_period_ms(&(delay->timer), op_to_int(delay->ms));
 }
 
 
@@ -161,7 +161,7 @@ static inline void op_delay_set_timer(op_delay_t* delay) {
   //  timer_add(&(delay->timer), op_to_int(delay->period), &op_delay_callback, (void*)delay);
   /* timer_add(&(delay->timer), op_to_int(delay->period), &app_custom_event_callback, delay); */
 
-  timers_set_custom(&(delay->timer), op_to_int(delay->ms), &(delay->op_poll) );
+  timers_set_custom_ms(&(delay->timer), op_to_int(delay->ms), &(delay->op_poll), 0 );
   
   //  print_dbg("\r\n op_delay add timer, return value: ");
   //  print_dbg(ret ? "1" : "0");
@@ -75,14 +75,8 @@ static void op_history_in_in(op_history_t* history, const io_t v) {
   avg = avg / 8;
 
   net_activate(history->outs[0], avg, history);
-  net_activate(history->outs[1], history->val[0], history);
-  net_activate(history->outs[2], history->val[1], history);
-  net_activate(history->outs[3], history->val[2], history);
-  net_activate(history->outs[4], history->val[3], history);
-  net_activate(history->outs[5], history->val[4], history);
-  net_activate(history->outs[6], history->val[5], history);
-  net_activate(history->outs[7], history->val[6], history);
-  net_activate(history->outs[8], history->val[7], history);
+  // taps are in output order
+  net_activate_outs(&(history->outs[1]), history->val, 8, history);
 }
 
 
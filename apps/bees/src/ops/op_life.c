@@ -19,7 +19,7 @@ static void op_life_in_focus(op_life_t* life, const io_t v);
 static void op_life_output(op_life_t* life);
 
 // life
-static void life_change(u8,u8);
+static void life_change(op_life_t* life, u8 x, u8 y);
 static void life_init(void);
 static u8 neighbors(u8,u8,u16);
 
@@ -61,6 +61,9 @@ void op_life_init(void* mem) {
   //--- monome
   life->monome.handler = (monome_handler_t)&op_life_handler;
   life->monome.op = life;
+  life->monome.type = eDeviceGrid;
+  life->monome.dev = MONOME_NO_DEVICE;
+  life->monome.next = NULL;
 
   life->super.numInputs = 9;
   life->super.numOutputs = 3;
@@ -128,7 +131,6 @@ static void op_life_in_focus(op_life_t* op, const io_t v) {
 static void op_life_in_next(op_life_t* life, const io_t v) {
   if(v!=0) {
     u8 i, x, y, count;
-    u8 *p = monomeLedBuffer;
 
     for(x=0;x<life->xsize;x++)
     {
@@ -138,12 +140,12 @@ static void op_life_in_next(op_life_t* life, const io_t v) {
         if(lifenext[i]==1)
         {
           lifenow[i]=1;
-          p[i]=1;
+          monome_led_set(life->monome.dev, x, y, 1);
         }
         else if(lifenext[i]==-1)
         {
           lifenow[i]=0;
-          p[i]=0;
+          monome_led_set(life->monome.dev, x, y, 0);
         }
         lifenext[i]=0;
       }
@@ -163,12 +165,6 @@ static void op_life_in_next(op_life_t* life, const io_t v) {
       } 
     } 
 
-    // FIXME: OPTIMIZE
-    monome_set_quadrant_flag(0);
-
-    if(life->xsize>8) monome_set_quadrant_flag(1);
-    if(life->ysize>8) { monome_set_quadrant_flag(2); monome_set_quadrant_flag(3); }
-
     op_life_output(life);
   }
 }
@@ -200,14 +196,12 @@ static void op_life_in_y(op_life_t* life, const io_t v) {
 }
 
 static void op_life_in_set(op_life_t* life, const io_t v) {
-  u8 *p = monomeLedBuffer;
   u8 i = life->x+(life->y<<4);
 
   if(v == 0) lifenow[i] = 0;
   else lifenow[i] = 1;
 
-  p[i]=lifenow[i];
-  monome_calc_quadrant_flag(life->x, life->y);
+  monome_led_set(life->monome.dev, life->x, life->y, lifenow[i]);
 
   op_life_output(life);
 }
@@ -228,7 +222,7 @@ static void op_life_handler(op_monome_t* op_monome, u32 edata) {
 
   monome_grid_key_parse_event_data(edata, &x, &y, &z);
 
-  if(z) life_change(x,y);
+  if(z) life_change((op_life_t*)(op_monome->op), x, y);
 }
 
 
@@ -294,12 +288,10 @@ static void life_init(void) {
   }
 }
 
-static void life_change(u8 x,u8 y) {
-  u8 *p = monomeLedBuffer;
+static void life_change(op_life_t* life, u8 x, u8 y) {
   u8 i = x+(y<<4);
   lifenow[i] ^= 1;
-  p[i]=lifenow[i];
-  monome_calc_quadrant_flag(x, y);
+  monome_led_set(life->monome.dev, x, y, lifenow[i]);
 }
 
 static u8 neighbors(u8 x, u8 y, u16 s)
@@ -121,7 +121,7 @@ void op_metro_in_period (op_metro_t* metro, const io_t v) {
   } else {
     metro->period = v;
   }
-  metro->timer.ticks = op_to_int(metro->period);
+  timers_set_custom_period_ms(&(metro->timer), op_to_int(metro->period));
 }
 
 
@@ -190,7 +190,7 @@ static inline void op_metro_set_timer(op_metro_t* metro) {
   //  timer_add(&(metro->timer), op_to_int(metro->period), &op_metro_callback, (void*)metro);
   /* timer_add(&(metro->timer), op_to_int(metro->period), &app_custom_event_callback, metro); */
 
-  timers_set_custom(&(metro->timer), op_to_int(metro->period), &(metro->op_poll) );
+  timers_set_custom_ms(&(metro->timer), op_to_int(metro->period), &(metro->op_poll), 1 );
   
   //  print_dbg("\r\n op_metro add timer, return value: ");
   //  print_dbg(ret ? "1" : "0");
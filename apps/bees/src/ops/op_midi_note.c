@@ -51,6 +51,9 @@ void op_midi_note_init(void* mem) {
   //--- midi
   op->midi.handler = (midi_handler_t)&op_midi_note_handler;
   op->midi.sub = op;
+  op->midi.msgMask = NET_MIDI_NOTE_ON | NET_MIDI_NOTE_OFF;
+  op->midi.sysMask = 0;
+  op->midi.chan = -1;
 
   // superclass state
 
@@ -74,14 +77,13 @@ void op_midi_note_init(void* mem) {
   op->chan = -1;
   op->chanIo = OP_NEG_ONE;
 
-  // FIXME: should sanity-check that the op isn't already in the dang list
-  net_midi_list_push(&(op->midi));
+  net_midi_add(&(op->midi));
 }
 
 // de-init
 void op_midi_note_deinit(void* op) {
-  // remove from list
-  net_midi_list_remove((op_midi_t*)op);
+  // remove from routing table
+  net_midi_remove(&(((op_midi_note_t*)op)->midi));
 }
 
 //-------------------------------------------------
@@ -100,66 +102,26 @@ static void op_midi_note_in_chan(op_midi_note_t* op, const io_t v) {
   if(op->chan > 15) { op->chan = 15; }
   print_dbg(" , channel: ");
   print_dbg_hex((u32)(op->chan));
+  op->midi.chan = op->chan;
+  net_midi_update(&(op->midi));
 }
 
 
 static void op_midi_note_handler(op_midi_t* op_midi, u32 data) {
-  static u8 com;
-  static u8 ch, num, vel;
+  u8 num, vel;
   op_midi_note_t* op = (op_midi_note_t*)(op_midi->sub);
 
-  // check status byte  
-  com = (data & 0xf0000000) >> 28; 
-  if (com == 0x9) {
-    if(op->chan < 0) {
-      num = (data & 0xff0000) >> 16;
-      vel = (data & 0xff00) >> 8;
-      net_activate(op->outs[0], op_from_int(num), op);
-      net_activate(op->outs[1], op_from_int(vel), op);
-    } else {
-      // note on
-      ch = (data & 0x0f000000) >> 24;
-      /* print_dbg("\r\n midi got channel: "); */
-      /* print_dbg_hex((u32)ch); */
-      if(ch == op->chan) {
-	// matches our channel, so perform it
-	num = (data & 0xff0000) >> 16;
-	vel = (data & 0xff00) >> 8;
-	net_activate(op->outs[0], op_from_int(num), op);
-	net_activate(op->outs[1], op_from_int(vel), op);
-
-
-      print_dbg("\r\n op_midi note on ; num: ");
-      print_dbg_ulong(num);
-      print_dbg(" ; vel: ");
-      print_dbg_ulong(vel);
-
-      }
-    }
-  } else if (com == 0x80) {
+  // net_midi only sends note on/off on our channel
+  num = (data & 0xff0000) >> 16;
+  vel = (data & 0xff00) >> 8;
+  if((data & 0xf0000000) == 0x80000000) {
     // note off
-    if(op->chan == -1) {
-      num = (data & 0xff0000) >> 16;
-      vel = (data & 0xff00) >> 8;
-      net_activate(op->outs[0], op_from_int(num), op);
-      net_activate(op->outs[1], op_from_int(vel), op);
-
-      print_dbg("\r\n op_midi note off ; num: ");
-      print_dbg_ulong(num);
-
-    } else {
-      ch = (data & 0x0f000000) >> 24;
-      if(ch == op->chan) {
-	// matches our channel, so perform it
-	num = (data & 0xff0000) >> 16;
-	vel = (data & 0xff00) >> 8;
-	net_activate(op->outs[0], op_from_int(num), op);
-	// FIXME: should noteoff be a separate off, retain release velocity?
-	/// or, a 3rd output for on/off ?? hm
-	net_activate(op->outs[1], 0, op);
-      }
-    }
+    // FIXME: should noteoff be a separate off, retain release velocity?
+    /// or, a 3rd output for on/off ?? hm
+    vel = 0;
   }
+  net_activate(op->outs[0], op_from_int(num), op);
+  net_activate(op->outs[1], op_from_int(vel), op);
 }
 
 
@@ -183,5 +145,7 @@ u8* op_midi_note_pickle(op_midi_note_t* mnote, u8* dst) {
 const u8* op_midi_note_unpickle(op_midi_note_t* mnote, const u8* src) {
   src = unpickle_io(src, (u32*)&(mnote->chanIo));
   mnote->chan = op_to_int(mnote->chanIo);
+  mnote->midi.chan = mnote->chan;
+  net_midi_update(&(mnote->midi));
   return src;
 }
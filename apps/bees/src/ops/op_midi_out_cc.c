@@ -0,0 +1,134 @@
+// asf
+#include "print_funcs.h"
+// avr32
+#include "midi.h"
+// bees
+#include "net_protected.h"
+#include "op_midi_out_cc.h"
+
+//-------------------------------------------------
+//----- static variables
+
+//---- descriptor strings
+static const char* op_midi_out_cc_instring = "CHAN    NUM     VAL     ";
+static const char* op_midi_out_cc_outstring = "";
+static const char* op_midi_out_cc_opstring = "MOUTCC";
+
+//-------------------------------------------------
+//----- static function declaration
+
+//---- input functions
+
+//// network inputs: 
+static void op_midi_out_cc_inc_fn(op_midi_out_cc_t* op, const s16 idx, const io_t inc);
+static void op_midi_out_cc_in_chan(op_midi_out_cc_t* op, const io_t val);
+static void op_midi_out_cc_in_num(op_midi_out_cc_t* op, const io_t val);
+static void op_midi_out_cc_in_val(op_midi_out_cc_t* op, const io_t val);
+
+// pickles
+static u8* op_midi_out_cc_pickle(op_midi_out_cc_t* op, u8* dst);
+static const u8* op_midi_out_cc_unpickle(op_midi_out_cc_t* op, const u8* src);
+
+// input func pointer array
+static op_in_fn op_midi_out_cc_in_fn[3] = {
+  (op_in_fn)&op_midi_out_cc_in_chan,
+  (op_in_fn)&op_midi_out_cc_in_num,
+  (op_in_fn)&op_midi_out_cc_in_val,
+};
+
+// clamp to a 7-bit data value
+static inline io_t op_midi_out_cc_data(io_t v) {
+  if(v < 0) { return 0; }
+  if(v > 127) { return 127; }
+  return v;
+}
+
+//-------------------------------------------------
+//----- extern function definition
+void op_midi_out_cc_init(void* mem) {
+  op_midi_out_cc_t* op = (op_midi_out_cc_t*)mem;
+
+  // superclass functions
+  op->super.inc_fn = (op_inc_fn)op_midi_out_cc_inc_fn;
+  op->super.in_fn = op_midi_out_cc_in_fn;
+  op->super.pickle = (op_pickle_fn) (&op_midi_out_cc_pickle);
+  op->super.unpickle = (op_unpickle_fn) (&op_midi_out_cc_unpickle);
+
+  // superclass state
+  op->super.type = eOpMidiOutCC;
+  op->super.flags |= (1 << eOpFlagMidiOut);
+
+  op->super.numInputs = 3;
+  op->super.numOutputs = 0;
+
+  op->super.in_val = op->in_val;
+
+  op->super.opString = op_midi_out_cc_opstring;
+  op->super.inString = op_midi_out_cc_instring;
+  op->super.outString = op_midi_out_cc_outstring;
+
+  op->in_val[0] = &(op->chan);
+  op->in_val[1] = &(op->num);
+  op->in_val[2] = &(op->val);
+
+  op->chan = 0;
+  op->num = 1;
+  op->val = 0;
+}
+
+//-------------------------------------------------
+//----- static function definition
+
+//--- network input functions
+static void op_midi_out_cc_in_chan(op_midi_out_cc_t* op, const io_t v) {
+  if(v < 0) {
+    op->chan = 0;
+  } else if(v > 15) {
+    op->chan = 15;
+  } else {
+    op->chan = v;
+  }
+}
+
+static void op_midi_out_cc_in_num(op_midi_out_cc_t* op, const io_t v) {
+  op->num = op_midi_out_cc_data(v);
+}
+
+static void op_midi_out_cc_in_val(op_midi_out_cc_t* op, const io_t v) {
+  op->val = op_midi_out_cc_data(v);
+  midi_send(0xb0 | (u8)(op->chan), (u8)(op->num), (u8)(op->val));
+}
+
+/// increment param value from UI:
+static void op_midi_out_cc_inc_fn(op_midi_out_cc_t* op, const s16 idx, const io_t inc) {
+  io_t val;
+  switch(idx) {
+  case 0: // channel
+    val = op_sadd(op->chan, inc); 
+    op_midi_out_cc_in_chan(op, val);
+    break;
+  case 1: // controller number
+    val = op_sadd(op->num, inc); 
+    op_midi_out_cc_in_num(op, val);
+    break;
+  case 2: // value
+    val = op_sadd(op->val, inc); 
+    op_midi_out_cc_in_val(op, val);
+    break;
+  }
+}
+
+// pickle / unpickle
+static u8* op_midi_out_cc_pickle(op_midi_out_cc_t* op, u8* dst) {
+  dst = pickle_io(op->chan, dst);
+  dst = pickle_io(op->num, dst);
+  dst = pickle_io(op->val, dst);
+  return dst;
+}
+
+static const u8* op_midi_out_cc_unpickle(op_midi_out_cc_t* op, const u8* src) {
+  src = unpickle_io(src, (u32*)&(op->chan));
+  src = unpickle_io(src, (u32*)&(op->num));
+  src = unpickle_io(src, (u32*)&(op->val));
+  return src;
+}
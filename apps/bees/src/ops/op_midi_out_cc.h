@@ -0,0 +1,25 @@
+#ifndef _ALEPH_BEES_OP_MIDI_OUT_CC_H_
+#define _ALEPH_BEES_OP_MIDI_OUT_CC_H_
+
+#include "op.h"
+#include "op_math.h"
+#include "types.h"
+
+//--- op_midi_out_cc_t : send continuous controller values to the midi device.
+// a value is sent when VAL is set.
+// the driver only sends the latest value of each controller per refresh.
+
+typedef struct op_midi_out_cc_struct {
+  // operator base class
+  op_t super;
+  // inputs: channel, controller number, value
+  volatile io_t* in_val[3];
+  volatile io_t chan;
+  volatile io_t num;
+  volatile io_t val;
+} op_midi_out_cc_t;
+
+// init
+void op_midi_out_cc_init(void* op);
+
+#endif // h guard
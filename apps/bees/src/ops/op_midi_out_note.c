@@ -0,0 +1,138 @@
+// asf
+#include "print_funcs.h"
+// avr32
+#include "midi.h"
+// bees
+#include "net_protected.h"
+#include "op_midi_out_note.h"
+
+//-------------------------------------------------
+//----- static variables
+
+//---- descriptor strings
+static const char* op_midi_out_note_instring = "CHAN    NUM     VEL     ";
+static const char* op_midi_out_note_outstring = "";
+static const char* op_midi_out_note_opstring = "MOUTNOTE";
+
+//-------------------------------------------------
+//----- static function declaration
+
+//---- input functions
+
+//// network inputs: 
+static void op_midi_out_note_inc_fn(op_midi_out_note_t* op, const s16 idx, const io_t inc);
+static void op_midi_out_note_in_chan(op_midi_out_note_t* op, const io_t val);
+static void op_midi_out_note_in_num(op_midi_out_note_t* op, const io_t val);
+static void op_midi_out_note_in_vel(op_midi_out_note_t* op, const io_t val);
+
+// pickles
+static u8* op_midi_out_note_pickle(op_midi_out_note_t* op, u8* dst);
+static const u8* op_midi_out_note_unpickle(op_midi_out_note_t* op, const u8* src);
+
+// input func pointer array
+static op_in_fn op_midi_out_note_in_fn[3] = {
+  (op_in_fn)&op_midi_out_note_in_chan,
+  (op_in_fn)&op_midi_out_note_in_num,
+  (op_in_fn)&op_midi_out_note_in_vel,
+};
+
+// clamp to a 7-bit data value
+static inline io_t op_midi_out_note_data(io_t v) {
+  if(v < 0) { return 0; }
+  if(v > 127) { return 127; }
+  return v;
+}
+
+//-------------------------------------------------
+//----- extern function definition
+void op_midi_out_note_init(void* mem) {
+  op_midi_out_note_t* op = (op_midi_out_note_t*)mem;
+
+  // superclass functions
+  op->super.inc_fn = (op_inc_fn)op_midi_out_note_inc_fn;
+  op->super.in_fn = op_midi_out_note_in_fn;
+  op->super.pickle = (op_pickle_fn) (&op_midi_out_note_pickle);
+  op->super.unpickle = (op_unpickle_fn) (&op_midi_out_note_unpickle);
+
+  // superclass state
+  op->super.type = eOpMidiOutNote;
+  op->super.flags |= (1 << eOpFlagMidiOut);
+
+  op->super.numInputs = 3;
+  op->super.numOutputs = 0;
+
+  op->super.in_val = op->in_val;
+
+  op->super.opString = op_midi_out_note_opstring;
+  op->super.inString = op_midi_out_note_instring;
+  op->super.outString = op_midi_out_note_outstring;
+
+  op->in_val[0] = &(op->chan);
+  op->in_val[1] = &(op->num);
+  op->in_val[2] = &(op->vel);
+
+  op->chan = 0;
+  op->num = 60;
+  op->vel = 100;
+}
+
+//-------------------------------------------------
+//----- static function definition
+
+//--- network input functions
+static void op_midi_out_note_in_chan(op_midi_out_note_t* op, const io_t v) {
+  if(v < 0) {
+    op->chan = 0;
+  } else if(v > 15) {
+    op->chan = 15;
+  } else {
+    op->chan = v;
+  }
+}
+
+static void op_midi_out_note_in_num(op_midi_out_note_t* op, const io_t v) {
+  op->num = op_midi_out_note_data(v);
+  if(op->vel > 0) {
+    midi_send(0x90 | (u8)(op->chan), (u8)(op->num), (u8)(op->vel));
+  } else {
+    midi_send(0x80 | (u8)(op->chan), (u8)(op->num), 0);
+  }
+}
+
+static void op_midi_out_note_in_vel(op_midi_out_note_t* op, const io_t v) {
+  op->vel = op_midi_out_note_data(v);
+}
+
+/// increment param value from UI:
+static void op_midi_out_note_inc_fn(op_midi_out_note_t* op, const s16 idx, const io_t inc) {
+  io_t val;
+  switch(idx) {
+  case 0: // channel
+    val = op_sadd(op->chan, inc); 
+    op_midi_out_note_in_chan(op, val);
+    break;
+  case 1: // note number
+    val = op_sadd(op->num, inc); 
+    op_midi_out_note_in_num(op, val);
+    break;
+  case 2: // velocity
+    val = op_sadd(op->vel, inc); 
+    op_midi_out_note_in_vel(op, val);
+    break;
+  }
+}
+
+// pickle / unpickle
+static u8* op_midi_out_note_pickle(op_midi_out_note_t* op, u8* dst) {
+  dst = pickle_io(op->chan, dst);
+  dst = pickle_io(op->num, dst);
+  dst = pickle_io(op->vel, dst);
+  return dst;
+}
+
+static const u8* op_midi_out_note_unpickle(op_midi_out_note_t* op, const u8* src) {
+  src = unpickle_io(src, (u32*)&(op->chan));
+  src = unpickle_io(src, (u32*)&(op->num));
+  src = unpickle_io(src, (u32*)&(op->vel));
+  return src;
+}
@@ -0,0 +1,25 @@
+#ifndef _ALEPH_BEES_OP_MIDI_OUT_NOTE_H_
+#define _ALEPH_BEES_OP_MIDI_OUT_NOTE_H_
+
+#include "op.h"
+#include "op_math.h"
+#include "types.h"
+
+//--- op_midi_out_note_t : send note on/off to the midi device.
+// a note is sent when NUM is set, with the last velocity;
+// zero velocity sends note off.
+
+typedef struct op_midi_out_note_struct {
+  // operator base class
+  op_t super;
+  // inputs: channel, note number, velocity
+  volatile io_t* in_val[3];
+  volatile io_t chan;
+  volatile io_t num;
+  volatile io_t vel;
+} op_midi_out_note_t;
+
+// init
+void op_midi_out_note_init(void* op);
+
+#endif // h guard
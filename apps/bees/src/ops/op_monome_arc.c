@@ -27,6 +27,8 @@ static const u8* op_marc_unpickle(op_marc_t* enc, const u8* src);
 
 /// monome event handler
 static void op_marc_handler(op_monome_t* op_monome, u32 data);
+// send position and value from the outputs
+static void op_marc_output(op_marc_t* op, u8 x, u8 y, u8 val);
 
 // input func pointer array
 static op_in_fn op_marc_in_fn[1] = {
@@ -49,6 +51,9 @@ void op_marc_init(void* mem) {
   //--- monome
   op->monome.handler = (monome_handler_t)&op_marc_handler;
   op->monome.op = op;
+  op->monome.type = eDeviceArc;
+  op->monome.dev = MONOME_NO_DEVICE;
+  op->monome.next = NULL;
 
   // superclass state
 
@@ -104,8 +109,18 @@ static void op_marc_in_mono(op_marc_t* op, const io_t v) {
   op->mono  = (v > 0) ? OP_ONE : 0;
 }
 
+static void op_marc_output(op_marc_t* op, u8 x, u8 y, u8 val) {
+  io_t v[3];
+  // FIXME: should add macros in op_math.h for io_t conversion
+  v[0] = op_from_int(x);
+  v[1] = op_from_int(y);
+  v[2] = op_from_int(val);
+  net_activate_outs(op->outs, v, 3, op);
+}
+
 static void op_marc_handler(op_monome_t* op_monome, u32 edata) {
   static u8 x, y, z;
+  static u8 lx, ly;
   static u32 pos;
   static u8 val;
 
@@ -124,56 +139,36 @@ static void op_marc_handler(op_monome_t* op_monome, u32 edata) {
   // flat position into led buffer
   pos = monome_xy_idx(x, y);
 
+  // led functions set the refresh flags for their quadrant
   if(op->mono) {
     if(op->tog > 0) { // mono, toggle
       if(z > 0) {        // ignore lift
-	val = ( monomeLedBuffer[pos] == 0 );
-	monomeLedBuffer[pos] = val;
+	val = ( monome_led_get(op->monome.dev, x, y) == 0 );
 	if(pos != op->lastPos) {
-	  monomeLedBuffer[op->lastPos] = 0;
+	  monome_idx_xy(op->lastPos, &lx, &ly);
+	  monome_led_set(op->monome.dev, lx, ly, 0);
 	}
-	// FIXME: should add macros in op_math.h for io_t conversion
-	net_activate(op->outs[0], op_from_int(x), op);
-	net_activate(op->outs[1], op_from_int(y), op);
-	net_activate(op->outs[2], op_from_int(val), op);
-	// refresh flag for current quadrant
-	monome_calc_quadrant_flag(x, y);
-	// refresh flag for previous quadrant
-	monome_idx_xy(op->lastPos, &x, &y);
-	monome_calc_quadrant_flag(x, y);
+	monome_led_set(op->monome.dev, x, y, val);
+	op_marc_output(op, x, y, val);
       }
     } else { // mono, momentary
       val = z;
-      monomeLedBuffer[pos] =  val;
-      monomeLedBuffer[op->lastPos] = 0;
-      net_activate(op->outs[0], op_from_int(x), op);
-      net_activate(op->outs[1], op_from_int(y), op);
-      net_activate(op->outs[2], op_from_int(val), op);
-      // refresh flag for current quadrant
-      monome_calc_quadrant_flag(x, y);
-      // refresh flag for previous quadrant
-      monome_idx_xy(op->lastPos, &x, &y);
-      monome_calc_quadrant_flag(x, y);  
+      monome_idx_xy(op->lastPos, &lx, &ly);
+      monome_led_set(op->monome.dev, lx, ly, 0);
+      monome_led_set(op->monome.dev, x, y, val);
+      op_marc_output(op, x, y, val);
     }
   } else {
     if(op->tog > 0) { // poly, toggle
       if(z > 0) {      /// ignore lift
-	val = ( monomeLedBuffer[pos] == 0 );
-	monomeLedBuffer[pos] = val;
-	net_activate(op->outs[0], op_from_int(x), op);
-	net_activate(op->outs[1], op_from_int(y), op);
-	net_activate(op->outs[2], op_from_int(val), op);
-	// refresh flag for current quadrant
-	monome_calc_quadrant_flag(x, y);
+	val = ( monome_led_get(op->monome.dev, x, y) == 0 );
+	monome_led_set(op->monome.dev, x, y, val);
+	op_marc_output(op, x, y, val);
       }
     } else {   // poly, momentary
       val = z;
-      monomeLedBuffer[pos] = val;
-      net_activate(op->outs[0], op_from_int(x), op);
-      net_activate(op->outs[1], op_from_int(y), op);
-      net_activate(op->outs[2], op_from_int(val), op);
-      // refresh flag for current quadrant
-      monome_calc_quadrant_flag(x, y);
+      monome_led_set(op->monome.dev, x, y, val);
+      op_marc_output(op, x, y, val);
     }
   }
   op->lastPos = pos;
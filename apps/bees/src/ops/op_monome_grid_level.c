@@ -0,0 +1,196 @@
+// asf
+#include "print_funcs.h"
+// bees
+#include "net_protected.h"
+#include "op_monome_grid_level.h"
+
+//-------------------------------------------------
+//----- static variables
+
+//---- descriptor strings
+static const char* op_mgrid_level_instring = "FOCUS   COL     ROW     LEVEL   INTENS  ";
+static const char* op_mgrid_level_outstring = "COL     ROW     VAL     ";
+static const char* op_mgrid_level_opstring = "GRIDLVL";
+
+//-------------------------------------------------
+//----- static function declaration
+
+//---- input functions
+
+//// network inputs:
+static void op_mgrid_level_inc_fn(op_mgrid_level_t* op, const s16 idx, const io_t inc);
+static void op_mgrid_level_in_focus(op_mgrid_level_t* op, const io_t val);
+static void op_mgrid_level_in_col(op_mgrid_level_t* op, const io_t val);
+static void op_mgrid_level_in_row(op_mgrid_level_t* op, const io_t val);
+static void op_mgrid_level_in_level(op_mgrid_level_t* op, const io_t val);
+static void op_mgrid_level_in_intens(op_mgrid_level_t* op, const io_t val);
+
+// pickles
+static u8* op_mgrid_level_pickle(op_mgrid_level_t* op, u8* dst);
+static const u8* op_mgrid_level_unpickle(op_mgrid_level_t* op, const u8* src);
+
+/// monome event handler
+static void op_mgrid_level_handler(op_monome_t* op_monome, u32 data);
+
+// input func pointer array
+static op_in_fn op_mgrid_level_in_fn[5] = {
+  (op_in_fn)&op_mgrid_level_in_focus,
+  (op_in_fn)&op_mgrid_level_in_col,
+  (op_in_fn)&op_mgrid_level_in_row,
+  (op_in_fn)&op_mgrid_level_in_level,
+  (op_in_fn)&op_mgrid_level_in_intens,
+};
+
+// clamp to an led level
+static inline io_t op_mgrid_level_clamp(io_t v) {
+  if(v < 0) { return 0; }
+  if(v > MONOME_LED_MAX_LEVEL) { return MONOME_LED_MAX_LEVEL; }
+  return v;
+}
+
+// clamp to a grid coordinate
+static inline io_t op_mgrid_level_coord(io_t v) {
+  if(v < 0) { return 0; }
+  if(v > 15) { return 15; }
+  return v;
+}
+
+//-------------------------------------------------
+//----- extern function definition
+void op_mgrid_level_init(void* mem) {
+  op_mgrid_level_t* op = (op_mgrid_level_t*)mem;
+
+  // superclass functions
+  //--- op
+  op->super.inc_fn = (op_inc_fn)op_mgrid_level_inc_fn;
+  op->super.in_fn = op_mgrid_level_in_fn;
+  op->super.pickle = (op_pickle_fn) (&op_mgrid_level_pickle);
+  op->super.unpickle = (op_unpickle_fn) (&op_mgrid_level_unpickle);
+
+  //--- monome
+  op->monome.handler = (monome_handler_t)&op_mgrid_level_handler;
+  op->monome.op = op;
+  op->monome.type = eDeviceGrid;
+  op->monome.dev = MONOME_NO_DEVICE;
+  op->monome.next = NULL;
+
+  // superclass state
+  op->super.type = eOpMonomeGridLevel;
+  op->super.flags |= (1 << eOpFlagMonomeGrid);
+
+  op->super.numInputs = 5;
+  op->super.numOutputs = 3;
+
+  op->super.in_val = op->in_val;
+  op->super.out = op->outs;
+
+  op->super.opString = op_mgrid_level_opstring;
+  op->super.inString = op_mgrid_level_instring;
+  op->super.outString = op_mgrid_level_outstring;
+
+  op->in_val[0] = &(op->focus);
+  op->in_val[1] = &(op->col);
+  op->in_val[2] = &(op->row);
+  op->in_val[3] = &(op->level);
+  op->in_val[4] = &(op->intens);
+  op->outs[0] = -1;
+  op->outs[1] = -1;
+  op->outs[2] = -1;
+
+  op->col = 0;
+  op->row = 0;
+  op->level = 0;
+  op->intens = MONOME_LED_MAX_LEVEL;
+  op->focus = OP_ONE;
+  net_monome_set_focus(&(op->monome), 1);
+}
+
+// de-init
+void op_mgrid_level_deinit(void* op) {
+  // release focus
+  net_monome_set_focus(&(((op_mgrid_level_t*)op)->monome), 0);
+}
+
+//-------------------------------------------------
+//----- static function definition
+
+//--- network input functions
+static void op_mgrid_level_in_focus(op_mgrid_level_t* op, const io_t v) {
+  op->focus = (v > 0) ? OP_ONE : 0;
+  net_monome_set_focus( &(op->monome), op->focus > 0);
+}
+
+static void op_mgrid_level_in_col(op_mgrid_level_t* op, const io_t v) {
+  op->col = op_mgrid_level_coord(v);
+}
+
+static void op_mgrid_level_in_row(op_mgrid_level_t* op, const io_t v) {
+  op->row = op_mgrid_level_coord(v);
+}
+
+// set the level of the led at the current position
+static void op_mgrid_level_in_level(op_mgrid_level_t* op, const io_t v) {
+  op->level = op_mgrid_level_clamp(v);
+  // sets the refresh flag for its quadrant; ignored without a device
+  monome_led_level_set(op->monome.dev, (u8)(op->col), (u8)(op->row), (u8)(op->level));
+}
+
+// set the brightness of the whole device
+static void op_mgrid_level_in_intens(op_mgrid_level_t* op, const io_t v) {
+  op->intens = op_mgrid_level_clamp(v);
+  monome_set_intense(op->monome.dev, (u8)(op->intens));
+}
+
+static void op_mgrid_level_handler(op_monome_t* op_monome, u32 edata) {
+  u8 x, y, z;
+  io_t v[3];
+  op_mgrid_level_t* op = (op_mgrid_level_t*)(op_monome->op);
+
+  monome_grid_key_parse_event_data(edata, &x, &y, &z);
+  v[0] = op_from_int(x);
+  v[1] = op_from_int(y);
+  v[2] = op_from_int(z);
+  net_activate_outs(op->outs, v, 3, op);
+}
+
+/// increment param value from UI:
+static void op_mgrid_level_inc_fn(op_mgrid_level_t* op, const s16 idx, const io_t inc) {
+  switch(idx) {
+  case 0: // focus
+    op_mgrid_level_in_focus(op, inc);
+    break;
+  case 1: // column
+    op_mgrid_level_in_col(op, op_sadd(op->col, inc));
+    break;
+  case 2: // row
+    op_mgrid_level_in_row(op, op_sadd(op->row, inc));
+    break;
+  case 3: // level
+    op_mgrid_level_in_level(op, op_sadd(op->level, inc));
+    break;
+  case 4: // intensity
+    op_mgrid_level_in_intens(op, op_sadd(op->intens, inc));
+    break;
+  }
+}
+
+// pickle / unpickle
+static u8* op_mgrid_level_pickle(op_mgrid_level_t* op, u8* dst) {
+  dst = pickle_io(op->focus, dst);
+  dst = pickle_io(op->col, dst);
+  dst = pickle_io(op->row, dst);
+  dst = pickle_io(op->level, dst);
+  dst = pickle_io(op->intens, dst);
+  return dst;
+}
+
+static const u8* op_mgrid_level_unpickle(op_mgrid_level_t* op, const u8* src) {
+  src = unpickle_io(src, (u32*)&(op->focus));
+  src = unpickle_io(src, (u32*)&(op->col));
+  src = unpickle_io(src, (u32*)&(op->row));
+  src = unpickle_io(src, (u32*)&(op->level));
+  src = unpickle_io(src, (u32*)&(op->intens));
+  net_monome_set_focus( &(op->monome), op->focus > 0);
+  monome_set_intense(op->monome.dev, (u8)(op->intens));
+  return src;
+}
@@ -0,0 +1,33 @@
+#ifndef _ALEPH_BEES_OP_MONOME_GRID_LEVEL_H_
+#define _ALEPH_BEES_OP_MONOME_GRID_LEVEL_H_
+
+#include "net_monome.h"
+#include "op.h"
+#include "op_math.h"
+#include "types.h"
+
+//--- op_mgrid_level_t : monome grid with 16-level leds.
+// LEVEL sets the led at (COL, ROW) to a brightness in [0, 15].
+// INTENS sets the brightness of the whole device in [0, 15].
+// keys are sent from the outputs, without lighting any leds.
+
+typedef struct op_mgrid_level_struct {
+  op_t super;
+  op_monome_t monome;
+  // inputs: focus, column, row, level, intensity
+  volatile io_t focus;
+  volatile io_t col;
+  volatile io_t row;
+  volatile io_t level;
+  volatile io_t intens;
+  volatile io_t* in_val[5];
+  // outputs: x, y, z
+  op_out_t outs[3];
+} op_mgrid_level_t;
+
+// init
+void op_mgrid_level_init(void* op);
+// de-init
+void op_mgrid_level_deinit(void* op);
+
+#endif // header guard
@@ -68,10 +68,7 @@ void op_split4_init(void* op) {
 // input state
 static void op_split4_in_val(op_split4_t* split4, const io_t v) {
   split4->val = v;
-  net_activate(split4->outs[0], split4->val, split4);
-  net_activate(split4->outs[1], split4->val, split4);
-  net_activate(split4->outs[2], split4->val, split4);
-  net_activate(split4->outs[3], split4->val, split4);
+  net_activate_outs_val(split4->outs, split4->val, 4, split4);
 }
 
 //===== UI input
@@ -6,9 +6,10 @@
 
 #ifdef ARCH_AVR32
 #include "print_funcs.h"
-#include "encoders.h"
 #endif
 
+#include "encoders.h"
+
 #include "pages.h"
 //#include "pages_protected.h"
 #include "net.h"
@@ -25,6 +26,8 @@
 #define ENC_THRESH_LISTSCROLL 4
 #define ENC_THRESH_FINE 0
 #define ENC_THRESH_COARSE 4
+// encoder acceleration, in 1/16ths of the full curve
+#define ENC_ACCEL_VALUE 16
 
 //--------------------------
 //--------- variables
@@ -34,6 +37,7 @@ page_t pages[NUM_PAGES] = {
   { .name = "INS",
     .select_fn = &select_ins, // select function
     .encSens = { 0, 0, ENC_THRESH_PAGESCROLL, ENC_THRESH_LISTSCROLL, }, // encoder sens 
+    .encAccel = { ENC_ACCEL_VALUE, 0, 0, 0, }, // encoder accel
   },
   { .name = "OUTS",
     .select_fn = &select_outs, // select function
@@ -134,6 +138,7 @@ void set_page(ePage n) {
     //// FIXME: use encoder map?
     //set_enc_thresh(encMap[i], curPage->encSens[i]);
     set_enc_thresh(i, curPage->encSens[i]);
+    set_enc_accel(i, curPage->encAccel[i]);
   }
   //  print_dbg("\r\n ...done setting page.");
 }
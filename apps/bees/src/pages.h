@@ -61,6 +61,8 @@ typedef struct page_struct {
   s8 cursor;
   // knob sensitivities for this page
   s8 encSens[4];
+  // knob acceleration for this page
+  u8 encAccel[4];
 } page_t;
 
 
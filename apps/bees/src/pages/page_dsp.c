@@ -147,6 +147,7 @@ static void show_foot(void) {
 
 // function keys
 void handle_key_0(s32 val) {
+  u8 loaded;
   // load module
   if(val == 0) { return; }
   if(check_key(0)) {
@@ -156,7 +157,14 @@ void handle_key_0(s32 val) {
     // disconnect parameters though
     net_disconnect_params();
 
-    files_load_dsp(*pageSelect);
+    loaded = files_load_dsp(*pageSelect);
+
+    if(bfin_halted()) {
+      // nothing is running, so don't wait for it
+      notify("load failed, DSP halted.");
+      show_foot();
+      return;
+    }
 
     bfin_wait_ready();
 
@@ -169,7 +177,11 @@ void handle_key_0(s32 val) {
     redraw_ins();
     redraw_dsp();
 
-    notify("finished loading.");
+    if(loaded) {
+      notify("finished loading.");
+    } else {
+      notify("load failed.");
+    }
   }
   show_foot();
 }
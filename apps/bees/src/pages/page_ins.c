@@ -475,13 +475,13 @@ void handle_key_3(s32 val) {
 }
 
 void handle_enc_0(s32 val) {
-  // change parameter value, accelerated
-  select_edit(scale_knob_value(val));
+  // change parameter value, accelerated by the encoder driver
+  select_edit(val);
 }
 
 void handle_enc_1(s32 val) {
   // change parameter value, unaccelerated
-  select_edit(scale_knob_value_small(val));
+  select_edit(val);
 }
 
 void handle_enc_2(s32 val) {
@@ -27,7 +27,7 @@ static scroll centerScroll;
 static s16* const pageSelect = &(pages[ePageOps].select);
 
 // const array of user-creatable operator types
-#define NUM_USER_OP_TYPES 27
+#define NUM_USER_OP_TYPES 30
 static const op_id_t userOpTypes[NUM_USER_OP_TYPES] = {
   eOpAccum,
   eOpAdd,
@@ -37,6 +37,7 @@ static const op_id_t userOpTypes[NUM_USER_OP_TYPES] = {
   eOpDiv,
   eOpGate,
   eOpMonomeGridRaw, // "grid"
+  eOpMonomeGridLevel, // "gridlvl"
   eOpHistory,
   eOpIs,
   eOpLife,
@@ -45,6 +46,8 @@ static const op_id_t userOpTypes[NUM_USER_OP_TYPES] = {
   eOpLogic,
   eOpMetro,
   eOpMidiNote,
+  eOpMidiOutCC,
+  eOpMidiOutNote,
   eOpMod,
   eOpMul,
   eOpRandom,
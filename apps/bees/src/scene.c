@@ -224,6 +224,13 @@ void scene_read_buf(void) {
 
   files_load_dsp_name(sceneData->desc.moduleName);
 
+  if(bfin_halted()) {
+    // nothing is running to report or take parameters
+    print_dbg("\r\n DSP load failed, aborting scene recall");
+    render_boot("DSP load failed!");
+    app_resume();
+    return;
+  }
 
   render_boot("waiting for module init");
   print_dbg("\r\n waiting for DSP init...");
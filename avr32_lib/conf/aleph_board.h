@@ -120,6 +120,9 @@
 #define AVR32_PDCA_CHANNEL_USED_TX  AVR32_PDCA_PID_SPI1_TX
 #define AVR32_PDCA_CHANNEL_SPI_RX   0 
 #define AVR32_PDCA_CHANNEL_SPI_TX   1 
+// ADC, on the same SPI
+#define AVR32_PDCA_CHANNEL_ADC_RX   2
+#define AVR32_PDCA_CHANNEL_ADC_TX   3
 
 //==============================================
 //==== GPIO
@@ -15,5 +15,10 @@
 #define APP_TC_CHANNEL         0
 #define APP_TC_IRQ             AVR32_TC_IRQ0
 #define APP_TC_IRQ_GROUP       AVR32_TC_IRQ_GROUP
+// compare value for the 1ms tick, with the TC clocked from fPBA / 128.
+// nominally fPBA / 128000, but the divisor is experimentally determined.
+// (needs FPBA_HZ from aleph_board.h)
+#define APP_TC_CAL_HZ          149707
+#define APP_TC_RC              (FPBA_HZ / APP_TC_CAL_HZ)
 
 #endif
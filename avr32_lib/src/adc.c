@@ -1,7 +1,27 @@
+/* adc.c
+   avr32
+   aleph
+
+   ad7923 scanning.
+
+   the part runs in sequencer mode, converting channels 0-3 in turn.
+   each poll starts a burst of (ADC_OVERSAMPLE * 4) + 1 conversions,
+   received into a ring of raw result words.
+   the part converts on each falling edge of its chip select,
+   so every word is its own PDCA transfer, with the chip deselected between them.
+   the next poll averages what has arrived per channel,
+   and posts an event only when a channel leaves its hysteresis band.
+
+   the ADC shares its SPI with the OLED and the SD card.
+   other users hold the bus with adc_bus_lock() / adc_bus_unlock(),
+   and no burst starts while it is held.
+*/
+
 //ASF
 #include "compiler.h"
 #include "delay.h"
 #include "interrupt.h"
+#include "pdca.h"
 #include "print_funcs.h"
 #include "spi.h"
 // aleph
@@ -25,63 +45,154 @@
 // command word to which we add the desired channel address for conversion
 #define AD7923_CMD_BASE ( AD7923_CTL_WRITE | AD7923_CTL_PM0 | AD7923_CTL_PM1 | AD7923_CTL_CODING)
 
+// sequence channels 0 through 3, repeating while DIN stays low
+#define AD7923_CMD_SEQ ( AD7923_CMD_BASE | AD7923_CTL_SEQ1 | AD7923_CTL_SEQ0 \
+			 | AD7923_CTL_ADD1 | AD7923_CTL_ADD0 )
+
+// result word: two leading zeros, channel address, 12 data bits
+#define AD7923_RES_ZERO_MASK 0xc000
+#define AD7923_RES_ADD_SHIFT 12
+#define AD7923_RES_DATA_MASK 0xfff
+
+// raw result ring, in words. must be a power of two
+#define ADC_RING_SIZE 256
+#define ADC_RING_MASK (ADC_RING_SIZE - 1)
+
+#if (ADC_OVERSAMPLE < 1) || (ADC_OVERSAMPLE > 16)
+#error "adc: ADC_OVERSAMPLE must be 1 to 16"
+#endif
+
+// burst: control word plus all oversampled conversions
+#define ADC_SCAN_LEN ( (ADC_OVERSAMPLE * ADC_NUM_CHANNELS) + 1 )
+
 // adc events
-static const etype adctypes[4] = { 
+static const etype adctypes[4] = {
   kEventAdc0 ,
   kEventAdc1 ,
   kEventAdc2 ,
   kEventAdc3 ,
 };
 
-// perform a conversion on all 4 channels
-static void adc_convert(U16 (*dst)[4]) {
-  U16 cmd, val;
+//-----------------------------
+//---- static variables
 
-  // data into AD7923 is a left-justified 12-bit value in a 16-bit word
-  // so, always lshift the command before sending
-  cmd = ( AD7923_CMD_BASE ) << 4;
-  spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
-  spi_write(ADC_SPI, cmd);
-  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
+// raw results, written by PDCA
+static volatile u16 adcRing[ADC_RING_SIZE];
+// write index, advanced when a burst completes
+static volatile u32 adcRingWr = 0;
+// read index, advanced by the poll
+static u32 adcRingRd = 0;
 
-  // get channel 0, setup channel 1
-  cmd = ( AD7923_CMD_BASE | AD7923_CTL_ADD0 ) << 4;
-  spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
-  spi_write(ADC_SPI, cmd);
-  spi_read(ADC_SPI, &val);
-  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
-  (*dst)[0] = val & 0xfff; 
+// words sent during a burst: sequence command, then DIN low
+static u16 adcTxWord[2];
+// index of the next word in the burst in flight
+static u32 adcScanPos = 0;
+// set while a burst holds the bus
+static volatile u8 adcScanBusy = 0;
+// count of other holders of the bus
+static volatile u8 adcBusHeld = 0;
 
-  // get channel 1, setup channel 2
-  cmd = ( AD7923_CMD_BASE | AD7923_CTL_ADD1 ) << 4;
-  spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
-  spi_write(ADC_SPI, cmd);
-  spi_read(ADC_SPI, &val);
-  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
-  (*dst)[1] = val & 0xfff;
+// last posted value per channel
+static u16 adcOut[ADC_NUM_CHANNELS] = { 0, 0, 0, 0 };
+// bitfield of channels still slewing toward their input.
+// all set at first, so the initial values are posted.
+static u8 adcMoving = 0xf;
 
-  // get channel 2, setup channel 3
-  cmd = ( AD7923_CMD_BASE | AD7923_CTL_ADD1 | AD7923_CTL_ADD0 ) << 4;
-  spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
-  spi_write(ADC_SPI, cmd);
-  spi_read(ADC_SPI, &val);
-  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
-  (*dst)[2] = val & 0xfff;
+//-----------------------------
+//---- static functions
 
-  // get channel 3, dummy write
-  cmd = ( AD7923_CMD_BASE ) << 4;
+// start the transfer of one word in the burst.
+// RX is loaded first, so no result is missed.
+// selecting the chip gives the falling edge that starts the conversion.
+static void adc_scan_word(void) {
+  pdca_load_channel(AVR32_PDCA_CHANNEL_ADC_RX,
+		    &(adcRing[(adcRingWr + adcScanPos) & ADC_RING_MASK]), 1);
   spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
-  spi_write(ADC_SPI, cmd);
-  spi_read(ADC_SPI, &val);
-  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
-  (*dst)[3] = val & 0xfff;
+  pdca_load_channel(AVR32_PDCA_CHANNEL_ADC_TX,
+		    &(adcTxWord[adcScanPos > 0 ? 1 : 0]), 1);
+}
+
+// start a burst, unless the bus is in use or the ring is full.
+// called from the poll timer.
+static void adc_scan_start(void) {
+  if(adcScanBusy || adcBusHeld) {
+    return;
+  }
+  // poll is behind; drop this burst rather than overwrite
+  if(((adcRingRd - adcRingWr - 1) & ADC_RING_MASK) < ADC_SCAN_LEN) {
+    return;
+  }
+
+  adcScanBusy = 1;
+  adcScanPos = 0;
+
+  // discard anything left by write-only transfers to other chips
+  (void)(ADC_SPI->rdr);
+
+  // channels idle until loaded
+  pdca_enable(AVR32_PDCA_CHANNEL_ADC_RX);
+  pdca_enable(AVR32_PDCA_CHANNEL_ADC_TX);
+  adc_scan_word();
+  // after loading, so an empty RX channel doesn't raise it at once
+  pdca_enable_interrupt_transfer_complete(AVR32_PDCA_CHANNEL_ADC_RX);
+}
+
+// move a channel toward its averaged input, and post if it changed
+static void adc_filter(u8 ch, u16 in) {
+  static event_t e;
+  s32 d = (s32)in - (s32)(adcOut[ch]);
+  const s32 h = ADC_HYSTERESIS;
+  const s32 s = ADC_SLEW;
+  u8 b = 1 << ch;
 
+  if(d == 0) {
+    adcMoving &= ~b;
+    return;
+  }
+  // inside the band around the last posted value
+  if( !(adcMoving & b) && (d <= h) && (d >= -h) ) {
+    return;
+  }
+  adcMoving |= b;
+  // limit the step
+  if(s > 0) {
+    if(d > s) { d = s; }
+    else if(d < -s) { d = -s; }
+  }
+  adcOut[ch] = (u16)((s32)(adcOut[ch]) + d);
+  if(adcOut[ch] == in) {
+    adcMoving &= ~b;
+  }
+  e.type = adctypes[ch];
+  e.data = (s16)(adcOut[ch]);
+  event_post(&e);
 }
 
+//-----------------------------
+//---- extern functions
+
 // setup ad7923
 void init_adc(void) {
   u16 cmd;
 
+  pdca_channel_options_t rxOptions = {
+    .addr = (void*)adcRing,
+    .size = 0,
+    .r_addr = NULL,
+    .r_size = 0,
+    .pid = AVR32_PDCA_CHANNEL_USED_RX,
+    .transfer_size = PDCA_TRANSFER_SIZE_HALF_WORD
+  };
+
+  pdca_channel_options_t txOptions = {
+    .addr = (void*)adcTxWord,
+    .size = 0,
+    .r_addr = NULL,
+    .r_size = 0,
+    .pid = AVR32_PDCA_CHANNEL_USED_TX,
+    .transfer_size = PDCA_TRANSFER_SIZE_HALF_WORD
+  };
+
   // at powerup, the part wants a dummy conversion with DIN high
   spi_selectChip(ADC_SPI, ADC_SPI_NPCS);
   spi_write(ADC_SPI, 0xffff);
@@ -89,45 +200,83 @@ void init_adc(void) {
 
   // wait for powerup time (5us in datasheet)
   delay_us(5);
-  
+
   // write base configuration
   cmd = AD7923_CMD_BASE << 4;
   spi_selectChip( ADC_SPI, ADC_SPI_NPCS );
   spi_write( ADC_SPI, cmd );
   spi_unselectChip( ADC_SPI, ADC_SPI_NPCS );
 
+  // data into AD7923 is a left-justified 12-bit value in a 16-bit word.
+  // each burst restarts the sequence, then holds DIN low to continue it.
+  adcTxWord[0] = AD7923_CMD_SEQ << 4;
+  adcTxWord[1] = 0;
+
+  pdca_init_channel(AVR32_PDCA_CHANNEL_ADC_RX, &rxOptions);
+  pdca_init_channel(AVR32_PDCA_CHANNEL_ADC_TX, &txOptions);
+}
+
+// end of each word in a burst, from the PDCA interrupt.
+// the chip is deselected after every word, so the next one starts a new conversion.
+// a burst returns ADC_SCAN_LEN results, each tagged with its channel:
+// the first is from the conversion set up by the previous burst,
+// then channels 0-3 in turn, ADC_OVERSAMPLE times.
+void adc_scan_done(void) {
+  spi_unselectChip(ADC_SPI, ADC_SPI_NPCS);
+  if(++adcScanPos < ADC_SCAN_LEN) {
+    adc_scan_word();
+    return;
+  }
+  pdca_disable_interrupt_transfer_complete(AVR32_PDCA_CHANNEL_ADC_RX);
+  pdca_disable(AVR32_PDCA_CHANNEL_ADC_TX);
+  pdca_disable(AVR32_PDCA_CHANNEL_ADC_RX);
+  adcRingWr = (adcRingWr + ADC_SCAN_LEN) & ADC_RING_MASK;
+  adcScanBusy = 0;
 }
 
-// perform conversion, check for changes, and post events
+// hold the ADC's SPI for another chip: wait for a burst in flight,
+// and keep new ones from starting until adc_bus_unlock().
+// call from the main loop only, before selecting the other chip.
+void adc_bus_lock(void) {
+  // raise the count first: a poll that runs after this sees it and doesn't start,
+  // and one that ran before has set the busy flag
+  ++adcBusHeld;
+  while(adcScanBusy) { ;; }
+}
+
+// release the ADC's SPI, after deselecting the other chip
+void adc_bus_unlock(void) {
+  if(adcBusHeld > 0) {
+    --adcBusHeld;
+  }
+}
+
+// average new results, filter, post events, and start the next burst
 void adc_poll(void) {
-  static u16 adcVal[4] = {0, 0, 0, 0};
-  static event_t e;
-  u8 i;
-
-  adc_convert(&adcVal);
-
-#if 0
-  for(i=0; i<4; i++) {        
-    // TODO:
-    /// probably want more filtering before posting events?? i dunno
-    //    if(adcVal[i] != adcOldVal[i]) {
-    /// this is a dirty way! but the two lower bits are pretty noisy.
-    valMask = adcVal[i] & 0xff8;
-    if( valMask != adcOldVal[i] ) {
-      adcOldVal[i] = valMask;
-      e.type = adctypes[i];
-      // use the data without the mask
-      e.data = (S16)(adcVal[i]);
-      event_post(&e);
+  u32 sum[ADC_NUM_CHANNELS] = { 0, 0, 0, 0 };
+  u16 num[ADC_NUM_CHANNELS] = { 0, 0, 0, 0 };
+  u32 wr = adcRingWr;
+  u16 w;
+  u8 ch;
+
+  while(adcRingRd != wr) {
+    w = adcRing[adcRingRd];
+    adcRingRd = (adcRingRd + 1) & ADC_RING_MASK;
+    // results are tagged with their channel, so order doesn't matter.
+    // a word without leading zeros wasn't driven by the part (shouldn't happen).
+    if(w & AD7923_RES_ZERO_MASK) {
+      continue;
     }
+    ch = (w >> AD7923_RES_ADD_SHIFT) & (ADC_NUM_CHANNELS - 1);
+    sum[ch] += w & AD7923_RES_DATA_MASK;
+    ++num[ch];
   }
-#else 
-  /// test with no filtering.. maybe this is fine
-  for(i=0; i<4; i++) {        
-    e.type = adctypes[i];
-    e.data = (S16)(adcVal[i]);
-    event_post(&e);
+
+  for(ch=0; ch<ADC_NUM_CHANNELS; ch++) {
+    if(num[ch] > 0) {
+      adc_filter(ch, (u16)(sum[ch] / num[ch]));
+    }
   }
-#endif
 
+  adc_scan_start();
 }
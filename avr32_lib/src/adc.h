@@ -2,12 +2,37 @@
 #define _ALEPH_AVR32_ADC_H_
 
 #include "compiler.h"
+#include "types.h"
+
+// count of channels
+#define ADC_NUM_CHANNELS 4
+// sequencer sweeps per poll (1 to 16)
+#ifndef ADC_OVERSAMPLE
+#define ADC_OVERSAMPLE 4
+#endif
+// hysteresis half-width around the last posted value, in 12-bit steps
+#ifndef ADC_HYSTERESIS
+#define ADC_HYSTERESIS 3
+#endif
+// max change of a posted value per poll, in 12-bit steps (0 is unlimited)
+#ifndef ADC_SLEW
+#define ADC_SLEW 0
+#endif
 
 // setup ad7923
 extern void init_adc(void);
 
-// perform conversion, check for changes, and post events
+// average scanned values, check for changes, post events,
+// and start the next scan
 extern void adc_poll(void);
 
-#endif
+// end of each word in a scan, from the PDCA interrupt
+extern void adc_scan_done(void);
+
+// hold the ADC's SPI for another chip, waiting for a scan in flight.
+// no scan starts until the matching adc_bus_unlock().
+// call from the main loop, around the select and deselect of the other chip.
+extern void adc_bus_lock(void);
+extern void adc_bus_unlock(void);
 
+#endif
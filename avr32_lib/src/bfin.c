@@ -5,6 +5,8 @@
    follow protocol at aleph/common/protocol.h
 */
 
+// std
+#include <string.h>
 //ASF
 #include "compiler.h"
 #include "delay.h"
@@ -29,12 +31,44 @@
 #include "util.h"
 #include "bfin.h"
 
+//--------------------------------------
+//--- static variables
+
+// .ldr block header: 4 bytes address, 4 bytes count, 2 bytes flags
+#define LDR_HEADER_BYTES 10
+#define LDR_FLAG_ZEROFILL 0x0001
+#define LDR_FLAG_FINAL 0x8000
+
+// streaming load state
+static struct {
+  // next byte to send, end of bytes read so far
+  u32 txPos;
+  u32 txEnd;
+  // header bytes collected for current block
+  u8 hdr[LDR_HEADER_BYTES];
+  u8 hdrPos;
+  // payload bytes left in current block
+  u32 payload;
+  // current block is the last one
+  u8 final;
+  // saw the final block, stop sending
+  u8 done;
+  // header was malformed
+  u8 error;
+} ldrStream;
+
+// dsp is held in reset after a failed load
+static u8 halted = 0;
+
 //--------------------------------------
 //--- static fuction declaration
 
 static void bfin_start_transfer(void);
 static void bfin_end_transfer(void); 
 static void bfin_transfer_byte(u8 data);
+static void bfin_stream_byte(void);
+static void bfin_stream_idle(void);
+static void bfin_hold_reset(void);
 
 //---------------------------------------
 //--- external function definition
@@ -86,10 +120,78 @@ void bfin_load_buf(void) {
   }
 
   bfin_end_transfer();
+  halted = 0;
  
   app_resume();
 }
 
+// stream a bfin executable from a reader, overlapping reads with the boot transfer.
+// each chunk is read into the RAM buffer while the previous ones are sent,
+// and the .ldr block structure is checked as bytes go out.
+// caller should hold app_pause().
+// returns bytes read (stored in bfinLdrSize), or 0 on failure.
+u32 bfin_load_stream(bfin_read_t read, void* src, u32 size) {
+  u32 n, got;
+  u32 pos = 0;
+
+  if(size > BFIN_LDR_MAX_BYTES) {
+    size = BFIN_LDR_MAX_BYTES;
+  }
+
+  memset(&ldrStream, 0, sizeof(ldrStream));
+
+  bfin_start_transfer();
+
+  while(pos < size) {
+    n = size - pos;
+    if(n > BFIN_LDR_CHUNK_BYTES) { n = BFIN_LDR_CHUNK_BYTES; }
+    // send what we have while the card is busy with the next chunk
+    fs_set_wait_hook(&bfin_stream_idle);
+    got = (*read)(bfinLdrData + pos, n, src);
+    fs_set_wait_hook(NULL);
+    pos += got;
+    ldrStream.txEnd = pos;
+    if(got != n) {
+      print_dbg("\r\n bfin stream: read error at byte ");
+      print_dbg_ulong(pos);
+      break;
+    }
+    if(ldrStream.error) { break; }
+  }
+
+  // drain the rest
+  while( (ldrStream.txPos < ldrStream.txEnd) && !ldrStream.done && !ldrStream.error ) {
+    bfin_stream_byte();
+  }
+
+  bfin_end_transfer();
+
+  if(ldrStream.error) {
+    print_dbg("\r\n bfin stream: bad .ldr block header at byte ");
+    print_dbg_ulong(ldrStream.txPos);
+  } else if(!ldrStream.done) {
+    print_dbg("\r\n bfin stream: .ldr ended before final block");
+  } else {
+    print_dbg("\r\n bfin stream: sent ");
+    print_dbg_ulong(ldrStream.txPos);
+    print_dbg(" bytes");
+    bfinLdrSize = pos;
+    halted = 0;
+    return pos;
+  }
+
+  // the dsp has been fed a partial image; don't let it run.
+  // the buffer no longer holds a whole image either.
+  bfin_hold_reset();
+  bfinLdrSize = 0;
+  return 0;
+}
+
+// dsp is held in reset after a failed load
+u8 bfin_halted(void) {
+  return halted;
+}
+
 //void bfin_set_param(u8 idx, f32 x ) {
 void bfin_set_param(u8 idx, fix16_t x ) {
   //static u32 ticks = 0;
@@ -328,6 +430,50 @@ static void bfin_transfer_byte(u8 data) {
   spi_write(BFIN_SPI, data);
 }
 
+// send the next streamed byte, tracking .ldr blocks
+static void bfin_stream_byte(void) {
+  u8 b = bfinLdrData[ldrStream.txPos++];
+  u16 flags;
+  u32 count;
+
+  bfin_transfer_byte(b);
+
+  if(ldrStream.payload > 0) {
+    // inside block data
+    if(--ldrStream.payload == 0 && ldrStream.final) {
+      ldrStream.done = 1;
+    }
+    return;
+  }
+
+  ldrStream.hdr[ldrStream.hdrPos++] = b;
+  if(ldrStream.hdrPos < LDR_HEADER_BYTES) {
+    return;
+  }
+  // header complete (little-endian fields)
+  ldrStream.hdrPos = 0;
+  count = ldrStream.hdr[4] | (ldrStream.hdr[5] << 8)
+    | (ldrStream.hdr[6] << 16) | ((u32)ldrStream.hdr[7] << 24);
+  flags = ldrStream.hdr[8] | (ldrStream.hdr[9] << 8);
+  ldrStream.final = (flags & LDR_FLAG_FINAL) ? 1 : 0;
+  if(flags & LDR_FLAG_ZEROFILL) {
+    // no payload in the file
+    ldrStream.done = ldrStream.final;
+  } else if(count > (BFIN_LDR_MAX_BYTES - ldrStream.txPos)) {
+    ldrStream.error = 1;
+  } else {
+    ldrStream.payload = count;
+    if(count == 0) { ldrStream.done = ldrStream.final; }
+  }
+}
+
+// runs while waiting on the sd card: send one byte if any are ready
+static void bfin_stream_idle(void) {
+  if( (ldrStream.txPos < ldrStream.txEnd) && !ldrStream.done && !ldrStream.error ) {
+    bfin_stream_byte();
+  }
+}
+
 void bfin_start_transfer(void) {
   //  volatile u64 delay;
   gpio_set_gpio_pin(BFIN_RESET_PIN);  
@@ -346,6 +492,12 @@ void bfin_end_transfer(void) {
   spi_unselectChip(BFIN_SPI, BFIN_SPI_NPCS);
 }
 
+// keep the dsp in reset until the next load
+void bfin_hold_reset(void) {
+  gpio_clr_gpio_pin(BFIN_RESET_PIN);
+  halted = 1;
+}
+
 // wait for ready status (e.g. after module init)
 void bfin_wait_ready(void) {
   // use ready pin
@@ -1,5 +1,11 @@
 /* encoders.c
  * aleph
+ *
+ * quadrature decoding from pin-change interrupts.
+ * each edge is timestamped with the cpu cycle counter;
+ * the smoothed edge interval selects a gain from the acceleration curve,
+ * and the scaled step is added to the accumulator.
+ * accumulated deltas are collected from a timer with take_enc_delta().
  */
 
 // asf
@@ -10,12 +16,20 @@
 // aleph
 //#include "conf_aleph.h"
 #include "aleph_board.h"
+#include "conf_tc_irq.h"
 #include "events.h"
 #include "event_types.h"
 #include "encoders.h"
 
 #define ENC_THRESH_DEFAULT 0
 
+// cpu cycle counter for edge timing
+#define ENC_CYCLES() Get_system_register(AVR32_COUNT)
+// edge interval at and above which there is no acceleration
+#define ENC_SLOW_CYCLES ( (FCPU_HZ / 1000) * ENC_ACCEL_SLOW_MS )
+// count of curve steps; each halves the edge interval
+#define ENC_ACCEL_STEPS 8
+
 //--------------------------
 //---- external variables
 enc_t enc[NUM_ENC];
@@ -26,6 +40,28 @@ enc_t enc[NUM_ENC];
 // encoder movement map
 static const S8 enc_map[4][4] = { {0,1,-1,0}, {-1,0,0,1}, {1,0,0,-1}, {0,-1,1,0} };
 
+// gain at full acceleration, per halving of the edge interval
+static const u16 enc_accel_curve[ENC_ACCEL_STEPS] = {
+  1, 2, 4, 12, 32, 96, 256, 512
+};
+
+//------------------------------
+//----- static functions
+
+// gain for a smoothed edge interval
+static inline s32 enc_gain(const u32 period, const u8 accel) {
+  u32 b;
+  if(accel == 0 || period >= ENC_SLOW_CYCLES) {
+    return 1;
+  }
+  // count of halvings below the slow interval
+  b = __builtin_clz(period | 1) - __builtin_clz(ENC_SLOW_CYCLES);
+  if(b >= ENC_ACCEL_STEPS) {
+    b = ENC_ACCEL_STEPS - 1;
+  }
+  return 1 + (( (s32)(enc_accel_curve[b] - 1) * accel ) >> ENC_ACCEL_SHIFT);
+}
+
 //------------------------------
 //----- external functions
 
@@ -45,26 +81,78 @@ void init_encoders(void) {
   enc[3].pin[0] = ENC3_S0_PIN;
   enc[3].pin[1] = ENC3_S1_PIN;
   enc[3].event = kEventEncoder3;
-  
+
   // realtime initial pin values
   for(i=0; i<NUM_ENC; i++) {
     enc[i].pos = gpio_get_pin_value(enc[i].pin[0]) + (gpio_get_pin_value(enc[i].pin[1]) << 1);
     enc[i].thresh = ENC_THRESH_DEFAULT;
+    enc[i].val = 0;
+    enc[i].time = ENC_CYCLES();
+    enc[i].period = ENC_SLOW_CYCLES;
+    enc[i].dir = 0;
+    enc[i].accel = 0;
   }
 }
 
-// apply pin mapping to deteremine movement
+// apply pin mapping to deteremine movement.
+// called from the pin-change interrupt.
 void process_enc( const U8 idx) {
+  enc_t* p = &(enc[idx]);
   U8 pos;
-  
-  pos = gpio_get_pin_value(enc[idx].pin[0]) + (gpio_get_pin_value(enc[idx].pin[1]) << 1);
-  
-  if (pos != enc[idx].pos) {
-    enc[idx].val -= enc_map[enc[idx].pos][pos];
-    enc[idx].pos = pos;
+  S8 dir;
+  u32 now, dt;
+  s32 val;
+
+  pos = gpio_get_pin_value(p->pin[0]) + (gpio_get_pin_value(p->pin[1]) << 1);
+
+  if (pos == p->pos) {
+    return;
   }
+  dir = -enc_map[p->pos][pos];
+  p->pos = pos;
+  // both pins changed; direction is unknown
+  if(dir == 0) {
+    return;
+  }
+
+  now = ENC_CYCLES();
+  dt = now - p->time;
+  p->time = now;
+  if(dir != p->dir || dt >= ENC_SLOW_CYCLES) {
+    // reversal or pause: start again from the slow end
+    p->dir = dir;
+    p->period = ENC_SLOW_CYCLES;
+  } else {
+    // smooth the interval over a few edges to reject bounce and jitter
+    p->period = p->period - (p->period >> 2) + (dt >> 2);
+  }
+
+  val = (s32)(p->val) + (dir * enc_gain(p->period, p->accel));
+  if(val > 0x7fff) { val = 0x7fff; }
+  if(val < -0x7fff) { val = -0x7fff; }
+  p->val = (S16)val;
+}
+
+// take the accumulated delta of an encoder, if it exceeds the threshold.
+// return 0 otherwise.
+s16 take_enc_delta( const u8 idx ) {
+  s16 val, valAbs;
+  cpu_irq_disable_level(UI_IRQ_PRIORITY);
+  val = enc[idx].val;
+  valAbs = val < 0 ? -val : val;
+  if(valAbs > enc[idx].thresh) {
+    enc[idx].val = 0;
+  } else {
+    val = 0;
+  }
+  cpu_irq_enable_level(UI_IRQ_PRIORITY);
+  return val;
 }
-  
+
 void set_enc_thresh( const u8 idx, const u8 v ) {
   enc[idx].thresh = v;
 }
+
+void set_enc_accel( const u8 idx, const u8 v ) {
+  enc[idx].accel = v;
+}
@@ -11,15 +11,29 @@
 
 #define NUM_ENC    4
 
+// edge interval in ms at and above which there is no acceleration
+#define ENC_ACCEL_SLOW_MS 16
+// acceleration amount is in 1/16ths of the full curve
+#define ENC_ACCEL_SHIFT 4
+#define ENC_ACCEL_FULL (1 << ENC_ACCEL_SHIFT)
+
 typedef struct _enc {
   // pin numbers
   U8 pin[2];
   // current position (p0 | (p1 << 1))
   U8 pos;
+  // direction of last step
+  S8 dir;
+  // acceleration amount (0 is none)
+  u8 accel;
   // current value of accumulator
   S16 val;
   // threshold to set sensitivity
     S16 thresh;
+  // cycle count at last edge
+  u32 time;
+  // smoothed edge interval in cycles
+  u32 period;
   // event number to post on change
   etype event;
 } enc_t;
@@ -30,7 +44,11 @@ extern enc_t enc[NUM_ENC];
 extern void process_enc( const U8 enc );
 // intialize encoder positions
 extern void init_encoders(void);
+// take accumulated delta if over threshold, else return 0
+extern s16 take_enc_delta( const u8 idx );
 // set threshold of encoder at given idx
 extern void set_enc_thresh( const u8 idx, const u8 v );
+// set acceleration of encoder at given idx (0 to ENC_ACCEL_FULL)
+extern void set_enc_accel( const u8 idx, const u8 v );
 
 #endif // header guard
@@ -39,7 +39,11 @@ struct fat_buffer;
 
 struct fat_buffer
 {
+#ifdef FAT_CACHE_ALLOC
+    uint8 *                 sector;
+#else
     uint8                   sector[FAT_SECTOR_SIZE * FAT_BUFFER_SECTORS];
+#endif
     uint32                  address; 
     int                     dirty;
     uint8 *                 ptr;
@@ -48,6 +52,17 @@ struct fat_buffer
     struct fat_buffer       *next;
 };
 
+// Cache hit / miss counters
+struct fat_cache_stats
+{
+    // FAT table sector buffers
+    uint32                  fat_hits;
+    uint32                  fat_misses;
+    // Per-file cluster chain caches
+    uint32                  chain_hits;
+    uint32                  chain_misses;
+};
+
 typedef enum eFatType
 {
     FAT_TYPE_16,
@@ -85,6 +100,9 @@ struct fatfs
     // FAT Buffer
     struct fat_buffer        *fat_buffer_head;
     struct fat_buffer        fat_buffers[FAT_BUFFERS];
+
+    // Cache statistics
+    struct fat_cache_stats   cache_stats;
 };
 
 struct fs_dir_list_status
@@ -63,10 +63,13 @@ int fatfs_cache_get_next_cluster(struct fatfs *fs, FL_FILE *file, uint32 cluster
 
     if (file->cluster_cache_idx[slot] == clusterIdx)
     {
+        fs->cache_stats.chain_hits++;
         *pNextCluster = file->cluster_cache_data[slot];
         return 1;
     }
 #endif
+
+    fs->cache_stats.chain_misses++;
     
     return 0;
 }
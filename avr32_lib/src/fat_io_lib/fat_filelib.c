@@ -642,7 +642,17 @@ void fl_init(void)
 
     // Add all file objects to free list
     for (i=0;i<FATFS_MAX_OPEN_FILES;i++)
+    {
+#if defined(FAT_CLUSTER_CACHE_ENTRIES) && defined(FAT_CACHE_ALLOC)
+        // Cluster chain cache storage is allocated once and kept
+        if (_files[i].cluster_cache_idx == NULL)
+        {
+            _files[i].cluster_cache_idx = (uint32*)FAT_CACHE_ALLOC(FAT_CLUSTER_CACHE_ENTRIES * sizeof(uint32));
+            _files[i].cluster_cache_data = (uint32*)FAT_CACHE_ALLOC(FAT_CLUSTER_CACHE_ENTRIES * sizeof(uint32));
+        }
+#endif
         fat_list_insert_last(&_free_file_list, &_files[i].list_node);
+    }
 
     _filelib_init = 1;
 }
@@ -809,6 +819,53 @@ void* fl_fopen(const char *path, const char *mode)
     return file;    
 }
 //-----------------------------------------------------------------------------
+// fl_fopen_cluster: Open a file for reading given its start cluster and length
+// (as reported by fl_readdir), skipping the directory search.
+//-----------------------------------------------------------------------------
+void* fl_fopen_cluster(uint32 startcluster, uint32 length)
+{
+    FL_FILE* file;
+
+    // If first call to library, initialise
+    CHECK_FL_INIT();
+
+    if (!_filelib_valid)
+        return NULL;
+
+    FL_LOCK(&_fs);
+
+    // Allocate a new file handle
+    file = _allocate_file();
+    if (file)
+    {
+        // No name; this handle can't be found by _check_file_open
+        memset(file->path, '\0', sizeof(file->path));
+        memset(file->filename, '\0', sizeof(file->filename));
+        memset(file->shortfilename, '\0', sizeof(file->shortfilename));
+
+        // Initialise file details
+        file->parentcluster = FAT32_INVALID_CLUSTER;
+        file->startcluster = startcluster;
+        file->filelength = length;
+        file->bytenum = 0;
+        file->file_data_address = 0xFFFFFFFF;
+        file->file_data_dirty = 0;
+        file->filelength_changed = 0;
+
+        // Quick lookup for next link in the chain
+        file->last_fat_lookup.ClusterIdx = 0xFFFFFFFF;
+        file->last_fat_lookup.CurrentCluster = 0xFFFFFFFF;
+
+        fatfs_cache_init(&_fs, file);
+
+        // Read only
+        file->flags = FILE_READ;
+    }
+
+    FL_UNLOCK(&_fs);
+    return file;
+}
+//-----------------------------------------------------------------------------
 // _write_sectors: Write sector(s) to disk
 //-----------------------------------------------------------------------------
 #if FATFS_INC_WRITE_SUPPORT
@@ -1060,7 +1117,12 @@ int fl_fread(void * buffer, int size, int length, void *f )
         // Read whole sector, read from media directly into target buffer
         if ((offset == 0) && ((count - bytesRead) >= FAT_SECTOR_SIZE))
         {
+            // Buffered sector may hold newer data than the media
+            if (file->file_data_dirty)
+                fl_fflush(file);
+
             // Read as many sectors as possible into target buffer
+            // (limited to the remainder of the current cluster)
             uint32 sectorsRead = _read_sectors(file, sector, (uint8*)((uint8*)buffer + bytesRead), (count - bytesRead) / FAT_SECTOR_SIZE);        
             if (sectorsRead)
             {
@@ -1130,14 +1192,15 @@ int fl_fseek( void *f, long offset, int origin )
     if (!file)
         return -1;
 
-    if (origin == SEEK_END && offset != 0)
+    if (origin == SEEK_END && offset > 0)
         return -1;
 
     FL_LOCK(&_fs);
 
-    // Invalidate file buffer
-    file->file_data_address = 0xFFFFFFFF;
-    file->file_data_dirty = 0;
+    // NOTE: the file buffer is kept; fl_fread / fl_fwrite compare its
+    // address against the new position and flush / reload as needed,
+    // so seeks within the buffered sector cost nothing and dirty data
+    // is not lost.
 
     if (origin == SEEK_SET)
     {
@@ -1175,7 +1238,15 @@ int fl_fseek( void *f, long offset, int origin )
     }
     else if (origin == SEEK_END)
     {
-        file->bytenum = file->filelength;
+        // Make shift positive
+        offset = -offset;
+
+        // Limit to negative shift to start of file
+        if ((uint32)offset > file->filelength)
+            file->bytenum = 0;
+        else
+            file->bytenum = file->filelength - offset;
+
         res = 0;
     }
     else
@@ -1581,6 +1652,68 @@ int fl_is_dir(const char *path)
 }
 #endif
 //-----------------------------------------------------------------------------
+// fl_dir_signature: Hash the raw entries of a directory. Any change to the
+// directory (files added, removed, renamed, resized) changes the signature.
+//-----------------------------------------------------------------------------
+#if FATFS_DIR_LIST_SUPPORT
+int fl_dir_signature(const char *path, uint32 *signature)
+{
+    FL_DIR dir;
+    uint32 sector;
+    uint32 hash = 2166136261UL;
+    int end = 0;
+    int i;
+
+    // If first call to library, initialise
+    CHECK_FL_INIT();
+
+    if (!signature || !fl_opendir(path, &dir))
+        return 0;
+
+    FL_LOCK(&_fs);
+
+    for (sector = 0; !end; sector++)
+    {
+        // Read directory sector into working buffer
+        if (!fatfs_sector_reader(&_fs, dir.cluster, sector, 0))
+            break;
+
+        for (i = 0; i < FAT_SECTOR_SIZE; i++)
+        {
+            // First byte of an entry is zero at end of directory
+            if (((i % FAT_DIR_ENTRY_SIZE) == 0) && (_fs.currentsector.sector[i] == 0x00))
+            {
+                end = 1;
+                break;
+            }
+
+            // FNV-1a
+            hash = (hash ^ _fs.currentsector.sector[i]) * 16777619UL;
+        }
+    }
+
+    FL_UNLOCK(&_fs);
+
+    *signature = hash;
+    return 1;
+}
+#endif
+//-----------------------------------------------------------------------------
+// fl_get_cache_stats: Copy out FAT / cluster chain cache hit counters
+//-----------------------------------------------------------------------------
+void fl_get_cache_stats(struct fat_cache_stats *stats)
+{
+    if (stats)
+        memcpy(stats, &_fs.cache_stats, sizeof(struct fat_cache_stats));
+}
+//-----------------------------------------------------------------------------
+// fl_reset_cache_stats: Zero FAT / cluster chain cache hit counters
+//-----------------------------------------------------------------------------
+void fl_reset_cache_stats(void)
+{
+    memset(&_fs.cache_stats, 0x00, sizeof(struct fat_cache_stats));
+}
+//-----------------------------------------------------------------------------
 // fl_get_fs:
 //-----------------------------------------------------------------------------
 #ifdef FATFS_INC_TEST_HOOKS
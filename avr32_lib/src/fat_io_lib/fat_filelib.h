@@ -47,8 +47,13 @@ typedef struct sFL_FILE
     uint8                   shortfilename[11];
 
 #ifdef FAT_CLUSTER_CACHE_ENTRIES
+#ifdef FAT_CACHE_ALLOC
+    uint32 *                cluster_cache_idx;
+    uint32 *                cluster_cache_data;
+#else
     uint32                  cluster_cache_idx[FAT_CLUSTER_CACHE_ENTRIES];
     uint32                  cluster_cache_data[FAT_CLUSTER_CACHE_ENTRIES];
+#endif
 #endif
 
     // Cluster Lookup
@@ -96,6 +101,7 @@ int                 fl_fgetpos(void *file , uint32 * position);
 long                fl_ftell(void *f);
 int                 fl_feof(void *f);
 int                 fl_remove(const char * filename);    
+void*               fl_fopen_cluster(uint32 startcluster, uint32 length);
 
 // Equivelant dirent.h 
 typedef struct fs_dir_list_status    FL_DIR;
@@ -109,6 +115,9 @@ int                 fl_closedir(FL_DIR* dir);
 void                fl_listdirectory(const char *path);
 int                 fl_createdirectory(const char *path);
 int                 fl_is_dir(const char *path);
+int                 fl_dir_signature(const char *path, uint32 *signature);
+void                fl_get_cache_stats(struct fat_cache_stats *stats);
+void                fl_reset_cache_stats(void);
 
 // Test hooks
 #ifdef FATFS_INC_TEST_HOOKS
@@ -25,20 +25,32 @@
 #endif
 
 // Number of sectors per FAT_BUFFER (min 1)
+// (FAT table buffers are aligned to this many sectors)
 #ifndef FAT_BUFFER_SECTORS
-    #define FAT_BUFFER_SECTORS              1
+    #define FAT_BUFFER_SECTORS              4
 #endif
 
 // Max FAT sectors to buffer (min 1)
+// Buffers are kept in least-recently-used order.
 // (mem used is FAT_BUFFERS * FAT_BUFFER_SECTORS * FAT_SECTOR_SIZE)
 #ifndef FAT_BUFFERS
-    #define FAT_BUFFERS                     1
+    #define FAT_BUFFERS                     16
 #endif
 
 // Size of cluster chain cache (can be undefined)
 // Mem used = FAT_CLUSTER_CACHE_ENTRIES * 4 * 2
 // Improves access speed considerably
-//#define FAT_CLUSTER_CACHE_ENTRIES         128
+#ifndef FAT_CLUSTER_CACHE_ENTRIES
+    #define FAT_CLUSTER_CACHE_ENTRIES       1024
+#endif
+
+// Allocator for FAT buffers and cluster chain caches (can be undefined)
+// If undefined, storage is embedded in the fatfs / FL_FILE structures.
+// aleph: allocate once from the SDRAM heap when the library starts.
+#ifndef FAT_CACHE_ALLOC
+    #include "memory.h"
+    #define FAT_CACHE_ALLOC(bytes)          ((void*)alloc_mem(bytes))
+#endif
 
 // Include support for writing files (1 / 0)? 
 #ifndef FATFS_INC_WRITE_SUPPORT
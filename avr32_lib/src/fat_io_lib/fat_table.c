@@ -64,12 +64,22 @@ void fatfs_fat_init(struct fatfs *fs)
     // FAT buffer chain head
     fs->fat_buffer_head = NULL;
 
+#ifdef FAT_CACHE_ALLOC
+    // Buffer storage is allocated once and kept
+    if (fs->currentsector.sector == NULL)
+        fs->currentsector.sector = (uint8*)FAT_CACHE_ALLOC(FAT_SECTOR_SIZE * FAT_BUFFER_SECTORS);
+#endif
+
     for (i=0;i<FAT_BUFFERS;i++)
     {
+#ifdef FAT_CACHE_ALLOC
+        if (fs->fat_buffers[i].sector == NULL)
+            fs->fat_buffers[i].sector = (uint8*)FAT_CACHE_ALLOC(FAT_SECTOR_SIZE * FAT_BUFFER_SECTORS);
+#endif
         // Initialise buffers to invalid
         fs->fat_buffers[i].address = FAT32_INVALID_CLUSTER;
         fs->fat_buffers[i].dirty = 0;
-        memset(fs->fat_buffers[i].sector, 0x00, sizeof(fs->fat_buffers[i].sector));
+        memset(fs->fat_buffers[i].sector, 0x00, FAT_SECTOR_SIZE * FAT_BUFFER_SECTORS);
         fs->fat_buffers[i].ptr = NULL;
 
         // Add to head of queue
@@ -143,10 +153,22 @@ static struct fat_buffer *fatfs_fat_read_sector(struct fatfs *fs, uint32 sector)
     // We found the sector already in FAT buffer chain
     if (pcur)
     {
+        fs->cache_stats.fat_hits++;
+
+        // Move to start of sector buffer list (now newest sector)
+        if (last)
+        {
+            last->next = pcur->next;
+            pcur->next = fs->fat_buffer_head;
+            fs->fat_buffer_head = pcur;
+        }
+
         pcur->ptr = (uint8 *)(pcur->sector + ((sector - pcur->address) * FAT_SECTOR_SIZE));
         return pcur;
     }
 
+    fs->cache_stats.fat_misses++;
+
     // Else, we removed the last item from the list
     pcur = last;
 
@@ -159,10 +181,14 @@ static struct fat_buffer *fatfs_fat_read_sector(struct fatfs *fs, uint32 sector)
         if (!fatfs_fat_writeback(fs, pcur))
             return 0;
 
-    // Address is now new sector
-    pcur->address = sector;
+    // Address is now new sector, aligned within the FAT so that
+    // multi-sector buffers never overlap
+    if (sector >= fs->fat_begin_lba)
+        pcur->address = sector - ((sector - fs->fat_begin_lba) % FAT_BUFFER_SECTORS);
+    else
+        pcur->address = sector;
 
-    // Read next sector
+    // Read next sector(s)
     if (!fs->disk_io.read_media(pcur->address, pcur->sector, FAT_BUFFER_SECTORS))
     {
         // Read failed, invalidate buffer address
@@ -170,7 +196,7 @@ static struct fat_buffer *fatfs_fat_read_sector(struct fatfs *fs, uint32 sector)
         return NULL;
     }
 
-    pcur->ptr = pcur->sector;
+    pcur->ptr = (uint8 *)(pcur->sector + ((sector - pcur->address) * FAT_SECTOR_SIZE));
     return pcur;
 }
 //-----------------------------------------------------------------------------
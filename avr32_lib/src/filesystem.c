@@ -3,8 +3,14 @@
    aleph
 
    lower level glue between filesystem (FAT) and hardware (PDCA)
+
+   reads and writes use multi-block commands (CMD18 / CMD25),
+   with PDCA transferring each block directly to/from the caller's buffer.
+   small sequential reads are served from a read-ahead window.
 */
 
+// std
+#include <string.h>
 // asf
 #include "compiler.h"
 #include "pdca.h"
@@ -13,10 +19,21 @@
 #include "spi.h"
 #include "types.h"
 // aleph
+#include "adc.h"
+#include "aleph_board.h"
 #include "filesystem.h"
 
+// sd/mmc commands not defined by the ASF driver
+#define MMC_STOP_TRANSMISSION 12
+#define MMC_READ_MULTIPLE_BLOCK 18
+#define MMC_WRITE_MULTIPLE_BLOCK 25
+
+// max polls waiting for a data token
+#define FS_TOKEN_TIMEOUT 30000
+// max polls waiting for the card to release busy
+#define FS_BUSY_TIMEOUT 200000
 
-//----- extern 
+//----- extern
 // Local RAM buffer to store data  to/from the SD/MMC card
 volatile U8 pdcaRxBuf[FS_BUF_SIZE];
 volatile U8 pdcaTxBuf[FS_BUF_SIZE];
@@ -29,80 +46,237 @@ volatile u8 fsEndTransfer;
 volatile avr32_pdca_channel_t* pdcaRxChan ;
 volatile avr32_pdca_channel_t* pdcaTxChan ;
 
+#if FS_READAHEAD_SECTORS > 0
+// read-ahead window
+static U8 raBuf[FS_READAHEAD_SECTORS * FS_BUF_SIZE];
+// first sector in window
+static u32 raStart = 0;
+// count of valid sectors in window
+static u32 raCount = 0;
+// sector following the last read request
+static u32 raNext = 0xffffffff;
+#endif
+
+// called repeatedly while waiting on the card
+static fs_wait_hook_t waitHook = NULL;
+
 ///========================
 //====  functions
 
+//---- static
+
+// card address argument for a given sector
+static inline u32 fs_sector_arg(u32 sector) {
+  if(card_type == SD_CARD_2_SDHC) {
+    return sector;
+  } else {
+    return sector << 9;
+  }
+}
+
+// run the wait hook, if any
+static inline void fs_idle(void) {
+  if(waitHook != NULL) {
+    (*waitHook)();
+  }
+}
+
+// poll until the card releases busy. chip must already be selected.
+static bool fs_wait_ready(void) {
+  u32 retry = 0;
+  while(sd_mmc_spi_send_and_read(0xFF) != 0xFF) {
+    if(++retry == FS_BUSY_TIMEOUT) {
+      return false;
+    }
+    fs_idle();
+  }
+  return true;
+}
+
+// run one block through the PDCA and wait for the RX channel to finish.
+static void fs_pdca_block(volatile void* rx, volatile void* tx) {
+  pdca_load_channel( AVR32_PDCA_CHANNEL_SPI_RX, rx, FS_BUF_SIZE);
+  pdca_load_channel( AVR32_PDCA_CHANNEL_SPI_TX, tx, FS_BUF_SIZE);
+
+  fsEndTransfer = false;
+
+  pdca_enable_interrupt_transfer_complete(AVR32_PDCA_CHANNEL_SPI_RX);
+  pdcaRxChan =(volatile avr32_pdca_channel_t*) pdca_get_handler(AVR32_PDCA_CHANNEL_SPI_RX);
+  pdcaTxChan =(volatile avr32_pdca_channel_t*) pdca_get_handler(AVR32_PDCA_CHANNEL_SPI_TX);
+  pdcaRxChan->cr = AVR32_PDCA_TEN_MASK; // Enable RX PDCA transfer first
+  pdcaTxChan->cr = AVR32_PDCA_TEN_MASK; // and TX PDCA transfer
+  // wait for signal from ISR
+  while(!fsEndTransfer) { fs_idle(); }
+}
+
+// read contiguous sectors into a buffer with a single CMD18.
+static bool fs_read_blocks(u32 sector, U8* dst, u32 count) {
+  u32 i;
+  u16 timeout;
+  u8 tok;
+  bool ret = true;
+
+  // the adc scans on this bus from the timer
+  adc_bus_lock();
+  if(sd_mmc_spi_wait_not_busy() == false) {
+    adc_bus_unlock();
+    return false;
+  }
+
+  spi_selectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+
+  if(sd_mmc_spi_command(MMC_READ_MULTIPLE_BLOCK, fs_sector_arg(sector)) != 0x00) {
+    spi_unselectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+    adc_bus_unlock();
+    return false;
+  }
+
+  for(i=0; i<count; i++) {
+    // wait for data token (or data error token)
+    timeout = FS_TOKEN_TIMEOUT;
+    while((tok = sd_mmc_spi_send_and_read(0xFF)) == 0xFF) {
+      if(--timeout == 0) { break; }
+      fs_idle();
+    }
+    if(tok != MMC_STARTBLOCK_READ) {
+      ret = false;
+      break;
+    }
+    // DMA straight into destination; TX clocks out 0xff
+    fs_pdca_block(dst, pdcaTxBuf);
+    // 16-bit CRC (ignored)
+    sd_mmc_spi_send_and_read(0xFF);
+    sd_mmc_spi_send_and_read(0xFF);
+    dst += FS_BUF_SIZE;
+  }
+
+  // stop transmission. the byte after CMD12 is a stuff byte,
+  // so skip the R1 and just wait for busy release.
+  sd_mmc_spi_command(MMC_STOP_TRANSMISSION, 0);
+  if(fs_wait_ready() == false) {
+    ret = false;
+  }
+  spi_unselectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+  adc_bus_unlock();
+  return ret;
+}
+
+// write contiguous sectors from a buffer with a single CMD25.
+static bool fs_write_blocks(u32 sector, const U8* src, u32 count) {
+  u32 i;
+  u8 resp;
+  bool ret = true;
+
+  // the adc scans on this bus from the timer
+  adc_bus_lock();
+  if(sd_mmc_spi_wait_not_busy() == false) {
+    adc_bus_unlock();
+    return false;
+  }
+
+  spi_selectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+
+  if(sd_mmc_spi_command(MMC_WRITE_MULTIPLE_BLOCK, fs_sector_arg(sector)) != 0x00) {
+    spi_unselectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+    adc_bus_unlock();
+    return false;
+  }
+  // one byte gap before first token
+  sd_mmc_spi_send_and_read(0xFF);
+
+  for(i=0; i<count; i++) {
+    sd_mmc_spi_send_and_read(MMC_STARTBLOCK_MWRITE);
+    // DMA straight from source; RX is discarded into scratch
+    fs_pdca_block(pdcaRxBuf, (volatile void*)src);
+    // 16-bit CRC (field required but value ignored)
+    sd_mmc_spi_send_and_read(0xFF);
+    sd_mmc_spi_send_and_read(0xFF);
+    // data response token
+    resp = sd_mmc_spi_send_and_read(0xFF);
+    if((resp & MMC_DR_MASK) != MMC_DR_ACCEPT) {
+      ret = false;
+      break;
+    }
+    // card holds MISO low while programming
+    if(fs_wait_ready() == false) {
+      ret = false;
+      break;
+    }
+    src += FS_BUF_SIZE;
+  }
+
+  // stop token, then wait for the final program cycle
+  sd_mmc_spi_send_and_read(MMC_STOPTRAN_WRITE);
+  sd_mmc_spi_send_and_read(0xFF);
+  if(fs_wait_ready() == false) {
+    ret = false;
+  }
+  spi_unselectChip(SD_MMC_SPI, SD_MMC_SPI_NPCS);
+  adc_bus_unlock();
+  return ret;
+}
+
 //---- low level i/o
 int media_read(unsigned long sector, unsigned char *buffer, unsigned long sector_count);
 int media_read(unsigned long sector, unsigned char *buffer, unsigned long sector_count) {
-  unsigned long i;
-
-  for (i=0;i<sector_count;i++) {
-    pdca_load_channel( AVR32_PDCA_CHANNEL_SPI_RX,
-		       &pdcaRxBuf,
-		       FS_BUF_SIZE);
-    
-    pdca_load_channel( AVR32_PDCA_CHANNEL_SPI_TX,
-		       (void *)&pdcaTxBuf,
-		       FS_BUF_SIZE); //send dummy to activate the clock
-    
-    fsEndTransfer = false;
-    
-    if(sd_mmc_spi_read_open_PDCA (sector)) {
-
-      spi_write(SD_MMC_SPI,0xFF); // dummy byte synchronizes transfer
-
-      pdca_enable_interrupt_transfer_complete(AVR32_PDCA_CHANNEL_SPI_RX);
-      pdcaRxChan =(volatile avr32_pdca_channel_t*) pdca_get_handler(AVR32_PDCA_CHANNEL_SPI_RX);
-      pdcaTxChan =(volatile avr32_pdca_channel_t*) pdca_get_handler(AVR32_PDCA_CHANNEL_SPI_TX);
-      pdcaRxChan->cr = AVR32_PDCA_TEN_MASK; // Enable RX PDCA transfer first
-      pdcaTxChan->cr = AVR32_PDCA_TEN_MASK; // and TX PDCA transfer
-      // wait for signal from ISR
-      while(!fsEndTransfer) { ;; }
-      // copy FIXME: could optimize away
-      for(i=0; i<FS_BUF_SIZE; i++) {
-	buffer[i] = pdcaRxBuf[i];
+#if FS_READAHEAD_SECTORS > 0
+  u32 n;
+
+  // serve from the read-ahead window if possible
+  if( (sector >= raStart) && ((sector + sector_count) <= (raStart + raCount)) ) {
+    memcpy(buffer, raBuf + ((sector - raStart) * FS_BUF_SIZE), sector_count * FS_BUF_SIZE);
+    raNext = sector + sector_count;
+    return 1;
+  }
+
+  // small sequential read: refill the window starting here
+  if( (sector_count < FS_READAHEAD_SECTORS)
+      && ( (sector == raNext) || (sector == (raStart + raCount)) ) ) {
+    n = FS_READAHEAD_SECTORS;
+    // don't read past the end of the card
+    if( (sector + n) > (sd_mmc_spi_last_block_address + 1) ) {
+      n = sd_mmc_spi_last_block_address + 1 - sector;
+    }
+    if( n >= sector_count ) {
+      raCount = 0;
+      if(fs_read_blocks(sector, raBuf, n)) {
+	raStart = sector;
+	raCount = n;
+	memcpy(buffer, raBuf, sector_count * FS_BUF_SIZE);
+	raNext = sector + sector_count;
+	return 1;
       }
-    } else {
-      print_dbg("\r\n error opening PDCA at sector "); 
-      print_dbg_ulong(sector);
     }
-    sector ++;
-    buffer += FS_BUF_SIZE;
   }
-  return 1;
+  raNext = sector + sector_count;
+#endif
+
+  if(fs_read_blocks(sector, buffer, sector_count)) {
+    return 1;
+  } else {
+    print_dbg("\r\n error reading sd_mmc_spi, sector: ");
+    print_dbg_ulong(sector);
+    return 0;
+  }
 }
 
 
 int media_write(unsigned long sector, unsigned char *buffer, unsigned long sector_count);
 int media_write(unsigned long sector, unsigned char *buffer, unsigned long sector_count) {
-  unsigned long i;
-  bool status;
-
-  // PDCA write isn't implemented in ASF... ! dang
-  // for the moment use slower blocking write.
-
-  status = sd_mmc_spi_write_open(sector);
+#if FS_READAHEAD_SECTORS > 0
+  // drop the read-ahead window if it overlaps
+  if( (sector < (raStart + raCount)) && ((sector + sector_count) > raStart) ) {
+    raCount = 0;
+  }
+#endif
 
-  if(status == false) {
-    print_dbg("\r\n error opening sd_mmc_spi, sector: ");
+  if(fs_write_blocks(sector, buffer, sector_count)) {
+    return 1;
+  } else {
+    print_dbg("\r\n error writing sd_mmc_spi, sector: ");
     print_dbg_hex(sector);
     return 0;
   }
-
-  for (i=0;i<sector_count;i++) {
-    status = sd_mmc_spi_write_sector_from_ram(buffer);
-    /////////// dbg
-    if(status == false) {
-      print_dbg("\r\n error writing sd_mmc_spi, sector: ");
-      print_dbg_hex(sector);
-    }
-    //////////////
-    sector++;
-    buffer += 512;
-  }
-  sd_mmc_spi_write_close();
-  return 1;
 }
 
 
@@ -110,6 +284,8 @@ int media_write(unsigned long sector, unsigned char *buffer, unsigned long secto
 // extern
 
 int fat_init(void) {
+  // TX buffer only ever clocks out idle bytes
+  memset((void*)pdcaTxBuf, 0xFF, FS_BUF_SIZE);
   // Initialise File IO Library
   print_dbg("\r\n beginning FAT library init.");
   fl_init();
@@ -124,3 +300,22 @@ int fat_init(void) {
   }
 }
 
+// set a function to run while waiting on the card (NULL to clear).
+// it runs in the caller's context, so it must not touch the SD bus.
+void fs_set_wait_hook(fs_wait_hook_t hook) {
+  waitHook = hook;
+}
+
+// print FAT / cluster chain cache counters
+void fat_print_cache_stats(void) {
+  struct fat_cache_stats stats;
+  fl_get_cache_stats(&stats);
+  print_dbg("\r\n FAT table cache hits: ");
+  print_dbg_ulong(stats.fat_hits);
+  print_dbg(" , misses: ");
+  print_dbg_ulong(stats.fat_misses);
+  print_dbg("\r\n cluster chain cache hits: ");
+  print_dbg_ulong(stats.chain_hits);
+  print_dbg(" , misses: ");
+  print_dbg_ulong(stats.chain_misses);
+}
@@ -6,6 +6,14 @@
 
 #define FS_BUF_SIZE 512
 
+// sectors to read ahead on small sequential reads (0 disables)
+#ifndef FS_READAHEAD_SECTORS
+#define FS_READAHEAD_SECTORS 8
+#endif
+
+// function to run while waiting on sd transfers
+typedef void(*fs_wait_hook_t)(void);
+
 //=====================================
 //==== vars
 // transfer-done flag
@@ -20,5 +28,9 @@ extern volatile avr32_pdca_channel_t* pdcaTxChan ;
 //====================================
 //==== funcs
 extern int fat_init(void);
+// print FAT / cluster chain cache counters
+extern void fat_print_cache_stats(void);
+// set a function to run while waiting on sd transfers (NULL to clear)
+extern void fs_set_wait_hook(fs_wait_hook_t hook);
 
 #endif // h guard
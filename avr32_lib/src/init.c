@@ -23,6 +23,7 @@
 #include "usart.h"
 // aleph
 //#include "conf_aleph.h"
+#include "adc.h"
 #include "aleph_board.h"
 #include "conf_tc_irq.h"
 #include "filesystem.h"
@@ -97,7 +98,7 @@ extern void init_tc (volatile avr32_tc_t *tc) {
   //  tc_write_rc(tc, APP_TC_CHANNEL, (FPBA_HZ / 128000));
   ///// FIXME: kludge because the timing is slow somehow... 
   ///// this constant is experimentally determined...
-  tc_write_rc(tc, APP_TC_CHANNEL, (FPBA_HZ / 149707));
+  tc_write_rc(tc, APP_TC_CHANNEL, APP_TC_RC);
 
   // configure the timer interrupt
   tc_configure_interrupts(tc, APP_TC_CHANNEL, &tc_interrupt);
@@ -196,7 +197,10 @@ extern void init_spi1 (void) {
 
   spi_setupChipReg( SD_MMC_SPI, &spiOptions, FPBA_HZ );
   // Initialize SD/MMC driver with SPI clock (PBA).
+  // the card shares this bus with the adc scan
+  adc_bus_lock();
   sd_mmc_spi_init(spiOptions, FPBA_HZ);
+  adc_bus_unlock();
 }
 
 
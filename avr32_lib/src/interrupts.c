@@ -9,6 +9,7 @@
 #include "tc.h"
 #include "usart.h"
 // aleph
+#include "adc.h"
 #include "aleph_board.h"
 #include "bfin.h"
 #include "conf_tc_irq.h"
@@ -45,6 +46,10 @@ volatile u8 refresh = 0;
 __attribute__((__interrupt__))
 static void irq_pdca(void);
 
+// irq for pdca (adc)
+__attribute__((__interrupt__))
+static void irq_pdca_adc(void);
+
 // irq for app timer
 __attribute__((__interrupt__))
 static void irq_tc(void);
@@ -83,12 +88,8 @@ static void irq_pdca(void) {
   cpu_irq_disable();
   // Disable interrupt channel.
   pdca_disable_interrupt_transfer_complete(AVR32_PDCA_CHANNEL_SPI_RX);
-  //unselects the SD/MMC memory.
-  sd_mmc_spi_read_close_PDCA();
-  //.... example has a 5000 clock gimpy delay here.
-  // using delay_us instead
-  delay_ms(10);
-  //  delay_ms(2);
+  // CRC, chip select and stop command are handled by the filesystem,
+  // which may still have more blocks to transfer in this command.
   // Disable unnecessary channel
   pdca_disable(AVR32_PDCA_CHANNEL_SPI_TX);
   pdca_disable(AVR32_PDCA_CHANNEL_SPI_RX);
@@ -99,6 +100,12 @@ static void irq_pdca(void) {
   fsEndTransfer = true;
 }
 
+// adc scan complete
+__attribute__((__interrupt__))
+static void irq_pdca_adc(void) {
+  adc_scan_done();
+}
+
 // timer irq
 __attribute__((__interrupt__))
 static void irq_tc(void) {
@@ -298,6 +305,7 @@ void register_interrupts(void) {
 
   // register IRQ for PDCA transfer
   INTC_register_interrupt(&irq_pdca, AVR32_PDCA_IRQ_0, SYS_IRQ_PRIORITY);
+  INTC_register_interrupt(&irq_pdca_adc, AVR32_PDCA_IRQ_0 + AVR32_PDCA_CHANNEL_ADC_RX, SYS_IRQ_PRIORITY);
 
   // register TC interrupt
   INTC_register_interrupt(&irq_tc, APP_TC_IRQ, APP_TC_IRQ_PRIORITY);
@@ -20,14 +20,32 @@
 
 //------ defines
 
+// monome device index is the ftdi device index
+#if defined(FTDI_MAX_DEVICES) && (FTDI_MAX_DEVICES != MONOME_MAX_DEVICES)
+# error monome and ftdi device tables must be the same size
+#endif
+
 // manufacturer string length
 #define MONOME_MANSTR_LEN 6
 // product string lengthextern 
 #define MONOME_PRODSTR_LEN 8
 // serial string length
 #define MONOME_SERSTR_LEN 9
-// tx buffer length
-#define MONOME_TX_BUF_LEN 72
+// tx queue length.
+// room for a full 256 as maps, or 4 arc rings.
+#define MONOME_TX_BUF_LEN 144
+
+// mext message sizes
+#define MEXT_LED_BYTES 3
+#define MEXT_LED_LEVEL_BYTES 4
+#define MEXT_ROW_BYTES 4
+#define MEXT_ROW_LEVEL_BYTES 7
+#define MEXT_COL_BYTES 4
+#define MEXT_COL_LEVEL_BYTES 7
+#define MEXT_MAP_BYTES 11
+#define MEXT_MAP_LEVEL_BYTES 35
+#define MEXT_RING_SET_BYTES 4
+#define MEXT_RING_MAP_BYTES 34
 
 //------- typedefs
 
@@ -53,66 +71,69 @@ typedef struct e_monomeDesc {
 } monomeDesc;
 
 
+// per-device state
+struct e_monomeDev {
+  // index in the device table, same as the ftdi device index
+  u8 idx;
+  // descriptor for connected device
+  monomeDesc desc;
+  // protocol functions, assigned on connection
+  read_serial_t read_serial;
+  set_intense_t set_intense;
+  grid_map_t grid_map;
+  grid_level_map_t grid_level_map;
+  ring_map_t ring_map;
+  refresh_t refresh;
+  // local tx queue, sent with a single transfer on each refresh
+  u8 txBuf[MONOME_TX_BUF_LEN];
+  // count of bytes queued
+  u8 txLen;
+  // led levels as last sent to the device, packed like the led buffer
+  u8 ledSent[MONOME_LED_BUF_BYTES];
+  // frames whose device state is unknown (bitfield), sent whole on next refresh
+  u8 frameStale;
+};
+
+
 //// dummy functions
-static void read_serial_dummy(void) { return; }
+static void read_serial_dummy(monomeDev* md) { return; }
 
 //-------------------------------------
 //------ extern variables
 
-// connected flag
-// u8 monomeConnect = 0;
-
-// dirty flags for each quadrant or knob (bitwise)
-u8 monomeFrameDirty = 0;
-// a buffer big enough to hold all l data for 256 or arc4
-// each led gets a full byte
-u8 monomeLedBuffer[MONOME_MAX_LED_BYTES];
-
-// global pointers to send functions.
-read_serial_t monome_read_serial = &read_serial_dummy;
-set_intense_t monome_set_intense;
-// grid_led_t monome_grid_led;
-grid_map_t monome_grid_map;
-grid_level_map_t monome_grid_level_map;
-ring_map_t monome_ring_map;
-refresh_t monome_refresh;
+// dirty flags for each quadrant or knob (bitwise), per device
+u8 monomeFrameDirty[MONOME_MAX_DEVICES];
+// dirty flags for each grid row (bitwise), per device
+u16 monomeRowDirty[MONOME_MAX_DEVICES];
+// per-device buffers big enough to hold all led data for 256 or arc4
+// 4 bits per led, even leds in the high nibble
+u8 monomeLedBuffer[MONOME_MAX_DEVICES][MONOME_LED_BUF_BYTES];
+
 //-----------------------------------------
 //----- static variables
 
-// descriptor for connected device
-static monomeDesc mdesc = {
-  .protocol = eProtocolNumProtocols, // dummy
-  .device = eDeviceNumDevices, // dummy
-  .cols = 0,
-  .rows = 0,
-  .encs = 0,
-  .tilt = 0,
-};
-
-// local rx byte count
-static u8 rxBytes;
-// event data
-static event_t ev;
-// local tx buffer
-static u8 txBuf[MONOME_TX_BUF_LEN];
+// state for each device.
+// rx parsing runs from the usb interrupt and refresh from the main loop,
+// so every protocol function takes its device explicitly.
+static monomeDev mdev[MONOME_MAX_DEVICES];
 
 //---------------------------------------------
 //------ static function declarations
 
 // setup for each protocol
-static void setup_40h(u8 cols, u8 rows);
-static void setup_series(u8 cols, u8 rows);
-static u8 setup_mext(void);
+static void setup_40h(monomeDev* md, u8 cols, u8 rows);
+static void setup_series(monomeDev* md, u8 cols, u8 rows);
+static u8 setup_mext(monomeDev* md);
 
 // rx for each protocol
-static void read_serial_40h(void);
-static void read_serial_series(void);
-static void read_serial_mext(void);
+static void read_serial_40h(monomeDev* md);
+static void read_serial_series(monomeDev* md);
+static void read_serial_mext(monomeDev* md);
 
 
 // set intensity
-static void set_intense_series(u8 level);
-static void set_intense_mext(u8 level);
+static void set_intense_series(monomeDev* md, u8 level);
+static void set_intense_mext(monomeDev* md, u8 level);
 
 
 // tx for each protocol
@@ -121,23 +142,35 @@ static void set_intense_mext(u8 level);
 /* static void grid_led_series(u8 x, u8 y, u8 val); */
 /* static void grid_led_mext(u8 x, u8 y, u8 val); */
 
-static void grid_map_40h(u8 x, u8 y, const u8* data);
-static void grid_map_series(u8 x, u8 y, const u8* data);
-static void grid_map_mext(u8 x, u8 y, const u8* data);
+static void grid_map_40h(monomeDev* md, u8 x, u8 y, const u8* data);
+static void grid_map_series(monomeDev* md, u8 x, u8 y, const u8* data);
+static void grid_map_mext(monomeDev* md, u8 x, u8 y, const u8* data);
+static void grid_map_level_mext(monomeDev* md, u8 x, u8 y, const u8* data);
 
-/// TODO: varibright
-//static void grid_map_level_40h(u8 x, u8 val);
-//static void grid_map_level_series(u8 x, u8 y, u8* data);
-//static void grid_map_level_mext(u8 x, u8 y, const u8* data);
+// queue changes in one quadrant since the last refresh.
+// return 1 if the quadrant is up to date, 0 if the queue filled.
+typedef u8(*grid_diff_t)(monomeDev* md, u8 x, u8 y);
+static u8 grid_diff_map(monomeDev* md, u8 x, u8 y);
+static u8 grid_diff_mext(monomeDev* md, u8 x, u8 y);
 
 //static void ring_set_mext(u8 n, u8 rho, u8 val);
-static void ring_map_mext(u8 n, u8* data);
+static void ring_map_mext(monomeDev* md, u8 n, u8* data);
+static u8 ring_diff_mext(monomeDev* md, u8 n);
+
+// send the tx queue, if anything is in it
+static void monome_tx_flush(monomeDev* md);
+// reset a device's state to disconnected
+static void monome_dev_reset(u8 dev);
+
+// packed led buffer access
+static inline u8 led_get(const u8* buf, u32 idx);
+static inline void led_put(u8* buf, u32 idx, u8 level);
 
 //static void connect_write_event(void);
-static inline void monome_grid_key_write_event( u8 x, u8 y, u8 val);
-static inline void monome_grid_adc_write_event( u8 n, u16 val);
-static inline void monome_ring_enc_write_event( u8 n, u8 val);
-static inline void monome_ring_key_write_event( u8 n, u8 val);
+static inline void monome_grid_key_write_event(monomeDev* md, u8 x, u8 y, u8 val);
+static inline void monome_grid_adc_write_event(monomeDev* md, u8 n, u16 val);
+static inline void monome_ring_enc_write_event(monomeDev* md, u8 n, u8 val);
+static inline void monome_ring_key_write_event(monomeDev* md, u8 n, u8 val);
 
 
 //---------------------------------
@@ -174,12 +207,19 @@ static const grid_map_t gridMapFuncs[eProtocolNumProtocols] = {
   &grid_map_mext,
 };
 
-// grid/level/map
-/* static grid_level_map_t gridMapLevelFuncs[eProtocolNumProtavr32_lib/src/ocols] = { */
-/*   NULL, // unsupported */
-/*   NULL, // unsupported */
-/*   &grid_map_level_mext, */
-/* }; */
+// per-quadrant change detection
+static const grid_diff_t gridDiffFuncs[eProtocolNumProtocols] = {
+  &grid_diff_map,
+  &grid_diff_map,
+  &grid_diff_mext,
+};
+
+// grid/level/map; legacy devices show any nonzero level as on
+static const grid_level_map_t gridMapLevelFuncs[eProtocolNumProtocols] = {
+  &grid_map_40h,
+  &grid_map_series,
+  &grid_map_level_mext,
+};
 
 static const ring_map_t ringMapFuncs[eProtocolNumProtocols] = {
   NULL, // unsupported
@@ -198,19 +238,26 @@ static const refresh_t refreshFuncs[eProtocolNumProtocols] = {
 
 // init
 void init_monome(void) {
-  u32 i;
-  for(i=0; i<MONOME_MAX_LED_BYTES; i++) {
-    monomeLedBuffer[i] = 0;
+  u8 i;
+  for(i=0; i<MONOME_MAX_DEVICES; i++) {
+    mdev[i].idx = i;
+    monome_dev_reset(i);
   }
   //  print_dbg("\r\n finished monome class init");
 }
 
 // determine if FTDI string descriptors match monome device pattern
-u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr) { 
+u8 check_monome_device_desc(u8 dev, char* mstr, char* pstr, char* sstr) { 
   char buf[16];
   u8 matchMan = 0;
   u8 i;
   u8 ret;
+  monomeDev* md;
+
+  if(dev >= MONOME_MAX_DEVICES) {
+    return 0;
+  }
+  md = &(mdev[dev]);
   //-- source strings are unicode so we need to look at every other byte
   // manufacturer
   for(i=0; i<MONOME_MANSTR_LEN; i++) {
@@ -232,10 +279,10 @@ u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr) {
     // didn't match the manufacturer string, but check the serial for DIYs
     if( strncmp(buf, "a40h", 4) == 0) {
       // this is probably an arduinome      
-      mdesc.protocol = eProtocol40h;
-      mdesc.device = eDeviceGrid;
-      mdesc.cols = 8;
-      mdesc.rows = 8;
+      md->desc.protocol = eProtocol40h;
+      md->desc.device = eDeviceGrid;
+      md->desc.cols = 8;
+      md->desc.rows = 8;
       // tilt?
       ret = 1;
     } else {
@@ -249,114 +296,146 @@ u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr) {
     }
     if(buf[3] == 'h') {
       // this is a 40h
-      setup_40h(8, 8);
+      setup_40h(md, 8, 8);
       return 1;
     }
     if( strncmp(buf, "m64-", 4) == 0 ) {
       // series 64
-      setup_series(8, 8);
+      setup_series(md, 8, 8);
       return 1;
     }
     if( strncmp(buf, "m128-", 5) == 0 ) {
       // series 128
-      setup_series(8, 16);
+      setup_series(md, 8, 16);
       return 1;
     }
     if( strncmp(buf, "m256-", 5) == 0 ) {
       // series 256
-      setup_series(16, 16);
+      setup_series(md, 16, 16);
       return 1;
     }
     // if we got here, serial number didn't match series or 40h patterns.
     // so this is probably an extended-protocol device.
     // we need to query for device attributes
-    return setup_mext();
+    return setup_mext(md);
   }
   return 0;
 }
 
-// check dirty flags and refresh leds
-void monome_grid_refresh(void) {
-  // may need to wait after each quad until tx transfer is complete
-  u8 busy = ftdi_tx_busy();
-
-  // check quad 0
-  if( monomeFrameDirty & 0b0001 ) {
-    while( busy ) { busy = ftdi_tx_busy(); }
-    (*monome_grid_map)(0, 0, monomeLedBuffer);
-    monomeFrameDirty &= 0b1110;
-    busy = 1;
-  }
-  // check quad 1
-  if( monomeFrameDirty & 0b0010 ) {
-    if ( mdesc.cols > 8 ) {
-      while( busy ) { busy = ftdi_tx_busy(); }
-      (*monome_grid_map)(8, 0, monomeLedBuffer + 8);
-      monomeFrameDirty &= 0b1101;
-      busy = 1;
-    }
+// forget a device after it is unplugged
+void monome_disconnect(u8 dev) {
+  if(dev < MONOME_MAX_DEVICES) {
+    monome_dev_reset(dev);
   }
-  // check quad 2
-  if( monomeFrameDirty &  0b0100 ) { 
-    if( mdesc.rows > 8 ) {
-      while( busy ) { busy = ftdi_tx_busy(); }
-      (*monome_grid_map)(0, 8, monomeLedBuffer + 128);
-      monomeFrameDirty &= 0b1011;
-      busy = 1;
-    }
+}
+
+// device type at an index
+eMonomeDevice monome_device_type(u8 dev) {
+  if(dev >= MONOME_MAX_DEVICES) {
+    return eDeviceNumDevices;
+  }
+  return mdev[dev].desc.device;
+}
+
+// parse serial input from a device
+void monome_read_serial(u8 dev) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  (*(mdev[dev].read_serial))(&(mdev[dev]));
+}
+
+// set led intensity of a device
+void monome_set_intense(u8 dev, u8 level) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  if(mdev[dev].set_intense != NULL) {
+    (*(mdev[dev].set_intense))(&(mdev[dev]), level);
   }
-  // check quad 3
-  if( monomeFrameDirty & 0b1000 ) {
-    if( (mdesc.rows > 8) && (mdesc.cols > 8) )  {
-      while( busy ) { busy = ftdi_tx_busy(); }
-      (*monome_grid_map)(8, 8, monomeLedBuffer + 136);
-      monomeFrameDirty &= 0b0111;
-      busy = 1;
+}
+
+// refresh a device, grid or arc
+void monome_refresh(u8 dev) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  if(mdev[dev].refresh != NULL) {
+    (*(mdev[dev].refresh))(dev);
+  }
+}
+
+// check dirty flags and refresh leds.
+// changes since the last refresh are queued and sent in one transfer.
+// doesn't wait: if the previous transfer is still going, try again next time.
+void monome_grid_refresh(u8 dev) {
+  u8 q, x, y;
+  grid_diff_t diff;
+  monomeDev* md;
+
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  md = &(mdev[dev]);
+  if( ftdi_tx_busy(dev) ) { return; }
+  diff = gridDiffFuncs[md->desc.protocol];
+  md->txLen = 0;
+
+  for(q=0; q<MONOME_GRID_MAX_FRAMES; q++) {
+    if( monomeFrameDirty[md->idx] & (1 << q) ) {
+      x = (q & 1) ? MONOME_QUAD_LEDS : 0;
+      y = (q & 2) ? MONOME_QUAD_LEDS : 0;
+      if( (x < md->desc.cols) && (y < md->desc.rows) ) {
+	if( !(*diff)(md, x, y) ) {
+	  // queue is full; leave this and later quads dirty
+	  break;
+	}
+      }
+      monomeFrameDirty[md->idx] &= ~(1 << q);
+      md->frameStale &= ~(1 << q);
     }
   }
-  while( busy ) { busy = ftdi_tx_busy(); }
+  // rows are clean once both quads sharing them are
+  if( !(monomeFrameDirty[md->idx] & 0x3) ) { monomeRowDirty[md->idx] &= 0xff00; }
+  if( !(monomeFrameDirty[md->idx] & 0xc) ) { monomeRowDirty[md->idx] &= 0x00ff; }
+  monome_tx_flush(md);
 }
 
 
 // check flags and refresh arc
-void monome_arc_refresh(void) {
-  // may need to wait after each quad until tx transfer is complete
-  u8 busy = ftdi_tx_busy();
+void monome_arc_refresh(u8 dev) {
   u8 i;
+  monomeDev* md;
+
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  md = &(mdev[dev]);
+  if( ftdi_tx_busy(dev) ) { return; }
+  md->txLen = 0;
 
-  for(i=0;i<mdesc.encs;i++) {
-    if(monomeFrameDirty & (1<<i)) {
-      if(i==1) print_dbg("\r\nsecond");
-      while(busy) { busy = ftdi_tx_busy(); }
-      (*monome_ring_map)(i, monomeLedBuffer + (i<<6));
-      monomeFrameDirty &= ~(1<<i);
-      busy = 1;
+  for(i=0;i<md->desc.encs;i++) {
+    if(monomeFrameDirty[md->idx] & (1<<i)) {
+      if( !ring_diff_mext(md, i) ) {
+	break;
+      }
+      monomeFrameDirty[md->idx] &= ~(1<<i);
+      md->frameStale &= ~(1 << i);
     }
   }
-
-  while( busy ) { busy = ftdi_tx_busy(); }
+  monome_tx_flush(md);
 }
 
 
 //---- convert to/from event data
 // connect
-static inline void monome_connect_write_event(void) {
+static inline void monome_connect_write_event(monomeDev* md) {
+  event_t ev;
   u8* data = (u8*)(&(ev.data));
   
   print_dbg("\r\n posting monome connection event. ");
   print_dbg(" device type: ");
-  print_dbg_ulong(mdesc.device);
+  print_dbg_ulong(md->desc.device);
   print_dbg(" cols : ");
-  print_dbg_ulong(mdesc.cols);
+  print_dbg_ulong(md->desc.cols);
   print_dbg(" rows: ");
-  print_dbg_ulong(mdesc.rows);
+  print_dbg_ulong(md->desc.rows);
 
   ev.type = kEventMonomeConnect;
-  ev.type = kEventMonomeConnect;
-  *data++ = (u8)(mdesc.device); 	// device (8bits)
-  *data++ = mdesc.cols;		// width / count
-  *data++ = mdesc.rows;		// height / resolution
-  //  *data = 0; 		// unused
+  *data++ = (u8)(md->desc.device); 	// device (8bits)
+  *data++ = md->desc.cols;		// width / count
+  *data++ = md->desc.rows;		// height / resolution
+  *data = md->idx;		// device index
   event_post(&ev);
 }
 
@@ -368,11 +447,13 @@ void monome_connect_parse_event_data(u32 data, eMonomeDevice *dev, u8* w, u8* h)
 }
 
 // grid key
-static inline void monome_grid_key_write_event(u8 x, u8 y, u8 val) {
+static inline void monome_grid_key_write_event(monomeDev* md, u8 x, u8 y, u8 val) {
+  event_t ev;
   u8* data = (u8*)(&(ev.data));
   data[0] = x;
   data[1] = y;
   data[2] = val;
+  data[3] = md->idx;
   
   /* print_dbg("\r\n monome.c wrote event; x: 0x"); */
   /* print_dbg_hex(x); */
@@ -393,7 +474,7 @@ void monome_grid_key_parse_event_data(u32 data, u8* x, u8* y, u8* val) {
 }
 
 // grid tilt / adc
-static inline void monome_grid_adc_write_event( u8 n, u16 val) {
+static inline void monome_grid_adc_write_event(monomeDev* md, u8 n, u16 val) {
   // TODO
 }
 void monome_grid_adc_parse_event_data(u32 data, u8* n, u16* val) {
@@ -401,10 +482,12 @@ void monome_grid_adc_parse_event_data(u32 data, u8* n, u16* val) {
 }
 
 // ring encoder
-static inline void monome_ring_enc_write_event( u8 n, u8 val) {
+static inline void monome_ring_enc_write_event(monomeDev* md, u8 n, u8 val) {
+  event_t ev;
   u8* data = (u8*)(&(ev.data));
   data[0] = n;
   data[1] = val;
+  data[3] = md->idx;
   
    // print_dbg("\r\n monome.c wrote event; n: 0x"); 
    // print_dbg_hex(n); 
@@ -421,37 +504,53 @@ void monome_ring_enc_parse_event_data(u32 data, u8* n, s8* val) {
 }
 
 // ring press/lift
-static inline void monome_ring_key_write_event( u8 n, u8 val) {
+static inline void monome_ring_key_write_event(monomeDev* md, u8 n, u8 val) {
   // TODO
 }
 void monome_ring_key_parse_event_data(u32 data, u8* n, u8* val) {
   // TODO
 }
 
-// set quadrant refresh flag from pos
-void monome_calc_quadrant_flag(u8 x, u8 y) {
+// source device of any monome event
+u8 monome_event_device(u32 data) {
+  return ((u8*)(&data))[3];
+}
+
+// set quadrant and row refresh flags from pos
+void monome_calc_quadrant_flag(u8 dev, u8 x, u8 y) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  monomeRowDirty[dev] |= (1 << y);
   if(x > 7) {
     if (y > 7) {      
-      monomeFrameDirty |= 0b1000;
+      monomeFrameDirty[dev] |= 0b1000;
     }
     else {
-      monomeFrameDirty |= 0b0010;
+      monomeFrameDirty[dev] |= 0b0010;
     }
   } else {
     if (y > 7) {
-      monomeFrameDirty |= 0b0100;
+      monomeFrameDirty[dev] |= 0b0100;
     }
     else {
-      monomeFrameDirty |= 0b0001;
+      monomeFrameDirty[dev] |= 0b0001;
     }
   } 
   /* print_dbg("\r\n monome_calc_quadrant_flag: 0x"); */
-  /* print_dbg_hex(monomeFrameDirty); */
+  /* print_dbg_hex(monomeFrameDirty[dev]); */
+}
+
+// set given quadrant dirty flag, and flags for its rows
+extern void monome_set_quadrant_flag(u8 dev, u8 q) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  monomeFrameDirty[dev] |= (1 << q);
+  monomeRowDirty[dev] |= (q & 2) ? 0xff00 : 0x00ff;
 }
 
-// set given quadrant dirty flag
-extern void monome_set_quadrant_flag(u8 q) {
-  monomeFrameDirty |= (1 << q);
+// set dirty flags for a whole grid row
+void monome_set_row_flag(u8 dev, u8 y) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  monomeRowDirty[dev] |= (1 << y);
+  monomeFrameDirty[dev] |= (y > 7) ? 0b1100 : 0b0011;
 }
 
 
@@ -467,15 +566,39 @@ u32 monome_xy_idx(u8 x, u8 y) {
 }
 
 // top-level led/set function
-void monome_led_set(u8 x, u8 y, u8 z) {
-  monomeLedBuffer[monome_xy_idx(x, y)] = z;
-  monome_calc_quadrant_flag(x, y);
+void monome_led_set(u8 dev, u8 x, u8 y, u8 z) {
+  monome_led_level_set(dev, x, y, z ? MONOME_LED_MAX_LEVEL : 0);
 }
 
 // top-level led/toggle function
-void monome_led_toggle(u8 x, u8 y) {
-  monomeLedBuffer[monome_xy_idx(x,y)] ^= 0xff;
-  monome_calc_quadrant_flag(x, y);  
+void monome_led_toggle(u8 dev, u8 x, u8 y) {
+  monome_led_level_set(dev, x, y, monome_led_get(dev, x, y) ? 0 : MONOME_LED_MAX_LEVEL);
+}
+
+// top-level led/level/set function
+void monome_led_level_set(u8 dev, u8 x, u8 y, u8 level) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  led_put(monomeLedBuffer[dev], monome_xy_idx(x, y), level);
+  monome_calc_quadrant_flag(dev, x, y);
+}
+
+// get led level
+u8 monome_led_get(u8 dev, u8 x, u8 y) {
+  if(dev >= MONOME_MAX_DEVICES) { return 0; }
+  return led_get(monomeLedBuffer[dev], monome_xy_idx(x, y));
+}
+
+// set led level in an arc ring
+void monome_ring_set(u8 dev, u8 n, u8 rho, u8 level) {
+  if(dev >= MONOME_MAX_DEVICES) { return; }
+  led_put(monomeLedBuffer[dev], (n << 6) | (rho & 63), level);
+  monomeFrameDirty[dev] |= (1 << n);
+}
+
+// get led level in an arc ring
+u8 monome_ring_get(u8 dev, u8 n, u8 rho) {
+  if(dev >= MONOME_MAX_DEVICES) { return 0; }
+  return led_get(monomeLedBuffer[dev], (n << 6) | (rho & 63));
 }
 
 
@@ -483,15 +606,130 @@ void monome_led_toggle(u8 x, u8 y) {
 //------ static function definitions
 
 // set function pointers
-static inline void set_funcs(void) {
+static inline void set_funcs(monomeDev* md) {
   print_dbg("\r\n setting monome functions, protocol idx: ");
-  print_dbg_ulong(mdesc.protocol);
-  monome_read_serial = readSerialFuncs[mdesc.protocol];
-  monome_grid_map = gridMapFuncs[mdesc.protocol];
-  monome_grid_level_map = gridMapFuncs[mdesc.protocol];
-  monome_ring_map = ringMapFuncs[mdesc.protocol];
-  monome_set_intense = intenseFuncs[mdesc.protocol];
-  monome_refresh = refreshFuncs[mdesc.device == eDeviceArc];   // toggle on grid vs arc
+  print_dbg_ulong(md->desc.protocol);
+  md->read_serial = readSerialFuncs[md->desc.protocol];
+  md->grid_map = gridMapFuncs[md->desc.protocol];
+  md->grid_level_map = gridMapLevelFuncs[md->desc.protocol];
+  md->ring_map = ringMapFuncs[md->desc.protocol];
+  md->set_intense = intenseFuncs[md->desc.protocol];
+  md->refresh = refreshFuncs[md->desc.device == eDeviceArc];   // toggle on grid vs arc
+  // device state is unknown, so send everything on the next refresh
+  if(md->desc.device == eDeviceArc) {
+    md->frameStale = (1 << md->desc.encs) - 1;
+  } else {
+    md->frameStale = (1 << MONOME_GRID_MAX_FRAMES) - 1;
+  }
+  monomeFrameDirty[md->idx] = md->frameStale;
+}
+
+// count set bits
+static inline u8 bit_count(u8 b) {
+  u8 n = 0;
+  while(b) {
+    b &= b - 1;
+    n++;
+  }
+  return n;
+}
+
+// reset a device's state to disconnected
+static void monome_dev_reset(u8 dev) {
+  monomeDev* d = &(mdev[dev]);
+  u32 i;
+  d->desc.protocol = eProtocolNumProtocols; // dummy
+  d->desc.device = eDeviceNumDevices; // dummy
+  d->desc.cols = 0;
+  d->desc.rows = 0;
+  d->desc.encs = 0;
+  d->desc.tilt = 0;
+  d->read_serial = &read_serial_dummy;
+  d->set_intense = NULL;
+  d->grid_map = NULL;
+  d->grid_level_map = NULL;
+  d->ring_map = NULL;
+  d->refresh = NULL;
+  d->txLen = 0;
+  d->frameStale = 0;
+  for(i=0; i<MONOME_LED_BUF_BYTES; i++) {
+    monomeLedBuffer[dev][i] = 0;
+    d->ledSent[i] = 0;
+  }
+  monomeFrameDirty[dev] = 0;
+  monomeRowDirty[dev] = 0;
+}
+
+// send the tx queue
+static void monome_tx_flush(monomeDev* md) {
+  if(md->txLen > 0) {
+    ftdi_write(md->idx, md->txBuf, md->txLen);
+  }
+}
+
+// get one led level from a packed buffer
+static inline u8 led_get(const u8* buf, u32 idx) {
+  return (idx & 1) ? (buf[idx >> 1] & 0xf) : (buf[idx >> 1] >> 4);
+}
+
+// set one led level in a packed buffer
+static inline void led_put(u8* buf, u32 idx, u8 level) {
+  u8* p = buf + (idx >> 1);
+  if(level > MONOME_LED_MAX_LEVEL) { level = MONOME_LED_MAX_LEVEL; }
+  if(idx & 1) {
+    *p = (*p & 0xf0) | level;
+  } else {
+    *p = (*p & 0x0f) | (level << 4);
+  }
+}
+
+// byte offset of a grid position in the packed buffer. x must be even.
+static inline u32 led_packed_off(u8 x, u8 y) {
+  return (y * MONOME_LED_ROW_PACKED_BYTES) + (x >> 1);
+}
+
+// 8 packed levels to on/off bits (level > 0), first led in bit 0
+static u8 row_on_bits(const u8* p) {
+  u8 b = 0;
+  u8 j;
+  for(j=0; j<(MONOME_QUAD_LEDS >> 1); j++) {
+    b |= ((p[j] & 0xf0) != 0) << (j << 1);
+    b |= ((p[j] & 0x0f) != 0) << ((j << 1) + 1);
+  }
+  return b;
+}
+
+// 8 packed levels to full-brightness bits
+static u8 row_full_bits(const u8* p) {
+  u8 b = 0;
+  u8 j;
+  for(j=0; j<(MONOME_QUAD_LEDS >> 1); j++) {
+    b |= ((p[j] & 0xf0) == 0xf0) << (j << 1);
+    b |= ((p[j] & 0x0f) == 0x0f) << ((j << 1) + 1);
+  }
+  return b;
+}
+
+// bits for the leds that differ between two rows of 8 packed levels
+static u8 row_diff_bits(const u8* a, const u8* b) {
+  u8 d = 0;
+  u8 j, x;
+  for(j=0; j<(MONOME_QUAD_LEDS >> 1); j++) {
+    x = a[j] ^ b[j];
+    d |= ((x & 0xf0) != 0) << (j << 1);
+    d |= ((x & 0x0f) != 0) << ((j << 1) + 1);
+  }
+  return d;
+}
+
+// copy one quadrant of packed levels between buffers
+static inline void quad_copy(u8* dst, const u8* src) {
+  u8 i;
+  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+    memcpy(dst, src, MONOME_QUAD_LEDS >> 1);
+    dst += MONOME_LED_ROW_PACKED_BYTES;
+    src += MONOME_LED_ROW_PACKED_BYTES;
+  }
 }
 
 /////////////////////////////////////////////////////
@@ -503,59 +741,60 @@ static inline void set_funcs(void) {
 // setup
 
 // setup 40h-protocol device
-static void setup_40h(u8 cols, u8 rows) {
+static void setup_40h(monomeDev* md, u8 cols, u8 rows) {
   print_dbg("\r\n setup 40h device");
-  mdesc.protocol = eProtocol40h;
-  mdesc.device = eDeviceGrid;
-  mdesc.cols = 8;
-  mdesc.rows = 8;
-  set_funcs();
-  monome_connect_write_event();
+  md->desc.protocol = eProtocol40h;
+  md->desc.device = eDeviceGrid;
+  md->desc.cols = 8;
+  md->desc.rows = 8;
+  set_funcs(md);
+  monome_connect_write_event(md);
 }
 
 // setup series device
-static void setup_series(u8 cols, u8 rows) {
+static void setup_series(monomeDev* md, u8 cols, u8 rows) {
   print_dbg("\r\n setup series device");
-  mdesc.protocol = eProtocolSeries;
-  mdesc.device = eDeviceGrid;
-  mdesc.cols = 8;
-  mdesc.rows = 8;
-  mdesc.tilt = 1;
-  set_funcs();
-  monome_connect_write_event();
+  md->desc.protocol = eProtocolSeries;
+  md->desc.device = eDeviceGrid;
+  md->desc.cols = 8;
+  md->desc.rows = 8;
+  md->desc.tilt = 1;
+  set_funcs(md);
+  monome_connect_write_event(md);
   //  monomeConnect = 1;
   //  test_draw();
 }
 
 // setup extended device, return success /failure of query
-static u8 setup_mext(void) {
+static u8 setup_mext(monomeDev* md) {
   u8* prx;
   u8 w = 0;
   u8 busy;
+  u8 rxBytes;
 
   print_dbg("\r\n setup mext device");
-  mdesc.protocol = eProtocolMext;
+  md->desc.protocol = eProtocolMext;
 
   // FIXME: fuck these delays
   delay_ms(1);
-  ftdi_write(&w, 1);	// query  
+  ftdi_write(md->idx, &w, 1);	// query  
 
   delay_ms(1);
-  ftdi_read();
+  ftdi_read(md->idx);
 
   delay_ms(1);
   busy = 1;
 
   print_dbg("\r\n setup request ftdi read; waiting...");
 
-  //  while(ftdi_rx_busy()) {;;}
+  //  while(ftdi_rx_busy(md->idx)) {;;}
   while(busy) {
-    busy = ftdi_rx_busy();
+    busy = ftdi_rx_busy(md->idx);
     print_dbg("\r\n waiting for transfer complete; busy flag: ");
     print_dbg_ulong(busy);
     
   }
-  rxBytes = ftdi_rx_bytes();
+  rxBytes = ftdi_rx_bytes(md->idx);
 
   print_dbg(" done waiting. bytes read: ");
   print_dbg_ulong(rxBytes);
@@ -564,34 +803,34 @@ static u8 setup_mext(void) {
     print_dbg("\r\n got unexpected byte count in response to mext setup request; ");
   }
   
-  prx = ftdi_rx_buf();
+  prx = ftdi_rx_buf(md->idx);
   prx++; // 1st returned byte is 0
   if(*prx == 1) {
-    mdesc.device = eDeviceGrid;
+    md->desc.device = eDeviceGrid;
     prx++;
     if(*prx == 1) {
       print_dbg("\r\n monome 64");
-      mdesc.rows = 8;
-      mdesc.cols = 8;
+      md->desc.rows = 8;
+      md->desc.cols = 8;
     }
     else if(*prx == 2) {
       print_dbg("\r\n monome 128");
-      mdesc.rows = 8;
-      mdesc.cols = 16;
+      md->desc.rows = 8;
+      md->desc.cols = 16;
     }
     else if(*prx == 4) {
       print_dbg("\r\n monome 256");
-      mdesc.rows = 16; 
-      mdesc.cols = 16;
+      md->desc.rows = 16; 
+      md->desc.cols = 16;
     }
     else {
       return 0; // bail
     }		
-    mdesc.tilt = 1;
+    md->desc.tilt = 1;
   }
   else if(*prx == 5) {
-    mdesc.device = eDeviceArc;
-    mdesc.encs = *(++prx);
+    md->desc.device = eDeviceArc;
+    md->desc.encs = *(++prx);
     print_dbg("\r\n monome arc ");
     print_dbg_ulong(*prx);
   } else {
@@ -600,9 +839,9 @@ static u8 setup_mext(void) {
     print_dbg_hex(*(++prx));
     return 0; // bail
   }
-  set_funcs();
+  set_funcs(md);
 
-  monome_connect_write_event();
+  monome_connect_write_event(md);
   //  monomeConnect = 1;
   print_dbg("\r\n connected monome device, mext protocol");
   //  test_draw();
@@ -616,10 +855,11 @@ static u8 setup_mext(void) {
 /// should be called when read is complete
 /// (e.g. from usb transfer callback )
 
-static void read_serial_40h(void) {
-  u8* prx = ftdi_rx_buf();
+static void read_serial_40h(monomeDev* md) {
+  u8 rxBytes;
+  u8* prx = ftdi_rx_buf(md->idx);
   u8 i;
-  rxBytes = ftdi_rx_bytes();
+  rxBytes = ftdi_rx_bytes(md->idx);
   // print_dbg("\r\n read_serial_40h, byte count: ");
   // print_dbg_ulong(rxBytes);
   // print_dbg(" ; data : [ 0x");
@@ -639,7 +879,7 @@ static void read_serial_40h(void) {
 
     // press event
     if ((prx[0] & 0xf0) == 0) {
-      monome_grid_key_write_event( 
+      monome_grid_key_write_event(md, 
         ((prx[1] & 0xf0) >> 4),
         prx[1] & 0xf,
         ((prx[0] & 0xf) != 0)
@@ -651,10 +891,11 @@ static void read_serial_40h(void) {
   }
 }
 
-static void read_serial_series(void) {
-  u8* prx = ftdi_rx_buf();
+static void read_serial_series(monomeDev* md) {
+  u8 rxBytes;
+  u8* prx = ftdi_rx_buf(md->idx);
   u8 i;
-  rxBytes = ftdi_rx_bytes();
+  rxBytes = ftdi_rx_bytes(md->idx);
   print_dbg("\r\n read_serial_series, byte count: ");
   print_dbg_ulong(rxBytes);
   print_dbg(" ; data : [ 0x");
@@ -673,7 +914,7 @@ static void read_serial_series(void) {
     /* print_dbg_hex(	 ((prx[0] & 0xf0) == 0) ); */
     
     // process consecutive pairs of bytes
-    monome_grid_key_write_event( ((prx[1] & 0xf0) >> 4) ,
+    monome_grid_key_write_event(md, ((prx[1] & 0xf0) >> 4) ,
 				 prx[1] & 0xf,
 				 ((prx[0] & 0xf0) == 0)
 				 );
@@ -683,41 +924,42 @@ static void read_serial_series(void) {
 
 }
 
-static void read_serial_mext(void) {
+static void read_serial_mext(monomeDev* md) {
+  u8 rxBytes;
   //  static u8 nbr; // number of bytes read
   static u8 nbp; // number of bytes processed
   static u8* prx; // pointer to rx buf
   static u8 com;
   
-  rxBytes = ftdi_rx_bytes();
+  rxBytes = ftdi_rx_bytes(md->idx);
   if( rxBytes ) {
     nbp = 0;
-    prx = ftdi_rx_buf();
+    prx = ftdi_rx_buf(md->idx);
     while(nbp < rxBytes) {
       com = (u8)(*(prx++));    
       nbp++;
       switch(com) {
       case 0x20: // grid key up
-	monome_grid_key_write_event( *prx, *(prx+1), 0);
+	monome_grid_key_write_event(md, *prx, *(prx+1), 0);
 	nbp += 2;
 	prx += 2;
 	break;
       case 0x21: // grid key down
-	monome_grid_key_write_event( *prx, *(prx+1), 1);
+	monome_grid_key_write_event(md, *prx, *(prx+1), 1);
 	nbp += 2;
 	prx += 2;
 	break;
 	case 0x50: // ring delta
-	monome_ring_enc_write_event( *prx, *(prx+1));
+	monome_ring_enc_write_event(md, *prx, *(prx+1));
 	nbp += 2;
 	prx += 2;
 	break;
       case 0x51 : // ring key up
-	monome_ring_key_write_event( *prx++, 0);
+	monome_ring_key_write_event(md, *prx++, 0);
 	prx++;
 	break;
       case 0x52 : // ring key down
-	monome_ring_key_write_event( *prx++, 1);
+	monome_ring_key_write_event(md, *prx++, 1);
 	nbp++;
 	break;
 	/// TODO: more commands... 
@@ -737,132 +979,310 @@ static void read_serial_mext(void) {
 
 /* static void grid_led_series(u8 x, u8 y, u8 val) { */
 /*   //  static u8 tx[2]; */
-/*   txBuf[0] = 0x20 & ((val > 0) << 4); */
-/*   txBuf[1] = (x << 4) | y; */
-/*   ftdi_write(txBuf, 2); */
+/*   md->txBuf[0] = 0x20 & ((val > 0) << 4); */
+/*   md->txBuf[1] = (x << 4) | y; */
+/*   ftdi_write(md->idx, md->txBuf, 2); */
 /* } */
 
 /* static void grid_led_mext(u8 x, u8 y, u8 val) { */
 /*   //  static u8 tx[3]; */
-/*   txBuf[0] = 0x10 | (val > 0); */
-/*   txBuf[1] = x; */
-/*   txBuf[2] = y; */
-/*   ftdi_write(txBuf, 3); */
+/*   md->txBuf[0] = 0x10 | (val > 0); */
+/*   md->txBuf[1] = x; */
+/*   md->txBuf[2] = y; */
+/*   ftdi_write(md->idx, md->txBuf, 3); */
 /* } */
 
-// update a whole frame
-// . note that our input data is one byte per led!!
-// this will hopefully help optimize operator routines,
-// which cannot be called less often than refresh/tx, and are therefore prioritized.
-static void grid_map_mext( u8 x, u8 y, const u8* data ) {
-  //  static u8 tx[11] = { 0x14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+// update a whole frame, on/off.
+// input data is the packed level buffer at the quad origin; any nonzero level is on.
+static void grid_map_mext(monomeDev* md, u8 x, u8 y, const u8* data) {
   static u8* ptx;
-  static u8 i, j;
+  static u8 i;
 
-  txBuf[0] = 0x14;
-  txBuf[1] = x;
-  txBuf[2] = y;
-  
-  ptx = txBuf + 3;
+  ptx = md->txBuf + md->txLen;
+  *ptx++ = 0x14;
+  *ptx++ = x;
+  *ptx++ = y;
   
-  // copy and convert
   for(i=0; i<MONOME_QUAD_LEDS; i++) {
-    *ptx = 0;
-    for(j=0; j<MONOME_QUAD_LEDS; j++) {
-      // binary value of data byte to bitfield of tx byte
-      *ptx |= ((*data > 0) << j);
-      data++;
-    }
-    data += MONOME_QUAD_LEDS; // skip the rest of the row to get back in target quad
-    ptx++;
+    *ptx++ = row_on_bits(data);
+    data += MONOME_LED_ROW_PACKED_BYTES;
   }
-  ftdi_write(txBuf, MONOME_QUAD_LEDS + 3);
+  md->txLen += MEXT_MAP_BYTES;
 }
 
+// update a whole frame, 4-bit levels.
+// the buffer is already packed in wire order, so rows are copied straight out.
+static void grid_map_level_mext(monomeDev* md, u8 x, u8 y, const u8* data) {
+  static u8* ptx;
+  static u8 i;
 
-static void grid_map_40h(u8 x, u8 y, const u8* data) {
-  // print_dbg("\n\r=== grid_map_40h ===");
-  static u8 i, j;
+  ptx = md->txBuf + md->txLen;
+  *ptx++ = 0x1a;
+  *ptx++ = x;
+  *ptx++ = y;
+
+  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+    memcpy(ptx, data, MONOME_QUAD_LEDS >> 1);
+    ptx += MONOME_QUAD_LEDS >> 1;
+    data += MONOME_LED_ROW_PACKED_BYTES;
+  }
+  md->txLen += MEXT_MAP_LEVEL_BYTES;
+}
+
+static void grid_map_40h(monomeDev* md, u8 x, u8 y, const u8* data) {
+  static u8 i;
+  static u8* ptx;
   // ignore all but first quadrant -- do any devices larger than 8x8 speak 40h?
   if (x != 0 || y != 0) {
     return;
   }
+  ptx = md->txBuf + md->txLen;
   for(i=0; i<MONOME_QUAD_LEDS; i++) {
     // led row command + row number
-    txBuf[(i*2)] = 0x70 + i;
-    txBuf[(i*2)+1] = 0;
-    // print_dbg("\r\n * data bytes: ");
-    for(j=0; j<MONOME_QUAD_LEDS; j++) {
-      // set row bit if led should be on
-      // print_dbg("0x");
-      // print_dbg_hex(*data);
-      // print_dbg(" ");
-      txBuf[(i*2)+1] |= ((*data > 0) << j);
-      // advance data to next bit
-      ++data;
-    }
-    // skip next 8 bytes to get to next row
-    data += MONOME_QUAD_LEDS;
-    // print_dbg("\n\r 40h: send led_row command: ");
-    // print_dbg_hex(txBuf[i*2]);
-    // print_dbg(" row data: 0x");
-    // print_dbg_hex(txBuf[(i*2) + 1]);
+    ptx[(i*2)] = 0x70 + i;
+    // set row bit if led should be on
+    ptx[(i*2)+1] = row_on_bits(data);
+    data += MONOME_LED_ROW_PACKED_BYTES;
   }
-  ftdi_write(txBuf, 16);
+  md->txLen += 16;
 }
 
-static void grid_map_series(u8 x, u8 y, const u8* data) {
+static void grid_map_series(monomeDev* md, u8 x, u8 y, const u8* data) {
   static u8 * ptx;
-  static u8 i, j;
+  static u8 i;
+  // pointer to tx data
+  ptx = md->txBuf + md->txLen;
   // command (upper nibble)
-  txBuf[0] = 0x80;
+  *ptx = 0x80;
   // quadrant index (lower nibble, 0-3)
-  txBuf[0] |= ( (x > 8) | ((y > 8) << 1) );
-
-  // pointer to tx data
-  ptx = txBuf + 1;
+  *ptx |= ( (x > 7) | ((y > 7) << 1) );
+  ++ptx;
   
-  // copy and convert
   for(i=0; i<MONOME_QUAD_LEDS; i++) {
-    *ptx = 0;
-    for(j=0; j<MONOME_QUAD_LEDS; j++) {
-      // binary value of data byte to bitfield of tx byte
-      *ptx |= ((*data > 0) << j);
-      ++data;
+    *ptx++ = row_on_bits(data);
+    data += MONOME_LED_ROW_PACKED_BYTES;
+  }
+  md->txLen += MONOME_QUAD_LEDS + 1;
+}
+
+// legacy protocols only have whole-quadrant maps; send one if anything changed.
+static u8 grid_diff_map(monomeDev* md, u8 x, u8 y) {
+  u32 off = led_packed_off(x, y);
+  u8 i;
+  u8 changed = md->frameStale & (1 << ((x > 7) | ((y > 7) << 1)));
+  const u8* cur = monomeLedBuffer[md->idx] + off;
+  const u8* sent = md->ledSent + off;
+
+  for(i=0; i<MONOME_QUAD_LEDS && !changed; i++) {
+    if( (monomeRowDirty[md->idx] & (1 << (y + i)))
+	&& (row_on_bits(cur) != row_on_bits(sent)) ) {
+      changed = 1;
     }
-    data += MONOME_QUAD_LEDS; // skip the rest of the row to get back in target quad
-    ++ptx;
+    cur += MONOME_LED_ROW_PACKED_BYTES;
+    sent += MONOME_LED_ROW_PACKED_BYTES;
   }
-  ftdi_write(txBuf, MONOME_QUAD_LEDS + 1);  
+  if(!changed) { return 1; }
+  // biggest legacy map is 16 bytes
+  if( (md->txLen + 16) > MONOME_TX_BUF_LEN ) { return 0; }
+  (*(md->grid_map))(md, x, y, monomeLedBuffer[md->idx] + off);
+  quad_copy(md->ledSent + off, monomeLedBuffer[md->idx] + off);
+  return 1;
 }
 
-/* static void grid_map_level_mext(u8 x, u8 y, const u8* data) { */
-/*   // TODO */
-/* } */
+// compare the dirty rows of a quadrant against what the device has,
+// and queue whichever of led / row / col / map messages is smallest.
+// on/off messages are used wherever all the leds involved are off or full,
+// so binary content costs the same as it would without levels.
+static u8 grid_diff_mext(monomeDev* md, u8 x, u8 y) {
+  u32 off = led_packed_off(x, y);
+  const u8* cur = monomeLedBuffer[md->idx] + off;
+  const u8* sent = md->ledSent + off;
+  u8 stale = md->frameStale & (1 << ((x > 7) | ((y > 7) << 1)));
+  // on bits, full-brightness bits and changed bits per row
+  u8 on[MONOME_QUAD_LEDS];
+  u8 full[MONOME_QUAD_LEDS];
+  u8 diff[MONOME_QUAD_LEDS];
+  // columns with changes, and columns with partial levels
+  u8 colMask = 0;
+  u8 colLevel = 0;
+  u16 costLed = 0;
+  u16 costRow = 0;
+  u16 costCol = 0;
+  u16 costMap = MEXT_MAP_BYTES;
+  u16 cost;
+  u8 i, j, l;
+  u8* ptx;
 
-static void ring_map_mext(u8 n, u8* data) {
-  //  static u8 tx[11] = { 0x14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+    on[i] = row_on_bits(cur);
+    full[i] = row_full_bits(cur);
+    if(stale) {
+      diff[i] = 0xff;
+    } else if( monomeRowDirty[md->idx] & (1 << (y + i)) ) {
+      diff[i] = row_diff_bits(cur, sent);
+    } else {
+      diff[i] = 0;
+    }
+    if(on[i] != full[i]) {
+      colLevel |= on[i] ^ full[i];
+      costMap = MEXT_MAP_LEVEL_BYTES;
+    }
+    if(diff[i]) {
+      colMask |= diff[i];
+      // single leds: level message only for partial levels
+      costLed += bit_count(diff[i]) * MEXT_LED_BYTES
+	+ bit_count(diff[i] & (on[i] ^ full[i])) * (MEXT_LED_LEVEL_BYTES - MEXT_LED_BYTES);
+      costRow += (on[i] == full[i]) ? MEXT_ROW_BYTES : MEXT_ROW_LEVEL_BYTES;
+    }
+    cur += MONOME_LED_ROW_PACKED_BYTES;
+    sent += MONOME_LED_ROW_PACKED_BYTES;
+  }
+  if(colMask == 0) { return 1; }
+
+  costCol = bit_count(colMask & ~colLevel) * MEXT_COL_BYTES
+    + bit_count(colMask & colLevel) * MEXT_COL_LEVEL_BYTES;
+  cost = costMap;
+  if(costLed < cost) { cost = costLed; }
+  if(costRow < cost) { cost = costRow; }
+  if(costCol < cost) { cost = costCol; }
+
+  if( (md->txLen + cost) > MONOME_TX_BUF_LEN ) { return 0; }
+  ptx = md->txBuf + md->txLen;
+  cur = monomeLedBuffer[md->idx] + off;
+
+  if(cost == costLed) {
+    // /grid/led/set, /grid/led/clear, or /grid/led/level/set
+    for(i=0; i<MONOME_QUAD_LEDS; i++) {
+      for(j=0; j<MONOME_QUAD_LEDS; j++) {
+	if( diff[i] & (1 << j) ) {
+	  l = led_get(cur, j);
+	  if( (l == 0) || (l == MONOME_LED_MAX_LEVEL) ) {
+	    *ptx++ = 0x10 | (l != 0);
+	    *ptx++ = x + j;
+	    *ptx++ = y + i;
+	  } else {
+	    *ptx++ = 0x18;
+	    *ptx++ = x + j;
+	    *ptx++ = y + i;
+	    *ptx++ = l;
+	  }
+	}
+      }
+      cur += MONOME_LED_ROW_PACKED_BYTES;
+    }
+    md->txLen += cost;
+  } else if(cost == costRow) {
+    // /grid/led/row or /grid/led/level/row, 8 leds from x offset
+    for(i=0; i<MONOME_QUAD_LEDS; i++) {
+      if(diff[i]) {
+	if(on[i] == full[i]) {
+	  *ptx++ = 0x15;
+	  *ptx++ = x;
+	  *ptx++ = y + i;
+	  *ptx++ = on[i];
+	} else {
+	  *ptx++ = 0x1b;
+	  *ptx++ = x;
+	  *ptx++ = y + i;
+	  memcpy(ptx, cur, MONOME_QUAD_LEDS >> 1);
+	  ptx += MONOME_QUAD_LEDS >> 1;
+	}
+      }
+      cur += MONOME_LED_ROW_PACKED_BYTES;
+    }
+    md->txLen += cost;
+  } else if(cost == costCol) {
+    // /grid/led/col or /grid/led/level/col, 8 leds from y offset
+    for(j=0; j<MONOME_QUAD_LEDS; j++) {
+      if(colMask & (1 << j)) {
+	if(colLevel & (1 << j)) {
+	  *ptx++ = 0x1c;
+	  *ptx++ = x + j;
+	  *ptx++ = y;
+	  for(i=0; i<MONOME_QUAD_LEDS; i+=2) {
+	    *ptx++ = (led_get(cur + (i * MONOME_LED_ROW_PACKED_BYTES), j) << 4)
+	      | led_get(cur + ((i + 1) * MONOME_LED_ROW_PACKED_BYTES), j);
+	  }
+	} else {
+	  *ptx++ = 0x16;
+	  *ptx++ = x + j;
+	  *ptx++ = y;
+	  *ptx = 0;
+	  for(i=0; i<MONOME_QUAD_LEDS; i++) {
+	    *ptx |= ((on[i] >> j) & 1) << i;
+	  }
+	  ptx++;
+	}
+      }
+    }
+    md->txLen += cost;
+  } else if(costMap == MEXT_MAP_BYTES) {
+    // /grid/led/map
+    grid_map_mext(md, x, y, cur);
+  } else {
+    // /grid/led/level/map
+    grid_map_level_mext(md, x, y, cur);
+  }
+
+  quad_copy(md->ledSent + off, monomeLedBuffer[md->idx] + off);
+  return 1;
+}
+
+// whole ring, 4-bit levels; the buffer is already packed in wire order.
+static void ring_map_mext(monomeDev* md, u8 n, u8* data) {
   static u8* ptx;
-  static u8 i;
 
-  txBuf[0] = 0x92;
-  txBuf[1] = n;
-  
-  ptx = txBuf + 2;
-  
-  // smash 64 LEDs together, nibbles
-  for(i=0; i<32; i++) {
-    *ptx = *data << 4;
-    data++;
-    *ptx |= *data;
-    data++;
-    ptx++;
-  }
+  ptx = md->txBuf + md->txLen;
+  *ptx++ = 0x92;
+  *ptx++ = n;
+  memcpy(ptx, data, MONOME_RING_MAP_SIZE);
+
+  md->txLen += MEXT_RING_MAP_BYTES;
+}
+
+// compare a ring against what the device has,
+// and queue either single-led sets or a whole ring map.
+// return 1 if the ring is up to date, 0 if the queue filled.
+static u8 ring_diff_mext(monomeDev* md, u8 n) {
+  u32 off = n * MONOME_RING_MAP_SIZE;
+  u8* cur = monomeLedBuffer[md->idx] + off;
+  u8* sent = md->ledSent + off;
+  u8 stale = md->frameStale & (1 << n);
+  u8 nLeds = 0;
+  u8 i;
+  u8* ptx;
 
-  ftdi_write(txBuf, 32 + 2);
+  if(stale) {
+    nLeds = MONOME_RING_LEDS;
+  } else {
+    for(i=0; i<MONOME_RING_MAP_SIZE; i+=4) {
+      nLeds += bit_count(row_diff_bits(cur + i, sent + i));
+    }
+  }
+  if(nLeds == 0) { return 1; }
+
+  if( (nLeds * MEXT_RING_SET_BYTES) < MEXT_RING_MAP_BYTES ) {
+    if( (md->txLen + (nLeds * MEXT_RING_SET_BYTES)) > MONOME_TX_BUF_LEN ) { return 0; }
+    // /ring/set n x level
+    ptx = md->txBuf + md->txLen;
+    for(i=0; i<MONOME_RING_LEDS; i++) {
+      if(led_get(cur, i) != led_get(sent, i)) {
+	*ptx++ = 0x90;
+	*ptx++ = n;
+	*ptx++ = i;
+	*ptx++ = led_get(cur, i);
+      }
+    }
+    md->txLen += nLeds * MEXT_RING_SET_BYTES;
+  } else {
+    if( (md->txLen + MEXT_RING_MAP_BYTES) > MONOME_TX_BUF_LEN ) { return 0; }
+    ring_map_mext(md, n, cur);
+  }
+  memcpy(sent, cur, MONOME_RING_MAP_SIZE);
+  return 1;
 }
 
-static void set_intense_series(u8 v) {
+static void set_intense_series(monomeDev* md, u8 v) {
 /*
 message id:	(10) intensity
 bytes:		1
@@ -871,11 +1291,14 @@ format:		iiiibbbb
 			b (brightness) = 0-15 (4 bits)
 encode:		byte 0 = ((id) << 4) | b = 160 + b
 */
-  txBuf[0] = 0xa0;
-  txBuf[0] |= (v & 0x0f);
-  ftdi_write(txBuf, 1);
+  md->txBuf[0] = 0xa0;
+  md->txBuf[0] |= (v & 0x0f);
+  ftdi_write(md->idx, md->txBuf, 1);
 }
 
-static void set_intense_mext(u8 v) {
-  // TODO
+static void set_intense_mext(monomeDev* md, u8 v) {
+  // /grid/led/intensity
+  md->txBuf[0] = 0x17;
+  md->txBuf[1] = v & 0x0f;
+  ftdi_write(md->idx, md->txBuf, 2);
 }
@@ -17,6 +17,7 @@
 #include "print_funcs.h"
 #include "spi.h"
 // aleph
+#include "adc.h"
 #include "aleph_board.h"
 //#include "conf_aleph.h"
 #include "fix.h"
@@ -42,11 +43,13 @@ static u32 nb; // count of destination bytes
 
 static void write_command(U8 c);
 static void write_command(U8 c) {
+  adc_bus_lock();
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // pull register select low to write a command
   gpio_clr_gpio_pin(OLED_REGISTER_PIN);
   spi_write(OLED_SPI, c);
   spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
+  adc_bus_unlock();
 }
 
 // set the current drawing area of the physical screen (hopefully)
@@ -173,6 +176,7 @@ void init_oled(void) {
   // set drawing region
   screen_set_rect(x, y, w, h);
   // select chip for data
+  adc_bus_lock();
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // register select high for data
   gpio_set_gpio_pin(OLED_REGISTER_PIN);
@@ -181,6 +185,7 @@ void init_oled(void) {
     spi_write(OLED_SPI, screenBuf[i]);
   }
   spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
+  adc_bus_unlock();
 }
 
 // draw data at given rectangle, with starting byte offset within the region data.
@@ -226,6 +231,7 @@ void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 of
   // set drawing region
   screen_set_rect(x, y, w, h);
   // select chip for data
+  adc_bus_lock();
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // register select high for data
   gpio_set_gpio_pin(OLED_REGISTER_PIN);
@@ -234,11 +240,13 @@ void screen_draw_region_offset(u8 x, u8 y, u8 w, u8 h, u32 len, u8* data, u32 of
     spi_write(OLED_SPI, screenBuf[i]);
   }
   spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
+  adc_bus_unlock();
 }
 
 
  // clear OLED RAM and local screenbuffer
 void screen_clear(void) {
+  adc_bus_lock();
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // pull register select high to write data
   gpio_set_gpio_pin(OLED_REGISTER_PIN);
@@ -247,6 +255,7 @@ void screen_clear(void) {
     spi_write(OLED_SPI, 0);
   }
   spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
+  adc_bus_unlock();
 }
 
 
@@ -264,6 +273,7 @@ void screen_startup(void) {
   }
 
   // send screenbuffer
+  adc_bus_lock();
   spi_selectChip(OLED_SPI, OLED_SPI_NPCS);
   // register select high for data
   gpio_set_gpio_pin(OLED_REGISTER_PIN);
@@ -272,7 +282,8 @@ void screen_startup(void) {
     spi_write(OLED_SPI, screenBuf[i]);
   }
 
-  spi_unselectChip(OLED_SPI, OLED_SPI_NPCS); 
+  spi_unselectChip(OLED_SPI, OLED_SPI_NPCS);
+  adc_bus_unlock();
 
   /// draw the glyph
   screen_draw_region(128-24 - 1, 64-32 - 1, 24, 32, (u8*)aleph_hebrew_glyph);
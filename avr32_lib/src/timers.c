@@ -1,64 +1,172 @@
 /* timers.c
  * aleph-avr32
  *
- * ultra-simple software timers.
+ * software timers in a hierarchical timing wheel.
+ *
+ * the first level has one slot per tick for the next 256 ticks.
+ * each further level has 64 slots, each covering a whole turn of the level below.
+ * when a level wraps, the current slot of the next level up is cascaded down.
+ * slot lists are circular and doubly linked, so a timer can be unlinked directly.
  */
 
 // asf
+#include "compiler.h"
 #include "print_funcs.h"
+#include "tc.h"
 // aleph-avr32
+#include "aleph_board.h"
 #include "conf_tc_irq.h"
 #include "timers.h"
 
+//-----------------------------------------------
+//---- defines
+
+// slot counts
+#define WHEEL_BITS_0 8
+#define WHEEL_BITS_N 6
+#define WHEEL_SIZE_0 (1 << WHEEL_BITS_0)
+#define WHEEL_SIZE_N (1 << WHEEL_BITS_N)
+#define WHEEL_MASK_0 (WHEEL_SIZE_0 - 1)
+#define WHEEL_MASK_N (WHEEL_SIZE_N - 1)
+// count of levels above the first
+#define WHEEL_LEVELS_N 3
+// total slots, plus one holding timers being fired
+#define WHEEL_SLOTS (WHEEL_SIZE_0 + (WHEEL_LEVELS_N * WHEEL_SIZE_N))
+#define WHEEL_SLOT_RUN WHEEL_SLOTS
+// longest interval the wheel can hold
+#define WHEEL_MAX_TICKS ((1 << (WHEEL_BITS_0 + (WHEEL_LEVELS_N * WHEEL_BITS_N))) - 1)
+
+// cpu cycle counter for isr accounting
+#define TIMERS_CYCLES() Get_system_register(AVR32_COUNT)
+// position within the current tick from the TC counter, in 1/65536 ticks
+#define TIMERS_PHASE() ( ((u32)tc_read_tc(APP_TC, APP_TC_CHANNEL) << 16) / APP_TC_RC )
+// ticks per millisecond, with 32 fractional bits.
+// corrects for the truncation of the compare value, which would otherwise drift.
+#define TIMERS_TICKS_PER_MS ( ((u64)FPBA_HZ << 32) / ((u64)APP_TC_CAL_HZ * APP_TC_RC) )
+
 //-----------------------------------------------
 //---- static variables
 
-// store timers in a simple one-way linked list.
-// FIXME: remove() would be faster with two-way list.
-// top of list
-softTimer_t* top = NULL;
-// size of list
-u32 num = 0;
+// slot list heads
+static softTimer_t* wheel[WHEEL_SLOTS + 1];
+// next tick to process
+static u32 wheelTicks = 0;
+// timer whose callback is running, cleared if it removes itself
+static softTimer_t* running = NULL;
+// statistics
+static timerStats_t stats;
 
-//------------------------------
-//--- extern functions
+//-----------------------------------------------
+//---- static functions
 
-void init_timers(void) {
-  ;; // nothing to do
+// link a timer at the tail of a slot list
+static inline void slot_push(softTimer_t* t, u16 slot) {
+  softTimer_t* head = wheel[slot];
+  t->slot = slot;
+  if(head == NULL) {
+    t->next = t;
+    t->prev = t;
+    wheel[slot] = t;
+  } else {
+    t->next = head;
+    t->prev = head->prev;
+    head->prev->next = t;
+    head->prev = t;
+  }
 }
 
-// set a periodic timer with a callback
-// return 1 if set, 0 if not
-u8 timer_add( softTimer_t* t, u32 ticks, timer_callback_t callback, void* obj) {
-  if (ticks == 0) { 
+// unlink a timer from its slot list
+static inline void slot_unlink(softTimer_t* t) {
+  if(t->next == t) {
+    wheel[t->slot] = NULL;
+  } else {
+    t->prev->next = t->next;
+    t->next->prev = t->prev;
+    if(wheel[t->slot] == t) {
+      wheel[t->slot] = t->next;
+    }
+  }
+  t->next = NULL;
+  t->prev = NULL;
+}
+
+// place a timer in the wheel according to its expiry
+static void wheel_insert(softTimer_t* t) {
+  u32 delta = t->expires - wheelTicks;
+  u32 e = t->expires;
+  u16 slot;
+
+  if((s32)delta < 0) {
+    // already due; fire on the next tick
+    slot = wheelTicks & WHEEL_MASK_0;
+  } else if(delta < WHEEL_SIZE_0) {
+    slot = e & WHEEL_MASK_0;
+  } else if(delta < (1 << (WHEEL_BITS_0 + WHEEL_BITS_N))) {
+    slot = WHEEL_SIZE_0
+      + ((e >> WHEEL_BITS_0) & WHEEL_MASK_N);
+  } else if(delta < (1 << (WHEEL_BITS_0 + 2 * WHEEL_BITS_N))) {
+    slot = WHEEL_SIZE_0 + WHEEL_SIZE_N
+      + ((e >> (WHEEL_BITS_0 + WHEEL_BITS_N)) & WHEEL_MASK_N);
+  } else {
+    if(delta > WHEEL_MAX_TICKS) {
+      e = wheelTicks + WHEEL_MAX_TICKS;
+      t->expires = e;
+    }
+    slot = WHEEL_SIZE_0 + 2 * WHEEL_SIZE_N
+      + ((e >> (WHEEL_BITS_0 + 2 * WHEEL_BITS_N)) & WHEEL_MASK_N);
+  }
+  slot_push(t, slot);
+}
+
+// move every timer in a slot back down the wheel.
+// return the index within the level.
+static u32 wheel_cascade(u32 level) {
+  u32 idx = (wheelTicks >> (WHEEL_BITS_0 + (level * WHEEL_BITS_N))) & WHEEL_MASK_N;
+  u16 slot = WHEEL_SIZE_0 + (level * WHEEL_SIZE_N) + idx;
+  softTimer_t* t;
+  while((t = wheel[slot]) != NULL) {
+    slot_unlink(t);
+    wheel_insert(t);
+  }
+  return idx;
+}
+
+// advance a deadline by the timer's interval
+static inline void timer_advance(softTimer_t* t) {
+  u32 f = t->expiresFrac + t->ticksFrac;
+  t->expires += t->ticks + (f >> 16);
+  t->expiresFrac = f & 0xffff;
+}
+
+// common setup for periodic and one-shot timers.
+// integer timers fire on the ticks'th tick from now;
+// fine timers get a rounded deadline measured from the current sub-tick phase.
+static u8 timer_add_mode(softTimer_t* t, u32 ticks, u16 frac, u8 fine,
+			 timer_callback_t callback, void* obj, u8 periodic) {
+  u32 f;
+  if (ticks == 0) {
     ticks = 1;
+    frac = 0;
   }
   if( t->next == NULL) {
     // disable timer interrupts
     cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
-
-    // this timer is unset
-    if ( top == NULL ) {
-      if (num == 0) {
-	// timer list is empty, so make this the top of the list
-	top = t;
-	num = 1;
-	// set this just so we know it's in the list.
-	t->next = t;
-      } else {
-	// shouldn't get here!
-	print_dbg("\r\n insanity in timer list! nonzero count of timers but no top element.");
-      }
-    } else {
-      // push this timer to the top of the list
-      t->next = top;
-      top = t;
-      ++num;
-    }
     t->callback = callback;
-    t->ticksRemain = ticks;
     t->ticks = ticks;
+    t->ticksFrac = frac;
     t->caller = obj;
+    t->periodic = periodic;
+    if(fine) {
+      // last tick boundary, plus sub-tick phase, rounding bias and interval
+      f = TIMERS_PHASE() + 0x8000 + frac;
+      t->expires = wheelTicks - 1 + ticks + (f >> 16);
+      t->expiresFrac = f & 0xffff;
+    } else {
+      t->expires = wheelTicks + ticks - 1;
+      t->expiresFrac = 0;
+    }
+    wheel_insert(t);
+    ++stats.num;
     cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
     return 1;
   } else {
@@ -67,72 +175,153 @@ u8 timer_add( softTimer_t* t, u32 ticks, timer_callback_t callback, void* obj) {
   }
 }
 
-// find and remove a timer from the processing list
+//------------------------------
+//--- extern functions
+
+void init_timers(void) {
+  u32 i;
+  for(i=0; i<=WHEEL_SLOTS; ++i) {
+    wheel[i] = NULL;
+  }
+  wheelTicks = 0;
+  running = NULL;
+  stats.num = 0;
+  timers_reset_stats();
+}
+
+// set a periodic timer with a callback
+// return 1 if set, 0 if not
+u8 timer_add( softTimer_t* t, u32 ticks, timer_callback_t callback, void* obj) {
+  return timer_add_mode(t, ticks, 0, 0, callback, obj, 1);
+}
+
+// set a one-shot timer with a callback
+// return 1 if set, 0 if not
+u8 timer_add_oneshot( softTimer_t* t, u32 ticks, timer_callback_t callback, void* obj) {
+  return timer_add_mode(t, ticks, 0, 0, callback, obj, 0);
+}
+
+// set a timer with a 16.16 interval
+// return 1 if set, 0 if not
+u8 timer_add_fine( softTimer_t* t, u32 period, timer_callback_t callback, void* obj, u8 periodic) {
+  return timer_add_mode(t, period >> 16, period & 0xffff, 1, callback, obj, periodic);
+}
+
+// change the 16.16 interval of a timer
+void timer_set_period_fine( softTimer_t* t, u32 period ) {
+  u32 f;
+  if(period < 0x10000) {
+    period = 0x10000;
+  }
+  cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
+  if(t->next != NULL) {
+    // step back to the last deadline, then forward by the new interval
+    f = (u32)t->expiresFrac + 0x10000 - t->ticksFrac;
+    t->expires = t->expires - t->ticks - 1 + (f >> 16);
+    t->expiresFrac = f & 0xffff;
+    t->ticks = period >> 16;
+    t->ticksFrac = period & 0xffff;
+    timer_advance(t);
+    // wheel_insert() fires it on the next tick if that is already past
+    slot_unlink(t);
+    wheel_insert(t);
+  } else {
+    // unscheduled, or in its own callback; used on the next reload
+    t->ticks = period >> 16;
+    t->ticksFrac = period & 0xffff;
+  }
+  cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
+}
+
+// convert integer milliseconds to a 16.16 interval in ticks
+u32 timer_ms_to_fine( u32 ms ) {
+  return (u32)( ((u64)ms * TIMERS_TICKS_PER_MS) >> 16 );
+}
+
+// remove a timer from the wheel
 // return 1 if removed, 0 if not found
 u8 timer_remove( softTimer_t* t) {
-  softTimer_t* cur = top;
-  softTimer_t* last = NULL;
-  u32 i;
   u8 ret = 0;
   cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
-  // search for the timer in the linked list
-  for(i=0; i<num; ++i) {
-    if(cur == t) {
-      // found it...
-      if(last == NULL) {
-	// target timer is probably at the top.
-	if(top != t) { // sanity check
-	  print_dbg("\r\n warning! timer list is insane. non-top element has no parent.");
-	  ret = 0; break;
-	}
-	if(t->next == t) {
-	  // target timer is the top element, and also the last.
-	  // empty the list, unlink, get out
-	  top = NULL;
-	  t->next = NULL;
-	  num = 0;
-	  ret = 1; break;
-	} else {
-	  // target is top element, and there are more in the list.
-	  // make the next element into the top, unlink, get out
-	  top = t->next;
-	  t->next = NULL;
-	  --num;
-	  ret = 1; break;
-	}
-      } else {
-	// target timer is not at the top.
-	if(last->next != t) { // sanity check
-	  print_dbg("\r\n warning! timer list is insane; link mismatch.");
-	  ret = 0; break;
-	}
-	// made it here, so everything is sane, and this is not the top timer.
-	// unlink and report success
-	last->next = t->next;
-	t->next = NULL;
-	--num;
-      }
+  if(t == running) {
+    // removing itself from its own callback; don't reload
+    running = NULL;
+    ret = 1;
+  }
+  if(t->next != NULL) {
+    if(t->slot > WHEEL_SLOT_RUN || wheel[t->slot] == NULL) {
+      print_dbg("\r\n warning! timer is linked but its slot is empty.");
+    } else {
+      slot_unlink(t);
+      --stats.num;
+      ret = 1;
     }
-    // made it here, so we didn't find it; advance the search.
-    last = cur;
-    cur = cur->next;
-  } // end of search loop
-  
+  }
   cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
   return ret;
 }
 
-// process the timer list, presumably from TC interrupt
+// process one tick, presumably from TC interrupt
 void process_timers( void ) {
-  u32 i;
-  softTimer_t* t = top;
-  for(i = 0; i<num; ++i) {
-    --(t->ticksRemain);
-    if(t->ticksRemain == 0) {
-      (*(t->callback))(t->caller);   
-      t->ticksRemain = t->ticks;
+  u32 start = TIMERS_CYCLES();
+  u32 fired = 0;
+  u32 idx = wheelTicks & WHEEL_MASK_0;
+  u32 level;
+  softTimer_t* t;
+
+  // on wrap, pull down the next turn's timers from higher levels
+  if(idx == 0) {
+    for(level = 0; level < WHEEL_LEVELS_N; ++level) {
+      if(wheel_cascade(level) != 0) { break; }
+    }
+  }
+
+  // move this tick's slot aside, so re-added timers land in a future turn
+  wheel[WHEEL_SLOT_RUN] = wheel[idx];
+  wheel[idx] = NULL;
+  if((t = wheel[WHEEL_SLOT_RUN]) != NULL) {
+    do {
+      t->slot = WHEEL_SLOT_RUN;
+      t = t->next;
+    } while(t != wheel[WHEEL_SLOT_RUN]);
+  }
+
+  ++wheelTicks;
+
+  while((t = wheel[WHEEL_SLOT_RUN]) != NULL) {
+    slot_unlink(t);
+    --stats.num;
+    running = t;
+    (*(t->callback))(t->caller);
+    ++fired;
+    // reload unless the callback removed or re-added it
+    if(running == t && t->next == NULL && t->periodic) {
+      timer_advance(t);
+      wheel_insert(t);
+      ++stats.num;
     }
-    t = t->next;
+    running = NULL;
   }
+
+  stats.lastFired = fired;
+  if(fired > stats.maxFired) { stats.maxFired = fired; }
+  stats.lastCycles = TIMERS_CYCLES() - start;
+  if(stats.lastCycles > stats.maxCycles) { stats.maxCycles = stats.lastCycles; }
+}
+
+// copy processing statistics
+void timers_get_stats( timerStats_t* s ) {
+  cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
+  *s = stats;
+  cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
 }
 
+// clear the max counters
+void timers_reset_stats( void ) {
+  cpu_irq_disable_level(APP_TC_IRQ_PRIORITY);
+  stats.lastCycles = 0;
+  stats.maxCycles = 0;
+  stats.lastFired = 0;
+  stats.maxFired = 0;
+  cpu_irq_enable_level(APP_TC_IRQ_PRIORITY);
+}
@@ -1,7 +1,9 @@
-/* timers.c
+/* timers.h
  * aleph
  *
- * ultra-simple software timer API
+ * software timer API.
+ * timers are kept in a hierarchical timing wheel,
+ * so add, remove and expiry are constant time.
  */
 
 
@@ -16,36 +18,76 @@
 // callback function
 typedef void (*timer_callback_t)( void* caller );
 
-// timer class, element in linked list
+// timer class, element in a doubly-linked wheel slot
 typedef struct _softTimer {
-  // decreasing count of ticks remaining
-  u32 ticksRemain;
-  // interval in ticks
+  // interval in ticks (periodic timers reload with this)
   u32 ticks;
+  // absolute tick at which the timer fires next
+  u32 expires;
   // callback function pointer
-  timer_callback_t callback;   	
-  // pointer to next timer in linked list
-  // this should be initialized to NULL
-  // FIXME? guess we should store a pointer to the last element too,
-  /// it would make searching a little faster/cleaner
+  timer_callback_t callback;
+  // pointer to next timer in slot list.
+  // this should be initialized to NULL;
+  // it is non-NULL exactly when the timer is scheduled.
   struct _softTimer* next;
+  // pointer to previous timer in slot list
+  struct _softTimer* prev;
   // arbitrary argument to differentiate different callers
   // using the same callback
   void* caller;
+  // index of the wheel slot holding this timer
+  u16 slot;
+  // fractional part of the interval, in 1/65536 ticks
+  u16 ticksFrac;
+  // fractional part of the next deadline.
+  // fine timers carry half a tick of bias here, so expiry rounds to the nearest tick.
+  u16 expiresFrac;
+  // nonzero for periodic timers, zero for one-shot
+  u8 periodic;
 } softTimer_t;
 
+// per-tick processing statistics
+typedef struct _timerStats {
+  // count of scheduled timers
+  u32 num;
+  // cpu cycles spent in the last tick
+  u32 lastCycles;
+  // most cpu cycles spent in any tick
+  u32 maxCycles;
+  // timers fired in the last tick
+  u32 lastFired;
+  // most timers fired in any tick
+  u32 maxFired;
+} timerStats_t;
+
 //------------------------------
 //---- functions
 
 // initialize timers
 void init_timers( void );
-// add a timer to the processing list
+// add a periodic timer to the processing list
+// return 1 if set, 0 if not
+u8 timer_add( softTimer_t* timer, u32 ticks, timer_callback_t callback, void* caller);
+// add a one-shot timer; it is removed after firing once.
+// return 1 if set, 0 if not
+u8 timer_add_oneshot( softTimer_t* timer, u32 ticks, timer_callback_t callback, void* caller);
+// add a timer with a 16.16 interval in ticks, measured from the current sub-tick time.
+// periodic deadlines accumulate the fraction, so the average rate is exact.
 // return 1 if set, 0 if not
-u8 timer_add( softTimer_t* timer, u32 ticks, timer_callback_t callback, void* valler);
+u8 timer_add_fine( softTimer_t* timer, u32 period, timer_callback_t callback, void* caller, u8 periodic);
+// change the 16.16 interval of a timer.
+// a scheduled timer is moved to its last deadline plus the new interval.
+void timer_set_period_fine( softTimer_t* timer, u32 period );
+// convert integer milliseconds to a 16.16 interval in ticks
+u32 timer_ms_to_fine( u32 ms );
 // find remove a timer from the processing list
 // return 1 if removed, 0 if not found
 u8 timer_remove( softTimer_t* timer );
 // process the timer list; call this on each tick.
 void process_timers( void );
+// copy processing statistics
+void timers_get_stats( timerStats_t* stats );
+// clear the max counters
+void timers_reset_stats( void );
 
 #endif // header guard
@@ -19,16 +19,19 @@
 
 //---- defines
 
+//---- types
 
-
-//---- extern vars
-u8 ftdiConnect = 0;
+// per-device transfer state
+typedef struct {
+  u8 rxBuf[FTDI_RX_BUF_SIZE];
+  u32 rxBytes;
+  volatile u8 rxBusy;
+  volatile u8 txBusy;
+  u8 connected;
+} ftdiDev_t;
 
 //----- static vars
-static u8 rxBuf[FTDI_RX_BUF_SIZE];
-static u32 rxBytes = 0;
-static u8 rxBusy = 0;
-static u8 txBusy = 0;
+static ftdiDev_t ftdiDev[FTDI_MAX_DEVICES];
 static uhd_trans_status_t status = 0;
 static event_t e;
 
@@ -38,22 +41,26 @@ static void ftdi_rx_done(  usb_add_t add,
 			   usb_ep_t ep,
 			   uhd_trans_status_t stat,
 			   iram_size_t nb) {
+  u8 idx = uhi_ftdi_index(add);
+  ftdiDev_t* fdev;
+  if(idx == FTDI_MAX_DEVICES) {
+    return;
+  }
+  fdev = &(ftdiDev[idx]);
   status = stat;
-  rxBusy = 0;
-  rxBytes = nb - FTDI_STATUS_BYTES;
+  fdev->rxBusy = 0;
+  if(nb > FTDI_STATUS_BYTES) {
+    fdev->rxBytes = nb - FTDI_STATUS_BYTES;
+  } else {
+    fdev->rxBytes = 0;
+  }
   /* print_dbg("\r\n ftdi rx transfer callback. status: 0x"); */
   /* print_dbg_hex((u32)status); */
   /* print_dbg(" ; bytes transferred: "); */
   /* print_dbg_ulong(nb); */
-  /* print_dbg(" ; status bytes: 0x"); */
-  /* print_dbg_hex(rxBuf[0]); */
-  /* print_dbg(" 0x"); */
-  /* print_dbg_hex(rxBuf[1]); */			    
-  if(rxBytes) {
+  if(fdev->rxBytes) {
     // check for monome events
-    //    if(monome_read_serial != NULL) { 
-      (*monome_read_serial)(); 
-      //}
+    monome_read_serial(idx);
     ///... TODO: other protocols
   } 
 }
@@ -63,8 +70,11 @@ static void ftdi_tx_done(
 			       usb_ep_t ep,
 			       uhd_trans_status_t stat,
 			       iram_size_t nb) {
+  u8 idx = uhi_ftdi_index(add);
+  if(idx < FTDI_MAX_DEVICES) {
+    ftdiDev[idx].txBusy = 0;
+  }
   status = stat;
-  txBusy = 0;
   /* print_dbg("\r\n ftdi tx transfer callback. status: 0x"); */
   /* print_dbg_hex((u32)status); */
   if (status != UHD_TRANS_NOERROR) {
@@ -75,19 +85,20 @@ static void ftdi_tx_done(
 }
 
 //-------- extern functions
-void ftdi_write(u8* data, u32 bytes) {
-  txBusy = 1;
-  if(!uhi_ftdi_out_run(data, bytes, &ftdi_tx_done)) {
-
+void ftdi_write(u8 idx, u8* data, u32 bytes) {
+  ftdiDev[idx].txBusy = 1;
+  if(!uhi_ftdi_out_run(idx, data, bytes, &ftdi_tx_done)) {
+    ftdiDev[idx].txBusy = 0;
     print_dbg("\r\n error requesting ftdi output pipe");
   }
 }
     
-void ftdi_read(void) {
-  rxBytes = 0;
-  rxBusy = true;
-  if (!uhi_ftdi_in_run((u8*)rxBuf,
+void ftdi_read(u8 idx) {
+  ftdiDev[idx].rxBytes = 0;
+  ftdiDev[idx].rxBusy = true;
+  if (!uhi_ftdi_in_run(idx, ftdiDev[idx].rxBuf,
 		       FTDI_RX_BUF_SIZE, &ftdi_rx_done)) {
+    ftdiDev[idx].rxBusy = 0;
     print_dbg("\r\n ftdi rx transfer error");
   }
   return;
@@ -96,60 +107,59 @@ void ftdi_read(void) {
 
 // respond to connection or disconnection of ftdi device.
 // may be called from an interrupt
-void ftdi_change(uhc_device_t* dev, u8 plug) {
-  print_dbg("\r\n changed FTDI connection status");
+void ftdi_change(u8 idx, u8 plug) {
+  print_dbg("\r\n changed FTDI connection status, device: ");
+  print_dbg_ulong(idx);
   if(plug) { 
     e.type = kEventFtdiConnect; 
   } else {
+    ftdiDev[idx].connected = 0;
     e.type = kEventFtdiDisconnect;
   }
+  e.data = idx;
   // posting an event so the main loop can respond
   event_post(&e); 
 }
 
 // setup new device connection
-void ftdi_setup(void) {
+void ftdi_setup(u8 idx) {
   char * manstr;
   char * prodstr;
   char * serstr;
-  //  u8 matchMonome;
-  print_dbg("\r\n FTDI setup routine");
+  print_dbg("\r\n FTDI setup routine, device: ");
+  print_dbg_ulong(idx);
 
   // get string data...
-  ftdi_get_strings(&manstr, &prodstr, &serstr);  
-  // print the strings
-  // print_unicode_string(manstr, FTDI_STRING_MAX_LEN);
-  //  print_unicode_string(prodstr, FTDI_STRING_MAX_LEN);
-  //  print_unicode_string(serstr, FTDI_STRING_MAX_LEN);
+  ftdi_get_strings(idx, &manstr, &prodstr, &serstr);  
   //// query if this is a monome device
-  check_monome_device_desc(manstr, prodstr, serstr);
+  check_monome_device_desc(idx, manstr, prodstr, serstr);
   //// TODO: other protocols??
 
   // set connection flag
-  ftdiConnect = 1;
+  ftdiDev[idx].connected = 1;
 }
 
 
 // rx buffer (no status bytes)
-extern u8* ftdi_rx_buf() {
-  return rxBuf + 2;
+extern u8* ftdi_rx_buf(u8 idx) {
+  return ftdiDev[idx].rxBuf + FTDI_STATUS_BYTES;
 }
 
 // number of bytes from last rx trasnfer
-extern volatile u8 ftdi_rx_bytes() {
-  return rxBytes;
+extern volatile u8 ftdi_rx_bytes(u8 idx) {
+  return ftdiDev[idx].rxBytes;
 }
 
 // busy flags
-extern volatile u8 ftdi_rx_busy() {
-  return rxBusy;
+extern volatile u8 ftdi_rx_busy(u8 idx) {
+  return ftdiDev[idx].rxBusy;
 }
 
-extern volatile u8 ftdi_tx_busy() {
-  return txBusy;
+extern volatile u8 ftdi_tx_busy(u8 idx) {
+  return ftdiDev[idx].txBusy;
 }
 
 // device plugged flag
-extern u8 ftdi_connected(void) {
-  return ftdiConnect;
+extern u8 ftdi_connected(u8 idx) {
+  return ftdiDev[idx].connected;
 }
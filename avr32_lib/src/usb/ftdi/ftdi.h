@@ -1,6 +1,8 @@
 /* ftdi.h
    
    ftdi driver for monome aleph
+
+   each attached FTDI device has an index into a device table.
  */
 
 #ifndef _ALEPH_FTD_H_
@@ -16,36 +18,31 @@
 // seems to usually be 0x31 0x60
 #define FTDI_STATUS_BYTES 2
 
-// pointer to rx data
-///extern volatile u8 ftdiRxBuf[];
-// num bytes read
-//extern volatile u32 ftdiRxBytes;
+// max simultaneous devices (e.g. grid + arc on a hub)
+#define FTDI_MAX_DEVICES 2
 
 // read from FTDI device on usb.
-// returns bytes read.
-// data is in the externally-visible rx buffer.
-//extern u32 ftdi_read(void);
-// non-blocking
-extern void ftdi_read(void);
+// non-blocking; data is in the device's rx buffer when the transfer completes.
+extern void ftdi_read(u8 idx);
 
 // write to FTDI device
-extern void ftdi_write(u8* data, u32 bytes);
+extern void ftdi_write(u8 idx, u8* data, u32 bytes);
 
 // FTDI device was plugged or unplugged
-extern void ftdi_change(uhc_device_t* dev, u8 plug);
+extern void ftdi_change(u8 idx, u8 plug);
 // main-loop setup routine for new device connection
-extern void ftdi_setup(void);
+extern void ftdi_setup(u8 idx);
 
 //-- getters
 
 // rx buffer (no status bytes)
-extern u8* ftdi_rx_buf(void);
+extern u8* ftdi_rx_buf(u8 idx);
 // number of bytes from last rx trasnfer
-extern volatile u8 ftdi_rx_bytes(void);
+extern volatile u8 ftdi_rx_bytes(u8 idx);
 // busy flags
-extern volatile u8 ftdi_rx_busy(void);
-extern volatile u8 ftdi_tx_busy(void);
+extern volatile u8 ftdi_rx_busy(u8 idx);
+extern volatile u8 ftdi_tx_busy(u8 idx);
 // device connected flag
-extern u8 ftdi_connected(void);
+extern u8 ftdi_connected(u8 idx);
 
 #endif // h guard
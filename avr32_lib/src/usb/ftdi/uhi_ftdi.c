@@ -19,10 +19,6 @@
 #include "usb_protocol_ftdi.h"
 #include "uhi_ftdi.h"
 
-#ifdef USB_HOST_HUB_SUPPORT
-# error USB HUB support is not implemented
-#endif
-
 //------ DEFINES
 #define UHI_FTDI_TIMEOUT 20000
 #define FTDI_STRING_DESC_REQ_TYPE ( (USB_REQ_DIR_IN) | (USB_REQ_TYPE_STANDARD) | (USB_REQ_RECIP_DEVICE) )
@@ -49,10 +45,8 @@ typedef struct {
 
 //----- static variables
 
-// device data
-static uhi_ftdi_dev_t uhi_ftdi_dev = {
-  .dev = NULL,
-};
+// device data, one entry per attached FTDI device
+static uhi_ftdi_dev_t uhi_ftdi_dev[FTDI_MAX_DEVICES];
 
 // manufacturer string descriptor
 //usb_str_desc_t manufacturer_desc;
@@ -69,8 +63,10 @@ static volatile u8 ctlReadBusy = 0;
 
 //------- static funcs
 
+// find the table entry for a device, or FTDI_MAX_DEVICES
+static u8 uhi_ftdi_find(uhc_device_t* dev);
 // send control request
-static u8 send_ctl_request(u8 reqtype, u8 reqnum, 
+static u8 send_ctl_request(u8 idx, u8 reqtype, u8 reqnum, 
 			   u8* data, u16 size,
 			     u16 index, u16 val, 
 			     uhd_callback_setup_end_t callbackEnd);
@@ -85,12 +81,17 @@ uhc_enum_status_t uhi_ftdi_install(uhc_device_t* dev) {
   bool b_iface_supported;
   uint16_t conf_desc_lgt, vid, pid;
   usb_iface_desc_t *ptr_iface;
+  uhi_ftdi_dev_t* fdev;
+  u8 idx;
 
   print_dbg("\r\n run uhi_ftdi_install");
 
-  if (uhi_ftdi_dev.dev != NULL) {
-    return UHC_ENUM_SOFTWARE_LIMIT; // Device already allocated
+  // take the first free entry
+  idx = uhi_ftdi_find(NULL);
+  if (idx == FTDI_MAX_DEVICES) {
+    return UHC_ENUM_SOFTWARE_LIMIT; // all devices allocated
   }
+  fdev = &(uhi_ftdi_dev[idx]);
 
   // check vid/pid
   vid = le16_to_cpu(dev->dev_desc.idVendor);
@@ -114,8 +115,8 @@ uhc_enum_status_t uhi_ftdi_install(uhc_device_t* dev) {
 	  && (ptr_iface->bInterfaceProtocol == FTDI_PROTOCOL) ) {
 	print_dbg("\r\n class/protocol matches FTDI. ");
 	b_iface_supported = true;
-	uhi_ftdi_dev.ep_in = 0;
-	uhi_ftdi_dev.ep_out = 0;
+	fdev->ep_in = 0;
+	fdev->ep_out = 0;
       } else {
 	b_iface_supported = false;
       }
@@ -134,9 +135,9 @@ uhc_enum_status_t uhi_ftdi_install(uhc_device_t* dev) {
       case USB_EP_TYPE_BULK:
 	//	print_dbg("\r\n allocating bulk endpoint: ");
 	if (((usb_ep_desc_t*)ptr_iface)->bEndpointAddress & USB_EP_DIR_IN) {
-	  uhi_ftdi_dev.ep_in = ((usb_ep_desc_t*)ptr_iface)->bEndpointAddress;
+	  fdev->ep_in = ((usb_ep_desc_t*)ptr_iface)->bEndpointAddress;
 	} else {
-	  uhi_ftdi_dev.ep_out = ((usb_ep_desc_t*)ptr_iface)->bEndpointAddress;
+	  fdev->ep_out = ((usb_ep_desc_t*)ptr_iface)->bEndpointAddress;
 	}
 	break;
       default:
@@ -154,23 +155,25 @@ uhc_enum_status_t uhi_ftdi_install(uhc_device_t* dev) {
   }
 
   if (b_iface_supported) {
-    uhi_ftdi_dev.dev = dev;
-    print_dbg("\r\n completed FTDI device install");
+    fdev->dev = dev;
+    print_dbg("\r\n completed FTDI device install, index: ");
+    print_dbg_ulong(idx);
     return UHC_ENUM_SUCCESS;
   }
   return UHC_ENUM_UNSUPPORTED; // No interface supported
 }
 
 void uhi_ftdi_enable(uhc_device_t* dev) {
+  u8 idx = uhi_ftdi_find(dev);
 
-  if (uhi_ftdi_dev.dev != dev) {
+  if (idx == FTDI_MAX_DEVICES) {
     return;  // No interface to enable
   }
   /// bit mode (not bitbang? )
   /// todo: what do these mean???
   // val : ff
   // indx : 1
-  send_ctl_request(FTDI_DEVICE_OUT_REQTYPE, 
+  send_ctl_request(idx, FTDI_DEVICE_OUT_REQTYPE, 
 		   FTDI_REQ_BITMODE,
 		   NULL, 0,
 		   1, 0xff, 
@@ -179,7 +182,7 @@ void uhi_ftdi_enable(uhc_device_t* dev) {
   /// todo: what do these mean???
   // index 1
   // val : 8
-  send_ctl_request(FTDI_DEVICE_OUT_REQTYPE, 
+  send_ctl_request(idx, FTDI_DEVICE_OUT_REQTYPE, 
 		   FTDI_REQ_LINE_PROPERTIES,
 		   NULL, 0,
 		   1, 8,
@@ -189,7 +192,7 @@ void uhi_ftdi_enable(uhc_device_t* dev) {
   // value: 26 (baudrate: 115200)
   // value: 49206 (baudrate : 57600)
   // index: 0
-  send_ctl_request(FTDI_DEVICE_OUT_REQTYPE, 
+  send_ctl_request(idx, FTDI_DEVICE_OUT_REQTYPE, 
 		   FTDI_REQ_BAUDRATE,
 		   NULL, 0,
 		   0, 49206,
@@ -197,54 +200,74 @@ void uhi_ftdi_enable(uhc_device_t* dev) {
 
   delay_ms(200);
 
-  ftdi_change(dev, true);  
+  ftdi_change(idx, true);  
 }
 
 void uhi_ftdi_uninstall(uhc_device_t* dev) {
-  if (uhi_ftdi_dev.dev != dev) {
+  u8 idx = uhi_ftdi_find(dev);
+  if (idx == FTDI_MAX_DEVICES) {
     return; // Device not enabled in this interface
   }
-  uhi_ftdi_dev.dev = NULL;
-  Assert(uhi_ftdi_dev.report!=NULL);
-  ftdi_change(dev, false);  
+  uhi_ftdi_dev[idx].dev = NULL;
+  ftdi_change(idx, false);  
 }
 
 // run the input endpoint (bulk)
-bool uhi_ftdi_in_run(uint8_t * buf, iram_size_t buf_size,
+bool uhi_ftdi_in_run(u8 idx, uint8_t * buf, iram_size_t buf_size,
 		     uhd_callback_trans_t callback) {
-  return uhd_ep_run(uhi_ftdi_dev.dev->address,
-		    uhi_ftdi_dev.ep_in, false, buf, buf_size,
+  if(uhi_ftdi_dev[idx].dev == NULL) { return false; }
+  return uhd_ep_run(uhi_ftdi_dev[idx].dev->address,
+		    uhi_ftdi_dev[idx].ep_in, false, buf, buf_size,
 		    UHI_FTDI_TIMEOUT, callback);
 }
 
 // run the output endpoint (bulk)
-bool uhi_ftdi_out_run(uint8_t * buf, iram_size_t buf_size,
+bool uhi_ftdi_out_run(u8 idx, uint8_t * buf, iram_size_t buf_size,
 		      uhd_callback_trans_t callback) {
-  return uhd_ep_run(uhi_ftdi_dev.dev->address,
-		    uhi_ftdi_dev.ep_out, true, buf, buf_size,
+  if(uhi_ftdi_dev[idx].dev == NULL) { return false; }
+  return uhd_ep_run(uhi_ftdi_dev[idx].dev->address,
+		    uhi_ftdi_dev[idx].ep_out, true, buf, buf_size,
 		    UHI_FTDI_TIMEOUT, callback);
 }
 
+// get the device index from a usb address, or FTDI_MAX_DEVICES
+u8 uhi_ftdi_index(usb_add_t add) {
+  u8 idx;
+  for(idx=0; idx<FTDI_MAX_DEVICES; idx++) {
+    if( (uhi_ftdi_dev[idx].dev != NULL) && (uhi_ftdi_dev[idx].dev->address == add) ) {
+      break;
+    }
+  }
+  return idx;
+}
+
 //----------------
 //---- static functions definitions
 
+// find the table entry for a device (NULL for a free entry)
+static u8 uhi_ftdi_find(uhc_device_t* dev) {
+  u8 idx;
+  for(idx=0; idx<FTDI_MAX_DEVICES; idx++) {
+    if(uhi_ftdi_dev[idx].dev == dev) {
+      break;
+    }
+  }
+  return idx;
+}
+
 // send control request
-static u8 send_ctl_request(u8 reqtype, u8 reqnum, 
+static u8 send_ctl_request(u8 idx, u8 reqtype, u8 reqnum, 
 			   u8* data, u16 size,
 			     u16 index, u16 val, 
 			     uhd_callback_setup_end_t callbackEnd) {
   usb_setup_req_t req;
  
-  /* if (uhi_ftdi_dev.dev != dev) { */
-  /*   return;  // No interface to enable */
-  /* } */
-
   req.bmRequestType = reqtype;
   req.bRequest = reqnum;
   req.wValue = (val);
   req.wIndex = (index);
   req.wLength = (size);
-  return uhd_setup_request(uhi_ftdi_dev.dev->address,
+  return uhd_setup_request(uhi_ftdi_dev[idx].dev->address,
 		    &req,
 		    data,
 		    size,
@@ -264,13 +287,13 @@ static void ctl_req_end(
 }
 
 // read eeprom
-void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
+void ftdi_get_strings(u8 idx, char** pManufacturer, char** pProduct, char** pSerial) {
 
   // get manufacturer string
   ctlReadBusy = 1;
   //  print_dbg("\r\n sending ctl request for manufacturer string, index : ");
-  //  print_dbg_hex(uhi_ftdi_dev.dev->dev_desc.iManufacturer);
-  if(!(send_ctl_request(
+  //  print_dbg_hex(uhi_ftdi_dev[idx].dev->dev_desc.iManufacturer);
+  if(!(send_ctl_request(idx,
 			/* req type*/
 			FTDI_STRING_DESC_REQ_TYPE,
 			/* req num */
@@ -284,7 +307,7 @@ void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
 			FTDI_STRING_DESC_LANGID,
 			/*val*/
 			// high byte is 3 for string descriptor (yay, magic!)
-			(USB_DT_STRING << 8) | uhi_ftdi_dev.dev->dev_desc.iManufacturer,
+			(USB_DT_STRING << 8) | uhi_ftdi_dev[idx].dev->dev_desc.iManufacturer,
 			// end-transfer callback
 			&ctl_req_end )
        
@@ -298,8 +321,8 @@ void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
   // get product string
   ctlReadBusy = 1;
   //  print_dbg("\r\n sending ctl request for product string, index : ");
-  //  print_dbg_ulong( uhi_ftdi_dev.dev->dev_desc.iProduct);
-  if(!(send_ctl_request(
+  //  print_dbg_ulong( uhi_ftdi_dev[idx].dev->dev_desc.iProduct);
+  if(!(send_ctl_request(idx,
 			/* req type*/
 			FTDI_STRING_DESC_REQ_TYPE,
 			/* req num */
@@ -311,7 +334,7 @@ void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
 			/*idx*/
 			FTDI_STRING_DESC_LANGID,
 			/*val*/
-			(USB_DT_STRING << 8) | uhi_ftdi_dev.dev->dev_desc.iProduct,
+			(USB_DT_STRING << 8) | uhi_ftdi_dev[idx].dev->dev_desc.iProduct,
 			// end-transfer callback
 			&ctl_req_end )
        
@@ -325,7 +348,7 @@ void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
   // get serial string
   ctlReadBusy = 1;
   // print_dbg("\r\n sending ctl request for serial string : ");
-  if(!(send_ctl_request(
+  if(!(send_ctl_request(idx,
 			/* req type*/
 			FTDI_STRING_DESC_REQ_TYPE,
 			/* req num */
@@ -337,7 +360,7 @@ void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial) {
 			/*idx*/
 			FTDI_STRING_DESC_LANGID,
 			/*val*/
-			(USB_DT_STRING << 8) | uhi_ftdi_dev.dev->dev_desc.iSerialNumber,
+			(USB_DT_STRING << 8) | uhi_ftdi_dev[idx].dev->dev_desc.iSerialNumber,
 			// end-transfer callback
 			&ctl_req_end )
        
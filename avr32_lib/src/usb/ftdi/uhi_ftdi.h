@@ -10,6 +10,7 @@
 #define _UHI_FTDI_H_
 
 #include "conf_usb_host.h"
+#include "types.h"
 #include "usb_protocol.h"
 #include "uhi.h"
 
@@ -30,14 +31,16 @@ extern uhc_enum_status_t uhi_ftdi_install(uhc_device_t* dev);
 extern void uhi_ftdi_uninstall(uhc_device_t* dev);
 // enable
 extern void uhi_ftdi_enable(uhc_device_t* dev);
-// input transfer
-extern bool uhi_ftdi_in_run(uint8_t * buf, iram_size_t buf_size,
+// input transfer on a given device
+extern bool uhi_ftdi_in_run(u8 idx, uint8_t * buf, iram_size_t buf_size,
 		uhd_callback_trans_t callback);
-// output transfer
-extern bool uhi_ftdi_out_run(uint8_t * buf, iram_size_t buf_size,
+// output transfer on a given device
+extern bool uhi_ftdi_out_run(u8 idx, uint8_t * buf, iram_size_t buf_size,
 		uhd_callback_trans_t callback);
+// get the device index from a usb address, or FTDI_MAX_DEVICES
+extern u8 uhi_ftdi_index(usb_add_t add);
 
-// get string descriptions
-extern void ftdi_get_strings(char** pManufacturer, char** pProduct, char** pSerial);
+// get string descriptions for a given device
+extern void ftdi_get_strings(u8 idx, char** pManufacturer, char** pProduct, char** pSerial);
 
 #endif // _UHI_FTDI_H_
@@ -24,159 +24,211 @@
 // so it is a tradeoff.
 #define MIDI_RX_BUF_SIZE 64
 
-// max packet length.
-// a packet contains status and data byte for a typical midi message.
-// sysex and other long/weird messages can be ignored for now.
-// 4 bytes will fit in event data.
-// longer than that we will have to use a global pointer to the rx buf or some shit.
-#define MIDI_MAX_PACKET_SIZE 	4
-#define MIDI_MAX_PACKET_SIZE_1 	3
+// usb-midi event packets are 4 bytes:
+// cable number and code index (CIN), then up to 3 midi bytes.
+#define MIDI_USB_PACKET_SIZE 4
+
+// TX buffer size; one full-speed bulk packet
+#define MIDI_TX_BUF_SIZE 64
+
+// output queue size in messages, power of 2
+#define MIDI_OUT_QUEUE_SIZE 64
+#define MIDI_OUT_QUEUE_MASK (MIDI_OUT_QUEUE_SIZE - 1)
 
 //------------------------------------
 //------ extern variables
-u8 midiConnect = 0;
+// output has messages waiting
+volatile u8 midiOutDirty = 0;
 
 //------------------------------------
 //------ static variables
 static u8 rxBuf[MIDI_RX_BUF_SIZE];
 static u32 rxBytes = 0;
 static u8 rxBusy = 0;
-static u8 txBusy = 0;
+static volatile u8 txBusy = 0;
+static u8 txBuf[MIDI_TX_BUF_SIZE];
 
-// current packet data
-//union { u8 buf[MIDI_MAX_PACKET_SIZE]; s32 data; } packet;
-// address of last packet byte
-//u8* packetEnd = &(packet.buf[3]);
 // event
 static event_t ev = { .type = kEventMidiPacket, .data = 0x00000000 };
-static union { u8 buf[4]; u32 data; s32 sdata; } packet;
-// pointers into the event data (hacky)
-//static u8* const packetStart = (u8*)&(ev.data);
-//static u8* const packetEnd = (u8*)&(ev.data) + 3;
-static u8* const packetStart = &(packet.buf[0]);
-static u8* const packetEnd = &(packet.buf[3]);
+
+// parser state, kept across transfers.
+// running status (0 if none)
+static u8 runStatus = 0;
+// data bytes received / expected for the current message
+static u8 dataCount = 0;
+static u8 dataNeed = 0;
+// data bytes for the current message
+static u8 data1 = 0;
+
+// sysex reassembly. completed messages swap into the read buffer,
+// so the main loop can read one while the next is received.
+static u8 sysexBuf[2][MIDI_SYSEX_BUF_SIZE];
+// buffer being filled
+static u8 sysexWrite = 0;
+// bytes in buffer being filled
+static u16 sysexBytes = 0;
+// receiving sysex
+static u8 sysexActive = 0;
+// sysex overflowed the buffer, drop it
+static u8 sysexOverflow = 0;
+
+// output queue of messages that are sent in order, as usb-midi packets
+static u32 outQueue[MIDI_OUT_QUEUE_SIZE];
+static u8 outHead = 0;
+static u8 outTail = 0;
+// a device is attached; output is dropped while there is none
+static u8 outConnected = 0;
+
+// coalesced output: only the latest value is sent.
+// controller values, by channel and number
+static u8 ccVal[16][128];
+// pending controllers, 4 words per channel
+static u32 ccPending[16][4];
+// channels with pending controllers
+static u16 ccChanPending = 0;
+// channel pressure and pitch bend, by channel
+static u8 pressVal[16];
+static u16 bendVal[16];
+static u16 pressPending = 0;
+static u16 bendPending = 0;
+
+// data byte count for channel messages, by status high nibble - 8
+static const u8 chanDataBytes[7] = { 2, 2, 2, 2, 1, 1, 2 };
+// data byte count for system common messages, by status low nibble
+static const u8 sysDataBytes[8] = { 0, 1, 2, 1, 0, 0, 0, 0 };
+// midi byte count for usb-midi packets, by code index number
+static const u8 cinBytes[16] = { 0, 0, 2, 3, 3, 1, 2, 3, 3, 3, 3, 3, 2, 2, 3, 1 };
 
 //------------------------------------
 //----- static functions
-// parse the buffer and spawn appropriate events
-static void midi_parse(void) {
-  // current byte data
-  u8 b; 
-  //// FIXME:
-  /// for some reason, the UHC is getting an extra byte at the beginning
-  /// this byte has the upper nibble of the real first byte,
-  ///  echoed in its lower nibble.... weird
-  u8* src = rxBuf + 1;
-  // temp pointer to packet
-  u8* dst = packetStart;
-  // flag if we have received a status byte
-  u8 stat = 0;
-  // bytes processed
-  u8 nb = 0;
-
-  // clear packet data
-  //  ev.data = 0x00000000;
-  packet.data = 0x00000000;
-
-  //  print_dbg("\r\n ");
-
-  while(nb < rxBytes) {
-    b = *src;
-    ++src;
-    ++nb;
-    if(b & 0x80) {
-      // this is a status byte
-      dst = packetStart;
-      //      print_dbg("\r\n parsed status byte. packet contents: 0x");
-      //      print_dbg_hex(packet.data);
-      //      print_dbg(" | SB ( ");
-      //      print_dbg_hex(packet.data);
-      //      print_dbg(" )");
-
-      if(stat) {
-	// if we already had a status byte, send the previous packet
-	ev.data = packet.sdata;
-	//	print_dbg("\r\n sending MIDI packet: "); 
-	//	print_dbg_hex(packet.data);
-	event_post(&ev);
-      }
-      *dst = b;
-      stat = 1;  
+
+// post a complete message
+static inline void midi_post(u8 status, u8 d1, u8 d2) {
+  ev.data = ((u32)status << 24) | ((u32)d1 << 16) | ((u32)d2 << 8);
+  event_post(&ev);
+}
+
+// finish a sysex message and post it
+static void midi_sysex_end(void) {
+  if(sysexActive && !sysexOverflow) {
+    ev.data = ((u32)MIDI_SYSEX << 24) | sysexBytes;
+    sysexWrite ^= 1;
+    event_post(&ev);
+  }
+  sysexActive = 0;
+  sysexOverflow = 0;
+  sysexBytes = 0;
+}
+
+// parse one byte of the midi stream.
+// handles running status, interleaved realtime bytes and sysex.
+static void midi_parse_byte(u8 b) {
+  if(b >= 0xf8) {
+    // realtime: single byte, may appear anywhere, doesn't touch state
+    midi_post(b, 0, 0);
+    return;
+  }
+  if(b & 0x80) {
+    // any other status byte ends a sysex
+    if(sysexActive) {
+      midi_sysex_end();
+    }
+    if(b == MIDI_SYSEX) {
+      sysexActive = 1;
+      runStatus = 0;
+    } else if(b == MIDI_SYSEX_END) {
+      // end of sysex (or a stray end)
+      runStatus = 0;
+    } else if(b < 0xf0) {
+      // channel message, becomes the running status
+      runStatus = b;
+      dataNeed = chanDataBytes[(b >> 4) - 8];
     } else {
-      // this is a data byte or whatever
-      ++dst;
-      if(dst > packetEnd) {
-	// exceeded packet size (sysex?), so give up on this packet
-	stat = 0;
+      // system common clears running status
+      dataNeed = sysDataBytes[b & 0x7];
+      if(dataNeed == 0) {
+	midi_post(b, 0, 0);
+	runStatus = 0;
       } else {
-	*dst = b;
+	runStatus = b;
       }
     }
+    dataCount = 0;
+    return;
   }
-  // at the end of a buffer, send a packet if we have a pending status
-  if(stat) {
-    //    print_dbg("\r\n sending MIDI packet: "); 
-    ev.data = packet.sdata;
-    //    print_dbg_hex(packet.data);
-    event_post(&ev);
+  // data byte
+  if(sysexActive) {
+    if(sysexBytes < MIDI_SYSEX_BUF_SIZE) {
+      sysexBuf[sysexWrite][sysexBytes++] = b;
+    } else {
+      sysexOverflow = 1;
+    }
+    return;
+  }
+  if(runStatus == 0) {
+    // no status, ignore
+    return;
+  }
+  if(dataCount == 0) {
+    data1 = b;
+  }
+  if(++dataCount == dataNeed) {
+    if(dataNeed == 1) {
+      midi_post(runStatus, data1, 0);
+    } else {
+      midi_post(runStatus, data1, b);
+    }
+    dataCount = 0;
+    if(runStatus >= 0xf0) {
+      // system common doesn't repeat
+      runStatus = 0;
+    }
   }
-  //  print_dbg("\r\n");
-  //  print_dbg("\r\n");
 }
 
-/*   for(i=0; i<rxBytes; ++i) { */
-/*     b = *src; */
-/*     //    print_dbg("\r\n midi_parse, byte: "); */
-/*     //    print_dbg_hex((u32)b); */
-/*     if(b & 0x80) { */
-/*       // this is a status byte, start a new packet */
-/*       dst = packetStart; */
-/*       if(packOk) { */
-/* 	// send the previous packet */
-/* 	print_dbg("\r\n sending MIDI packet: "); */
-/* 	print_dbg_char_hex((ev.data & 0xff000000) >> 24); */
-/* 	print_dbg(" "); */
-/* 	print_dbg_char_hex((ev.data & 0xff0000) >> 16); */
-/* 	print_dbg(" "); */
-/* 	print_dbg_char_hex((ev.data & 0xff00) >> 8); */
-/* 	print_dbg(" "); */
-/* 	print_dbg_char_hex(ev.data & 0xff); */
-/* 	print_dbg(" "); */
-/* 	event_post(&ev); */
-/* 	// don't want to send again at the end of the loop */
-/* 	packOk = 0; */
-/*       } else { */
-/* 	// maybe this packet is only a status byte */
-/* 	packOk = 1; */
-/*       } */
-/*       // store status byte */
-/*       *dst = b; */
-/*     } else { */
-/*       if(++dst > packetEnd) { */
-/* 	// exceeded packet size, don't write, don't send */
-/* 	packOk = 0; */
-/*       } else { */
-/* 	// store data byte, or whatever */
-/* 	*dst = b; */
-/* 	packOk = 1; */
-/*       }  */
-/*     } */
-/*     ++src; */
-/*   } */
-/*   if(packOk) { */
-/*     // send the previous packet */
-/*     print_dbg("\r\n sending MIDI packet: "); */
-/*     print_dbg_char_hex(ev.data & 0xff); */
-/*     print_dbg(" "); */
-/*     print_dbg_char_hex((ev.data & 0xff00) >> 8); */
-/*     print_dbg(" "); */
-/*     print_dbg_char_hex((ev.data & 0xff0000) >> 16); */
-/*     print_dbg(" "); */
-/*     print_dbg_char_hex((ev.data & 0xff000000) >> 24); */
-/*     print_dbg(" "); */
-/*     event_post(&ev); */
-/*   } */
-/* } */
+// parse the buffer of usb-midi packets and spawn appropriate events
+static void midi_parse(void) {
+  u8* src = rxBuf;
+  u8* end = rxBuf + rxBytes;
+  u8 n;
+
+  while((src + MIDI_USB_PACKET_SIZE) <= end) {
+    n = cinBytes[src[0] & 0xf];
+    if(n > 0) {
+      midi_parse_byte(src[1]);
+      if(n > 1) { midi_parse_byte(src[2]); }
+      if(n > 2) { midi_parse_byte(src[3]); }
+    }
+    src += MIDI_USB_PACKET_SIZE;
+  }
+}
+
+// usb-midi packet for a message on cable 0
+static inline u32 midi_out_packet(u8 status, u8 d1, u8 d2) {
+  return ((u32)(status >> 4) << 24) | ((u32)status << 16) | ((u32)d1 << 8) | d2;
+}
+
+// copy a packet into the tx buffer
+static inline u8* midi_out_put(u8* dst, u32 pkt) {
+  *dst++ = (pkt >> 24) & 0xff;
+  *dst++ = (pkt >> 16) & 0xff;
+  *dst++ = (pkt >> 8) & 0xff;
+  *dst++ = pkt & 0xff;
+  return dst;
+}
+
+// clear all pending output
+static void midi_out_reset(void) {
+  u8 i;
+  outHead = outTail = 0;
+  for(i=0; i<16; ++i) {
+    ccPending[i][0] = ccPending[i][1] = ccPending[i][2] = ccPending[i][3] = 0;
+  }
+  ccChanPending = 0;
+  pressPending = 0;
+  bendPending = 0;
+  midiOutDirty = 0;
+}
 
 // callback for the non-blocking asynchronous read.
 static void midi_rx_done( usb_add_t add,
@@ -195,9 +247,8 @@ static void midi_rx_done( usb_add_t add,
     /*   print_dbg_char_hex(rxBuf[i]); */
     /*   print_dbg(" "); */
     /* } */
-    //  rxBytes = nb;
-    // weird extra first byte...
-    rxBytes = nb - 1;
+    // the first byte of each packet is the usb-midi header
+    rxBytes = nb;
     midi_parse();
   } 
 }
@@ -206,8 +257,7 @@ static void midi_tx_done( usb_add_t add,
 			  usb_ep_t ep,
 			  uhd_trans_status_t stat,
 			  iram_size_t nb) {
-
-  //...
+  txBusy = false;
 }
 
 //-----------------------------------------
@@ -225,16 +275,105 @@ extern void midi_read(void) {
 
 // write to MIDI device
 extern void midi_write(u8* data, u32 bytes) {
+  txBusy = true;
   if (!uhi_midi_out_run(data, bytes, &midi_tx_done)) {
-    txBusy = true;
+    txBusy = false;
     //    print_dbg("\r\n midi tx endpoint error");
   }
   return;
 }
 
+// queue a message for output.
+// controllers, channel pressure and pitch bend keep only the latest value.
+extern void midi_send(u8 status, u8 d1, u8 d2) {
+  u8 ch = status & 0xf;
+  if(!outConnected) { return; }
+  switch(status & 0xf0) {
+  case 0xb0:
+    d1 &= 0x7f;
+    ccVal[ch][d1] = d2 & 0x7f;
+    ccPending[ch][d1 >> 5] |= (u32)1 << (d1 & 0x1f);
+    ccChanPending |= 1 << ch;
+    break;
+  case 0xd0:
+    pressVal[ch] = d1 & 0x7f;
+    pressPending |= 1 << ch;
+    break;
+  case 0xe0:
+    bendVal[ch] = (d1 & 0x7f) | ((u16)(d2 & 0x7f) << 7);
+    bendPending |= 1 << ch;
+    break;
+  default:
+    if(((outTail + 1) & MIDI_OUT_QUEUE_MASK) == outHead) {
+      // full, drop it
+      print_dbg("\r\n midi output queue full");
+      return;
+    }
+    outQueue[outTail] = midi_out_packet(status, d1 & 0x7f, d2 & 0x7f);
+    outTail = (outTail + 1) & MIDI_OUT_QUEUE_MASK;
+    break;
+  }
+  midiOutDirty = 1;
+}
+
+// send pending output in one transfer, if the endpoint is free.
+// coalesced values go first, so queued notes use them.
+extern void midi_refresh(void) {
+  u8* dst = txBuf;
+  u8* end = txBuf + MIDI_TX_BUF_SIZE;
+  u8 ch, w, n;
+  u32 bits;
+
+  if(txBusy) { return; }
+
+  while(ccChanPending && dst < end) {
+    ch = __builtin_ctz(ccChanPending);
+    for(w=0; w<4 && dst < end; ++w) {
+      bits = ccPending[ch][w];
+      while(bits && dst < end) {
+	n = (w << 5) | __builtin_ctz(bits);
+	bits &= bits - 1;
+	dst = midi_out_put(dst, midi_out_packet(0xb0 | ch, n, ccVal[ch][n]));
+      }
+      ccPending[ch][w] = bits;
+    }
+    if((ccPending[ch][0] | ccPending[ch][1] | ccPending[ch][2] | ccPending[ch][3]) == 0) {
+      ccChanPending &= ~(1 << ch);
+    }
+  }
+  while(pressPending && dst < end) {
+    ch = __builtin_ctz(pressPending);
+    pressPending &= pressPending - 1;
+    dst = midi_out_put(dst, midi_out_packet(0xd0 | ch, pressVal[ch], 0));
+  }
+  while(bendPending && dst < end) {
+    ch = __builtin_ctz(bendPending);
+    bendPending &= bendPending - 1;
+    dst = midi_out_put(dst, midi_out_packet(0xe0 | ch, bendVal[ch] & 0x7f, bendVal[ch] >> 7));
+  }
+  while(outHead != outTail && dst < end) {
+    dst = midi_out_put(dst, outQueue[outHead]);
+    outHead = (outHead + 1) & MIDI_OUT_QUEUE_MASK;
+  }
+
+  midiOutDirty = (ccChanPending | pressPending | bendPending) || (outHead != outTail);
+  if(dst > txBuf) {
+    midi_write(txBuf, dst - txBuf);
+  }
+}
+
 // MIDI device was plugged or unplugged
 extern void midi_change(uhc_device_t* dev, u8 plug) {
   event_t e;
+  // reset the parser
+  runStatus = 0;
+  dataCount = 0;
+  sysexActive = 0;
+  sysexOverflow = 0;
+  sysexBytes = 0;
+  // drop pending output
+  midi_out_reset();
+  outConnected = plug;
   if(plug) { 
     e.type = kEventMidiConnect; 
   } else {
@@ -250,3 +389,9 @@ extern void midi_change(uhc_device_t* dev, u8 plug) {
 ////
 /* extern void midi_setup(void) { */
 /* } */
+
+// last completed sysex message, without the start and end bytes.
+// valid until the next one completes.
+extern const u8* midi_sysex_data(void) {
+  return sysexBuf[sysexWrite ^ 1];
+}
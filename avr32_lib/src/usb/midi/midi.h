@@ -4,7 +4,24 @@
 #include "types.h"
 #include "uhc.h"
 
-extern u8 midiConnect;
+//-----------------------
+//---- defines
+
+// sysex status bytes
+#define MIDI_SYSEX 0xf0
+#define MIDI_SYSEX_END 0xf7
+
+// longest sysex message kept, not counting start and end bytes
+#define MIDI_SYSEX_BUF_SIZE 256
+
+// packet event data is one complete message:
+// status in the top byte, then the first and second data bytes.
+// running status is expanded, and realtime bytes are sent on their own.
+// for sysex, the status is MIDI_SYSEX and the low 16 bits are the byte count;
+// read the bytes with midi_sysex_data().
+
+// output has messages waiting for midi_refresh()
+extern volatile u8 midiOutDirty;
 
 // read and spawn events (non-blocking)
 extern void midi_read(void);
@@ -12,6 +29,18 @@ extern void midi_read(void);
 // write to MIDI device
 extern void midi_write(u8* data, u32 bytes);
 
+// queue a channel or realtime message for output;
+// dropped while no device is attached.
+// controllers, channel pressure and pitch bend are coalesced to the latest value;
+// everything else is sent in order.
+extern void midi_send(u8 status, u8 d1, u8 d2);
+
+// send pending output, if the device is ready
+extern void midi_refresh(void);
+
+// last completed sysex message
+extern const u8* midi_sysex_data(void);
+
 // MIDI device was plugged or unplugged
 extern void midi_change(uhc_device_t* dev, u8 plug);
 
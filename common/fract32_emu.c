@@ -108,6 +108,9 @@ fract32 shr_fr1x32_clip(fract32 _x, int _y) {
 }
 
 // normalize ( to [0x40000000, 0x7fffffff] or [0x80000000, 0xc0000000] )
+// returns count of redundant sign bits, as bfin SIGNBITS
 int norm_fr1x32(fract32 _x) {
-  // don't really need...?
+  u32 x = (u32)(_x < 0 ? ~_x : _x);
+  if(x == 0) { return 31; }
+  return __builtin_clz(x) - 1;
 }
@@ -63,6 +63,47 @@ fract32 buffer_tap_read(bufferTap *tap) {
   return add_fr1x32(a, mult_fr1x32x32(tap->idx.fr, sub_fr1x32(b, a)));
 }
 
+// 4-point cubic hermite read.
+// neighbors wrap within the loop.
+// terms are scaled down by 8 for headroom, then scaled back.
+fract32 buffer_tap_read_cubic(bufferTap *tap) {
+  const fract32* data = tap->buf->data;
+  const s32 loop = (s32)(tap->loop);
+  const fract32 t = tap->idx.fr;
+  s32 i0 = tap->idx.i;
+  s32 im1, i1, i2;
+  fract32 xm1, x0, x1, x2;
+  fract32 c1, c2, c3, y;
+
+  im1 = i0 - 1;
+  if(im1 < 0) { im1 += loop; }
+  i1 = i0 + 1;
+  if(i1 >= loop) { i1 -= loop; }
+  i2 = i1 + 1;
+  if(i2 >= loop) { i2 -= loop; }
+
+  xm1 = data[im1] >> 3;
+  x0 = data[i0] >> 3;
+  x1 = data[i1] >> 3;
+  x2 = data[i2] >> 3;
+
+  // c1 = (x1 - xm1) / 2
+  c1 = shr_fr1x32(sub_fr1x32(x1, xm1), 1);
+  // c2 = xm1 - 5/2 x0 + 2 x1 - x2 / 2
+  c2 = sub_fr1x32(add_fr1x32(xm1, shl_fr1x32(x1, 1)),
+		  add_fr1x32(add_fr1x32(shl_fr1x32(x0, 1), shr_fr1x32(x0, 1)),
+			     shr_fr1x32(x2, 1)));
+  // c3 = (x2 - xm1) / 2 + 3/2 (x0 - x1)
+  y = sub_fr1x32(x0, x1);
+  c3 = add_fr1x32(shr_fr1x32(sub_fr1x32(x2, xm1), 1),
+		  add_fr1x32(y, shr_fr1x32(y, 1)));
+
+  y = add_fr1x32(mult_fr1x32x32(c3, t), c2);
+  y = add_fr1x32(mult_fr1x32x32(y, t), c1);
+  y = add_fr1x32(mult_fr1x32x32(y, t), x0);
+  return shl_fr1x32(y, 3);
+}
+
 // interpolated write (overwrites old contents)
 void buffer_tap_write(bufferTap *tap, fract32 val) { 
   static s32 idxB;
@@ -106,15 +147,69 @@ void buffer_tap_add(bufferTap *tap, fract32 val) {
 }
 
 
-// increment position of a tap
+// increment position of a tap.
+// fractional parts are 31-bit and non-negative,
+// so the carry is bit 31 of their sum.
 void buffer_tap_next(bufferTap *tap) {
-  add_fix32(&(tap->idx), &(tap->inc));
-  fix32_wrap_range(&(tap->idx), tap->loop );
+  u32 fr = (u32)(tap->idx.fr) + (u32)(tap->inc.fr);
+  tap->idx.i += tap->inc.i + (s32)(fr >> 31);
+  tap->idx.fr = (fract32)(fr & 0x7fffffff);
+  while(tap->idx.i >= (s32)(tap->loop)) {
+    tap->idx.i -= tap->loop;
+  }
+  while(tap->idx.i < 0) {
+    tap->idx.i += tap->loop;
+  }
 }
 
 // set rate (per-sample increment)
 void buffer_tap_set_rate(bufferTap *tap, fix16 rate) {
-   fix16_to_fix32(&rate, &(tap->inc));
+  // floor of the integer part, so the fraction is non-negative
+  tap->inc.i = rate >> 16;
+  tap->inc.fr = (fract32)((rate & 0xffff) << 15);
+}
+
+// set rate as a ratio: rate * mul / div
+void buffer_tap_set_rate_ratio(bufferTap *tap, fix16 rate, u32 mul, u32 div) {
+  // 32.31 increment
+  u64 inc;
+  if(div == 0) { div = 1; }
+  if(rate < 0) { rate = 0; }
+  inc = ( ((u64)rate * (u64)mul) << 15 ) / (u64)div;
+  tap->inc.i = (s32)(inc >> 31);
+  tap->inc.fr = (fract32)(inc & 0x7fffffff);
+}
+
+// set loop endpoint in samples
+void buffer_tap_set_loop_samp(bufferTap *tap, u32 loop) {
+  while(loop > (tap->buf->frames - 1)) {loop -= tap->buf->frames; }
+  tap->loop = loop;
+}
+
+// set tap position in samples (wraps to loop)
+void buffer_tap_set_pos_samp(bufferTap* tap, u32 samps) {
+  while(samps >= tap->loop) {
+    samps -= tap->loop;
+  }
+  tap->idx.i = samps;
+  tap->idx.fr = 0;
+}
+
+// synchronize an interpolated tap with a non-interpolated one,
+// at a given offset in samples.
+void buffer_tap_sync_tapN(bufferTap* tap, bufferTapN* target, u32 samps) {
+  if(target->idx >= samps) {
+    buffer_tap_set_pos_samp(tap, target->idx - samps );
+  } else {
+    buffer_tap_set_pos_samp(tap, (target->idx + tap->loop) - samps );
+  }
+}
+
+// copy all params
+void buffer_tap_copy( bufferTap* src, bufferTap* dst ) {
+  dst->loop = src->loop;
+  dst->idx = src->idx;
+  dst->inc = src->inc;
 }
 
 // set tap position directly
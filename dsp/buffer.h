@@ -41,6 +41,9 @@ typedef struct _bufferTap {
 } bufferTap;
 
 
+// read function for an interpolated tap
+typedef fract32 (*buffer_tap_read_t)(bufferTap* tap);
+
 // ---- bufferTapN
 // class for creating a "tap" or "head."
  // stores position/rate within a buffer.
@@ -91,9 +94,12 @@ extern void buffer_tap_init(bufferTap* tap, audioBuffer* buf);
 // increment the index in a tap
 extern void buffer_tap_next(bufferTap* tap);
 
-// interpolated read
+// interpolated read (linear)
 extern fract32 buffer_tap_read(bufferTap* tap);
 
+// interpolated read (4-point cubic hermite)
+extern fract32 buffer_tap_read_cubic(bufferTap* tap);
+
 // interpolated write (erases old contents)
 extern void buffer_tap_write(bufferTap* tap, fract32 val); 
 
@@ -106,12 +112,18 @@ extern void buffer_tap_add(bufferTap* tap, fract32 val);
 // set rate
 extern void buffer_tap_set_rate(bufferTap *tap, fix16 rate);
 
+// set rate as a ratio: rate * mul / div
+extern void buffer_tap_set_rate_ratio(bufferTap *tap, fix16 rate, u32 mul, u32 div);
+
 // set a different buffer (resets position)
 extern void buffer_tap_set_buf(bufferTap* tap, audioBuffer* buf);
 
 // set loop endpoint in seconds
 extern void buffer_tap_set_loop(bufferTap* tap, fix16 sec);
 
+// set loop endpoint in samples
+extern void buffer_tap_set_loop_samp(bufferTap* tap, u32 samps);
+
 // synchronize one tap with another at a given offset in seconds.
 // useful for delays
 extern void buffer_tap_sync(bufferTap* tap, bufferTap* target, fix16 offset);
@@ -119,6 +131,16 @@ extern void buffer_tap_sync(bufferTap* tap, bufferTap* target, fix16 offset);
 // set tap position directly
 extern void buffer_tap_set_pos(bufferTap* tap, fix16 secs);
 
+// set tap position in samples (fraction is cleared)
+extern void buffer_tap_set_pos_samp(bufferTap* tap, u32 samps);
+
+// synchronize an interpolated tap with a non-interpolated one,
+// at a given offset in samples.
+extern void buffer_tap_sync_tapN(bufferTap* tap, bufferTapN* target, u32 samps);
+
+// copy all params
+extern void buffer_tap_copy( bufferTap* src, bufferTap* dst );
+
 //--------------------------------------------------------
 //---------------------------------------------------------
 //---- non-interpolated taps
@@ -3,45 +3,113 @@
 #include "fix.h"
 #include "module.h"
 
+// conversions are exact, in integer arithmetic only,
+// for any SAMPLERATE that fits in 31 bits.
+//
+// with sec = whole + frac / 2^16, and SAMPLERATE = srHi * 2^16 + srLo:
+// sec * SAMPLERATE = whole * SAMPLERATE + frac * srHi + (frac * srLo) / 2^16
+// the last two products fit in 32 bits.
+// the first needs up to 15 + 31 bits, so the sum is formed in 64 bits.
 
-/// convert fix16 seconds to u32 frames, truncating
+#define CONV_SR_HI ((u32)SAMPLERATE >> 16)
+#define CONV_SR_LO ((u32)SAMPLERATE & 0xffff)
 
-// convert seconds in 16.16 to samples in 32.32
-void sec_to_frames_fract(fix16* time, fix32* samps) {
-  static float fSamps;
-  // FIXME: using float
-  fSamps = (float)SAMPLERATE * fix16_to_float(*time);
-  samps->i = (int)fSamps;
-  samps->fr = float_to_fr32(fSamps - samps->i);
+//-------------------
+//--- static functions
+
+// frames from non-negative seconds: integer part and remainder in 1/2^16 frames.
+// saturates at 0xffffffff frames, with no remainder.
+static inline u32 sec_to_frames_rem(fix16 sec, u32* rem) {
+  const u32 whole = (u32)sec >> 16;
+  const u32 frac = (u32)sec & 0xffff;
+  const u32 lo = frac * CONV_SR_LO;
+  const u64 frames = (u64)whole * (u64)SAMPLERATE + frac * CONV_SR_HI + (lo >> 16);
+  if(frames >= 0xffffffff) {
+    *rem = 0;
+    return 0xffffffff;
+  }
+  *rem = lo & 0xffff;
+  return (u32)frames;
 }
 
-u32 sec_to_frames_trunc(fix16 sec) {
-  // FIXME: using float...
-  return (u32)((float)SAMPLERATE * fix16_to_float(sec));
-  /*
-  u32 res;
-
-  // whole seconds
-  if(sec > 0xffff) {
-     res = (u32)( (sec >> 16 ) * SAMPLERATE );
-  } else {
-    res = 0;
-  }
-  // fractional seconds
-  // FIXME (?): assuming sample rate <= 65k, not a portable assumption
-  // FIXME: should probly round instead
-  res += (u32)(fix16_mul(sec & 0xffff, SAMPLERATE << 16) >> 16);
-  return res;
-  */
+//-------------------
+//--- extern functions
 
+// convert seconds in 16.16 to samples in 32.32
+void sec_to_frames_fract(fix16* time, fix32* samps) {
+  u32 rem, frames;
+  if(*time <= 0) {
+    samps->i = 0;
+    samps->fr = 0;
+    return;
+  }
+  frames = sec_to_frames_rem(*time, &rem);
+  if(frames > 0x7fffffff) {
+    samps->i = 0x7fffffff;
+    samps->fr = 0;
+    return;
+  }
+  samps->i = (s32)frames;
+  // 16-bit remainder to 31-bit fraction
+  samps->fr = (fract32)(rem << 15);
 }
 
+// convert seconds in 16.16 to frames, with given rounding
+u32 sec_to_frames(fix16 sec, eConvRound round) {
+  u32 rem, frames;
+  if(sec <= 0) {
+    return 0;
+  }
+  frames = sec_to_frames_rem(sec, &rem);
+  switch(round) {
+  case eConvRoundNearest :
+    frames += (rem >= 0x8000);
+    break;
+  case eConvRoundUp :
+    frames += (rem != 0);
+    break;
+  default :
+    break;
+  }
+  return frames;
+}
 
-/*
-// multiply fix16 by (truncated) fract32
-// non-saturating, unfortunately
-static inline fract32 mul_fr32_fix16(fract32 fr, fix16 fix) {
-  return shl_fr1x32(fix16_mul(trunc_fr1x32(fr), fix), 15);
+// convert fix16 seconds to u32 frames, truncating
+u32 sec_to_frames_trunc(fix16 sec) {
+  return sec_to_frames(sec, eConvRoundTrunc);
 }
 
-*/
+// convert frames to seconds in 16.16, with given rounding
+fix16 frames_to_sec(u32 frames, eConvRound round) {
+  u32 whole = frames / (u32)SAMPLERATE;
+  u32 rem = frames - whole * (u32)SAMPLERATE;
+  u32 frac = 0;
+  u8 i;
+  if(whole > 0x7fff) {
+    return (fix16)0x7fffffff;
+  }
+  // 16 bits of remainder / SAMPLERATE, by long division
+  for(i=0; i<16; i++) {
+    rem <<= 1;
+    frac <<= 1;
+    if(rem >= (u32)SAMPLERATE) {
+      rem -= (u32)SAMPLERATE;
+      frac |= 1;
+    }
+  }
+  switch(round) {
+  case eConvRoundNearest :
+    frac += ( (rem << 1) >= (u32)SAMPLERATE );
+    break;
+  case eConvRoundUp :
+    frac += (rem != 0);
+    break;
+  default :
+    break;
+  }
+  // carry of rounding moves into the whole part
+  if( ((whole << 16) + frac) > 0x7fffffff ) {
+    return (fix16)0x7fffffff;
+  }
+  return (fix16)((whole << 16) + frac);
+}
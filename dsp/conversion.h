@@ -5,10 +5,29 @@
 #include "fix.h"
 #include "fix32.h"
 
-// seconds in 16.16 to frames in 32.32
+// rounding modes for time conversion
+typedef enum {
+  // toward zero
+  eConvRoundTrunc,
+  // to nearest, halves up
+  eConvRoundNearest,
+  // away from zero
+  eConvRoundUp
+} eConvRound;
+
+// seconds in 16.16 to frames in 32.32 (exact).
+// negative times give 0; saturates at the largest s32 frame count.
 extern void sec_to_frames_fract(fix16* time, fix32* samps);
 
+// seconds in 16.16 to frames, with given rounding.
+// negative times give 0; saturates at 0xffffffff frames.
+extern u32 sec_to_frames(fix16 sec, eConvRound round);
+
 // seconds to frames, truncated
 extern u32 sec_to_frames_trunc(fix16 sec);
 
+// frames to seconds in 16.16, with given rounding.
+// saturates at the largest fix16.
+extern fix16 frames_to_sec(u32 frames, eConvRound round);
+
 #endif // _CONVERSION_H_
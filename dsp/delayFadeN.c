@@ -4,29 +4,32 @@
 
   implement delay line using buffer and tap objects
 
-  this one uses no interpolation, 
-  and has two taps per read head to enable crossfading
+  read heads are interpolated (linear or cubic) and run at fractional rates;
+  write heads are not interpolated.
+  there are two taps per read head to enable crossfading
   
  */
 
 #include "conversion.h"
 #include "delayFadeN.h"
-#include "pan.h"
 
 // initialize with pointer to audio buffer
 extern void delayFadeN_init(delayFadeN* dl, fract32* data, u32 frames) {
   buffer_init(&(dl->buffer), data, frames);
   
-  buffer_tapN_init(&(dl->tapRd[1]), &(dl->buffer));
+  buffer_tap_init(&(dl->tapRd[1]), &(dl->buffer));
   buffer_tapN_init(&(dl->tapWr[1]), &(dl->buffer));
 
-  buffer_tapN_init(&(dl->tapRd[0]), &(dl->buffer));
+  buffer_tap_init(&(dl->tapRd[0]), &(dl->buffer));
   buffer_tapN_init(&(dl->tapWr[0]), &(dl->buffer));
 
   dl->tapWr[0].idx = 0;
   dl->tapWr[1].idx = 0;
-  dl->tapRd[0].idx = 0;
-  dl->tapRd[1].idx = 0;
+
+  dl->read = &buffer_tap_read_cubic;
+  dl->rate = FIX16_ONE;
+  dl->rateMul = 1;
+  dl->rateDiv = 1;
 
   dl->tapWr[0].loop = frames;
   dl->tapWr[1].loop = frames;
@@ -37,38 +40,26 @@ extern void delayFadeN_init(delayFadeN* dl, fract32* data, u32 frames) {
   dl->write = 1;
 
 
-  //??
-  dl->fadeRd = 0;
-  dl->fadeWr = 0;
-  //  dl->fadeRd = FR32_MAX;
-  //  dl->fadeWr = FR32_MAX;
-  
-  
+  fade_tap_init(&(dl->fadeRd));
 }
 
 extern fract32 delayFadeN_next(delayFadeN* dl, fract32 in) {
   fract32 readVal;
-  fract32 pan[2] = { 0, 0 };
+  fract32 gain[2];
   fract32 valWr[2] = { 0, 0 };
+  const u8 fading = dl->fadeRd.busy;
 
   // get read value first.
   // so, setting loop == delayFadeNtime gives "sensible" results...
-
-  //  readVal = buffer_tapN_read( &(dl->tapRd) );
-  /// balanced mix given current pan  
-  readVal = pan_mix( buffer_tapN_read( &(dl->tapRd[0]) ) ,
-		     buffer_tapN_read( &(dl->tapRd[1]) ) ,
-		     //		     filter_1p_lo_next( &(dl->lpRdPan) )
-		     dl->fadeRd
-		     );
-  // TEST: reread with no pan
-  //  readVal = buffer_tapN_read( &(dl->tapRd[0]) );
-
-  // get mix amounts for crossfaded write heads
-  pan_coeff( &(pan[0]), &(pan[1]), dl->fadeWr );
-
-  //  valWr[0] = mult_fr1x32x32(in, pan[0]);
-  //  valWr[1] = mult_fr1x32x32(in, pan[1]);
+  if(fading) {
+    // equal-power mix of both taps
+    fade_tap_next(&(dl->fadeRd), gain);
+    readVal = add_fr1x32( mult_fr1x32x32( (*(dl->read))( &(dl->tapRd[0]) ), gain[0] ),
+			  mult_fr1x32x32( (*(dl->read))( &(dl->tapRd[1]) ), gain[1] ) );
+  } else {
+    // idle: only the target tap is heard
+    readVal = (*(dl->read))( &(dl->tapRd[dl->fadeRd.target]) );
+  }
 
   /// FIXME: use single write head for now.
   /// need to make them toggle run/stop depending on fade level.
@@ -99,10 +90,16 @@ extern fract32 delayFadeN_next(delayFadeN* dl, fract32 in) {
     }
   }
 
-  // advance the read phasors
+  // advance the read phasors.
+  // the idle tap is copied from the target when a fade starts,
+  // so it only needs to move during a fade.
   if(dl->runRd) {
-    buffer_tapN_next( &(dl->tapRd[0]) );
-    buffer_tapN_next( &(dl->tapRd[1]) );
+    if(fading) {
+      buffer_tap_next( &(dl->tapRd[0]) );
+      buffer_tap_next( &(dl->tapRd[1]) );
+    } else {
+      buffer_tap_next( &(dl->tapRd[dl->fadeRd.target]) );
+    }
   }
 
   // advance the write phasors
@@ -118,7 +115,7 @@ extern fract32 delayFadeN_next(delayFadeN* dl, fract32 in) {
 // set loop endpoint in seconds
 extern void delayFadeN_set_loop_sec(delayFadeN* dl, fix16 sec, u8 id) {
   u32 samps = sec_to_frames_trunc(sec);
-  buffer_tapN_set_loop(&(dl->tapRd[id]), samps - 1);
+  buffer_tap_set_loop_samp(&(dl->tapRd[id]), samps - 1);
   buffer_tapN_set_loop(&(dl->tapWr[id]), samps - 1);
 
 }
@@ -137,14 +134,14 @@ extern void delayFadeN_set_delay_sec(delayFadeN* dl, fix16 sec, u8 id) {
   // -- something fucks up with i think delay > looptime... infinite wrap or something
   //  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr[id]), samp);
   //// FIXME: only one write head for now
-  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr[0]), samp);
+  buffer_tap_sync_tapN(&(dl->tapRd[id]), &(dl->tapWr[0]), samp);
 }
 
 // set delayFadeN in samples
 extern void delayFadeN_set_delay_samp(delayFadeN* dl, u32 samp, u8 id) {
   //  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr[id]), samp);
   //// FIXME: only one write head for now
-  buffer_tapN_sync(&(dl->tapRd[id]), &(dl->tapWr[0]), samp);
+  buffer_tap_sync_tapN(&(dl->tapRd[id]), &(dl->tapWr[0]), samp);
 }
 
 // set erase level
@@ -158,18 +155,24 @@ extern void delayFadeN_set_write(delayFadeN* dl, u8 write) {
 }
 
 // set read head rate
-extern void delayFadeN_set_rate(delayFadeN* dl, fix16 rate) {
-  ///...
+extern void delayFadeN_set_rate(delayFadeN* dl, fix16 rate, u8 id) {
+  dl->rate = rate;
+  buffer_tap_set_rate_ratio( &(dl->tapRd[id]), dl->rate, dl->rateMul, dl->rateDiv );
+}
+
+// set read interpolation (0 = linear, 1 = cubic)
+extern void delayFadeN_set_cubic(delayFadeN* dl, u8 cubic) {
+  dl->read = cubic ? &buffer_tap_read_cubic : &buffer_tap_read;
 }
 
 // set read pos in seconds
 extern void delayFadeN_set_pos_read_sec(delayFadeN* dl, fix16 sec, u8 id) {
   u32 samp = sec_to_frames_trunc(sec);
-  buffer_tapN_set_pos(&(dl->tapRd[id]), samp);
+  buffer_tap_set_pos_samp(&(dl->tapRd[id]), samp);
 }
 
 extern void delayFadeN_set_pos_read_samp(delayFadeN* dl, u32 samp, u8 id) {
-  buffer_tapN_set_pos(&(dl->tapRd[id]), samp);
+  buffer_tap_set_pos_samp(&(dl->tapRd[id]), samp);
 }
 
 // set write pos in seconds
@@ -194,12 +197,45 @@ extern void delayFadeN_set_run_write(delayFadeN* dl, u8 val) {
 
 // set read-head rate multiplier
 void delayFadeN_set_mul(delayFadeN* dl, u32 val, u8 id) {
-  // different terms, dumb...
-  buffer_tapN_set_inc( &(dl->tapRd[id]), val );
-
+  dl->rateMul = val;
+  buffer_tap_set_rate_ratio( &(dl->tapRd[id]), dl->rate, dl->rateMul, dl->rateDiv );
 }
 
 // set read-head rate divider
 void delayFadeN_set_div(delayFadeN* dl, u32 val, u8 id) {
-  buffer_tapN_set_div( &(dl->tapRd[id]), val );
+  dl->rateDiv = val;
+  buffer_tap_set_rate_ratio( &(dl->tapRd[id]), dl->rate, dl->rateMul, dl->rateDiv );
+}
+
+// set read crossfade length in samples
+void delayFadeN_set_fade_samp(delayFadeN* dl, u32 samps) {
+  fade_tap_set_len(&(dl->fadeRd), samps);
+}
+
+// start a read crossfade to the other tap, copying the current tap.
+// this is called from the param interrupt, which the audio interrupt preempts;
+// the audio interrupt is held off so it can't advance the source tap mid-copy,
+// or see the copy and the fade start out of step.
+u8 delayFadeN_fade_read(delayFadeN* dl) {
+  const u8 src = dl->fadeRd.target;
+#ifdef ARCH_BFIN
+  u32 imask;
+#endif
+  if(dl->fadeRd.busy) {
+    return src;
+  }
+#ifdef ARCH_BFIN
+  asm volatile ("cli %0;" : "=d"(imask));
+#endif
+  buffer_tap_copy( &(dl->tapRd[src]), &(dl->tapRd[src ^ 1]) );
+  fade_tap_start(&(dl->fadeRd), src ^ 1);
+#ifdef ARCH_BFIN
+  asm volatile ("sti %0; csync;" : : "d"(imask));
+#endif
+  return src ^ 1;
+}
+
+// index of the read tap that is (or will be) heard
+u8 delayFadeN_read_target(delayFadeN* dl) {
+  return dl->fadeRd.target;
 }
@@ -9,7 +9,7 @@ delay line object interface
 #define _ALEPH_LINES_DELAYLINE_H_
 
 #include "buffer.h"
-#include "fade.h"
+#include "fade_tap.h"
 #include "types.h"
 
 // delay line data structure
@@ -17,9 +17,16 @@ delay line object interface
 typedef struct _delayFadeN {
   //-- audio buffer class
   audioBuffer buffer;
-  //-- read and write taps (non-interpolated)
-  bufferTapN tapRd[2];
+  //-- read taps (interpolated, fractional rate)
+  bufferTap tapRd[2];
+  //-- write taps (non-interpolated)
   bufferTapN tapWr[2];
+  // read function for the interpolation mode
+  buffer_tap_read_t read;
+  // read rate, as fix16 rate times mul / div
+  fix16 rate;
+  u32 rateMul;
+  u32 rateDiv;
   // level of existing data to mix with new data
   // negative == 1
   fract32 preLevel;
@@ -30,9 +37,8 @@ typedef struct _delayFadeN {
   // flags to run or pause each tap (phasor)
   u8 runRd;
   u8 runWr;
-  // crossfade parameters [0-1]
-  fract32 fadeRd;
-  fract32 fadeWr;
+  // crossfade between read taps
+  fadeTap fadeRd;
   
   /* // interpolaters */
   /* filter_1p_lo lpRdPan; */
@@ -54,7 +60,9 @@ extern void delayFadeN_set_loop_samp(delayFadeN* dl, u32 samp , u8 id );
 extern void delayFadeN_set_delay_sec(delayFadeN* dl, fix16 sec, u8 id );
 extern void delayFadeN_set_delay_samp(delayFadeN* dl, u32 samp, u8 id ); 
 // set read head rate
-//extern void delayFadeN_set_rate(delayFadeN* dl, fix16 rate , u8 id );
+extern void delayFadeN_set_rate(delayFadeN* dl, fix16 rate , u8 id );
+// set read interpolation (0 = linear, 1 = cubic)
+extern void delayFadeN_set_cubic(delayFadeN* dl, u8 cubic);
 // set erase level
 extern void delayFadeN_set_pre(delayFadeN* dl, fract32 pre);
 // set write flag
@@ -83,5 +91,14 @@ extern void delayFadeN_set_pre(delayFadeN* dl, fract32 pre);
 // set write level
 extern void delayFadeN_set_write(delayFadeN* dl, u8 write);
 
+// set read crossfade length in samples
+extern void delayFadeN_set_fade_samp(delayFadeN* dl, u32 samps);
+// start a read crossfade to the other tap, copying the current tap.
+// returns the index of the tap faded towards;
+// if a fade is in progress, it continues and its target is returned.
+extern u8 delayFadeN_fade_read(delayFadeN* dl);
+// index of the read tap that is (or will be) heard
+extern u8 delayFadeN_read_target(delayFadeN* dl);
+
 
 #endif // h guard
@@ -0,0 +1,184 @@
+/* exp_log.c
+   dsp
+   aleph
+
+   fixed-point exponential and logarithm kernels.
+   tables hold 64 segments of an octave;
+   a short polynomial covers the remainder of each segment.
+ */
+
+#include "fix.h"
+#include "fract_math.h"
+#include "exp_log.h"
+
+// segments per octave
+#define EXP_LOG_SEG_BITS 6
+#define EXP_LOG_SEG_SHIFT (32 - EXP_LOG_SEG_BITS)
+
+// ln(2), 1.31
+#define LN2_FR32 0x58b90bfc
+// 1 / ln(2) - 1, 1.31
+#define LOG2E_1_FR32 0x38aa3b29
+// log2(10) / 20, 1.31
+#define DB_TO_OCT_FR32 0x1542a5a1
+// 1 / 12, 0.32
+#define SEMI_TO_OCT_U32 0x15555555
+// notes outside this range saturate, or give 0 hz
+#define NOTE_HZ_MIN (-(240 << 16))
+#define NOTE_HZ_MAX (144 << 16)
+
+// 2^(k/64), 2.30
+static const u32 exp2Tab[(1 << EXP_LOG_SEG_BITS) + 1] = {
+  0x40000000, 0x40b268fa, 0x4166c34c, 0x421d1462,
+  0x42d561b4, 0x438fb0cb, 0x444c0740, 0x450a6abb,
+  0x45cae0f2, 0x468d6fae, 0x47521cc6, 0x4818ee22,
+  0x48e1e9ba, 0x49ad1598, 0x4a7a77d4, 0x4b4a169c,
+  0x4c1bf829, 0x4cf022ca, 0x4dc69cdd, 0x4e9f6cd4,
+  0x4f7a9930, 0x50582888, 0x51382182, 0x521a8ad7,
+  0x52ff6b55, 0x53e6c9da, 0x54d0ad5a, 0x55bd1cdb,
+  0x56ac1f75, 0x579dbc57, 0x5891fac1, 0x5988e209,
+  0x5a82799a, 0x5b7ec8f2, 0x5c7dd7a4, 0x5d7fad59,
+  0x5e8451d0, 0x5f8bccdb, 0x60962665, 0x61a3666d,
+  0x62b39509, 0x63c6ba64, 0x64dcdec3, 0x65f60a7f,
+  0x6712460b, 0x683199ed, 0x69540ec9, 0x6a79ad56,
+  0x6ba27e65, 0x6cce8ae1, 0x6dfddbcc, 0x6f307a41,
+  0x70666f76, 0x719fc4b9, 0x72dc8374, 0x741cb528,
+  0x75606374, 0x76a7980f, 0x77f25cce, 0x7940bb9e,
+  0x7a92be8b, 0x7be86fba, 0x7d41d96e, 0x7e9f0606,
+  0x80000000,
+};
+
+// log2(1 + k/64), 1.31
+static const fract32 log2Tab[(1 << EXP_LOG_SEG_BITS) + 1] = {
+  0x00000000, 0x02dcf2d1, 0x05aeb4dd, 0x08759c50,
+  0x0b31fb7d, 0x0de42120, 0x108c588d, 0x132ae9e2,
+  0x15c01a3a, 0x184c2bd0, 0x1acf5e2e, 0x1d49ee4c,
+  0x1fbc16b9, 0x22260fb6, 0x24880f56, 0x26e2499d,
+  0x2934f098, 0x2b803474, 0x2dc4439b, 0x30014ac6,
+  0x32377512, 0x3466ec15, 0x368fd7ee, 0x38b25f5a,
+  0x3acea7c0, 0x3ce4d544, 0x3ef50ad2, 0x40ff6a2e,
+  0x43041403, 0x450327eb, 0x46fcc47a, 0x48f10751,
+  0x4ae00d1d, 0x4cc9f1ab, 0x4eaecfeb, 0x508ec1fa,
+  0x5269e12f, 0x5440461c, 0x5612089a, 0x57df3fd0,
+  0x59a80239, 0x5b6c65aa, 0x5d2c7f59, 0x5ee863e5,
+  0x60a02757, 0x6253dd2c, 0x64039858, 0x65af6b4b,
+  0x675767f5, 0x68fb9fce, 0x6a9c23d6, 0x6c39049b,
+  0x6dd2523d, 0x6f681c73, 0x70fa728c, 0x72896373,
+  0x7414fdb5, 0x759d4f81, 0x772266ad, 0x78a450b8,
+  0x7a231ace, 0x7b9ed1c7, 0x7d17822f, 0x7e8d3846,
+  0x7fffffff,
+};
+
+// 1 / (1 + k/64), 1.31
+static const fract32 recipTab[1 << EXP_LOG_SEG_BITS] = {
+  0x7fffffff, 0x7e07e07e, 0x7c1f07c2, 0x7a44c6b0,
+  0x78787878, 0x76b981db, 0x75075075, 0x73615a24,
+  0x71c71c72, 0x70381c0e, 0x6eb3e453, 0x6d3a06d4,
+  0x6bca1af3, 0x6a63bd82, 0x69069069, 0x67b23a54,
+  0x66666666, 0x6522c3f3, 0x63e7063e, 0x62b2e43e,
+  0x61861862, 0x60606060, 0x5f417d06, 0x5e293206,
+  0x5d1745d1, 0x5c0b8170, 0x5b05b05b, 0x5a05a05a,
+  0x590b2164, 0x58160581, 0x572620ae, 0x563b48c2,
+  0x55555555, 0x54741fac, 0x5397829d, 0x52bf5a81,
+  0x51eb851f, 0x511be196, 0x50505050, 0x4f88b2f4,
+  0x4ec4ec4f, 0x4e04e04e, 0x4d4873ed, 0x4c8f8d29,
+  0x4bda12f7, 0x4b27ed36, 0x4a7904a8, 0x49cd42e2,
+  0x49249249, 0x487ede05, 0x47dc11f7, 0x473c1ab7,
+  0x469ee584, 0x46046046, 0x456c797e, 0x44d72045,
+  0x44444444, 0x43b3d5b0, 0x4325c53f, 0x429a042a,
+  0x42108421, 0x4189374c, 0x41041041, 0x40810204,
+};
+
+//----------------------
+//---- extern functions
+
+// 2^f for f in [0, 1) as 0.32, result in [1, 2) as 2.30
+u32 exp2_frac(u32 f) {
+  const u32 k = f >> EXP_LOG_SEG_SHIFT;
+  // remainder within the segment as 1.31, in [0, 1/64)
+  const fract32 r = (fract32)((f & ((1 << EXP_LOG_SEG_SHIFT) - 1)) >> 1);
+  // 2^r = e^t, t = r ln2;  e^t ~ 1 + t + t^2/2
+  const fract32 t = mult_fr1x32x32(r, LN2_FR32);
+  const fract32 p = add_fr1x32(t, mult_fr1x32x32(t, t) >> 1);
+  return exp2Tab[k] + (u32)mult_fr1x32x32((fract32)exp2Tab[k], p);
+}
+
+// log2(m) for m in [1, 2) as 2.30, result in [0, 1) as 1.31
+fract32 log2_frac(u32 m) {
+  const u32 k = (m >> (30 - EXP_LOG_SEG_BITS)) & ((1 << EXP_LOG_SEG_BITS) - 1);
+  // m / (1 + k/64) - 1 as 1.31, in [0, 1/64) (or a hair below 0, from rounding)
+  const fract32 y = shl_fr1x32(sub_fr1x32(mult_fr1x32x32((fract32)m, recipTab[k]), 1 << 30), 1);
+  // ln(1 + y) ~ y - y^2/2 + y^3/3
+  const fract32 y2 = mult_fr1x32x32(y, y);
+  fract32 l = sub_fr1x32(y, y2 >> 1);
+  l = add_fr1x32(l, mult_fr1x32x32(mult_fr1x32x32(y2, y), 0x2aaaaaab));
+  // to base 2: l / ln2 = l + l * (1/ln2 - 1)
+  l = add_fr1x32(l, mult_fr1x32x32(l, LOG2E_1_FR32));
+  return add_fr1x32(log2Tab[k], l);
+}
+
+// 2^x, x and result in 16.16
+fix16 exp2_fix16(fix16 x) {
+  const s32 i = x >> 16;
+  const u32 m = exp2_frac((u32)x << 16);
+  if(i >= 15) {
+    return (fix16)0x7fffffff;
+  }
+  if(i > -18) {
+    // 2.30 -> 16.16, scaled by 2^i
+    return (fix16)(m >> (14 - i));
+  }
+  return 0;
+}
+
+// log2(x), x and result in 16.16; x <= 0 gives the smallest fix16
+fix16 log2_fix16(fix16 x) {
+  s32 n;
+  if(x <= 0) {
+    return (fix16)0x80000000;
+  }
+  // normalize to [1, 2) as 2.30
+  n = norm_fr1x32(x);
+  // x = m * 2^(14 - n)
+  return (fix16)((14 - n) * 0x10000) + (log2_frac((u32)x << n) >> 15);
+}
+
+// gain in decibels (16.16) to linear amplitude (1.31), saturating at unity
+fract32 db_to_amp(fix16 db) {
+  // octaves, 16.16
+  const fix16 oct = mult_fr1x32x32(db, DB_TO_OCT_FR32);
+  const s32 i = oct >> 16;
+  if(oct >= 0) {
+    return FR32_MAX;
+  }
+  if(i < -31) {
+    return 0;
+  }
+  // 2.30 mantissa, times 2^i, to 1.31
+  return (fract32)(exp2_frac((u32)oct << 16) >> (-i - 1));
+}
+
+// midi note number (16.16) to frequency in hz (16.16), with a4 = 440hz
+fix16 note_to_hz(fix16 note) {
+  s64 oct;
+  s32 i;
+  u32 hz;
+  if(note < NOTE_HZ_MIN) { note = NOTE_HZ_MIN; }
+  if(note > NOTE_HZ_MAX) { note = NOTE_HZ_MAX; }
+  // octaves from a4, 32.32.
+  // a 16.16 octave would step by 0.018 cents, so keep the full fraction.
+  oct = ((s64)(note - (69 << 16)) * SEMI_TO_OCT_U32) >> 16;
+  i = (s32)(oct >> 32);
+  // 440 * mantissa, 16.16, rounded
+  hz = (u32)(((u64)(440 << 16) * exp2_frac((u32)oct) + (1 << 29)) >> 30);
+  if(i >= 0) {
+    if(i > 6 || hz > (0x7fffffffu >> i)) {
+      return (fix16)0x7fffffff;
+    }
+    return (fix16)(hz << i);
+  }
+  if(i > -31) {
+    return (fix16)(hz >> -i);
+  }
+  return 0;
+}
@@ -0,0 +1,43 @@
+/* exp_log.h
+   dsp
+   aleph
+
+   fixed-point exponential and logarithm kernels,
+   for pitch and amplitude at audio rate.
+   each uses a 65-point table over one octave and a short polynomial;
+   no floating point, no division.
+
+   error bounds (measured against double precision on the host):
+   - exp2_frac  : relative error < 2.2e-7 (about 22 bits)
+   - log2_frac  : absolute error < 2.1e-8
+   - exp2_fix16 : within 1 lsb, or 1.6e-5 relative above 1.0
+   - log2_fix16 : within 1 lsb
+   - db_to_amp  : relative error < 3e-5 (0.0003 db), or 2 lsb for tiny gains
+   - note_to_hz : relative error < 2.1e-6 (0.004 cents) above 8 hz;
+                  notes are clamped to [-240, 144]; the result is 0 hz
+                  below about -228 and saturates above about 143.6
+   the wrappers are limited by the 16.16 resolution of their inputs.
+ */
+
+#ifndef _ALEPH_DSP_EXP_LOG_H_
+#define _ALEPH_DSP_EXP_LOG_H_
+
+#include "fix.h"
+#include "types.h"
+
+// 2^f for f in [0, 1) as 0.32, result in [1, 2) as 2.30
+extern u32 exp2_frac(u32 f);
+// log2(m) for m in [1, 2) as 2.30, result in [0, 1) as 1.31
+extern fract32 log2_frac(u32 m);
+
+// 2^x, x and result in 16.16, saturating
+extern fix16 exp2_fix16(fix16 x);
+// log2(x), x and result in 16.16; x <= 0 gives the smallest fix16
+extern fix16 log2_fix16(fix16 x);
+
+// gain in decibels (16.16) to linear amplitude (1.31), saturating at unity
+extern fract32 db_to_amp(fix16 db);
+// midi note number (16.16) to frequency in hz (16.16), with a4 = 440hz
+extern fix16 note_to_hz(fix16 note);
+
+#endif
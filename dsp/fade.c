@@ -5,8 +5,8 @@
 #include "fade.h"
 
 
-#define FADE_SINE_BUF_SIZE 1024
-#define FADE_SINE_BUF_SIZE_FIX (1024 << 16)
+#define FADE_SINE_BUF_BITS 10
+#define FADE_SINE_BUF_SIZE (1 << FADE_SINE_BUF_BITS)
 
 static const fract32 sineTab[FADE_SINE_BUF_SIZE] = {
 #include "halfsine_1024.inc"
@@ -64,10 +64,10 @@ fract32 fade_ep_pos(fadeEP* fade, fract32 v) {
 // recalculate without input
 fract32 fade_ep_calc(fadeEP* fade) {
   // FIXME: far from optimal.
-  /// fractional position converted to table index
-  fix16 xIdx = fix16_mul(FRACT_FIX16(fade->pos), FADE_SINE_BUF_SIZE_FIX);
-  fix16 yIdx = fix16_sub(FADE_SINE_BUF_SIZE_FIX, xIdx);
-  fract32 xmul = table_lookup_idx(sineTab, FADE_SINE_BUF_SIZE, xIdx);
-  fract32 ymul = table_lookup_idx(sineTab, FADE_SINE_BUF_SIZE, yIdx);
+  /// fractional position converted to table phase
+  u32 xPhase = (u32)(fade->pos) << 1;
+  u32 yPhase = 0 - xPhase;
+  fract32 xmul = table_lookup_phase(sineTab, FADE_SINE_BUF_BITS, xPhase);
+  fract32 ymul = table_lookup_phase(sineTab, FADE_SINE_BUF_BITS, yPhase);
   return add_fr1x32( mult_fr1x32x32(fade->x, xmul), mult_fr1x32x32(fade->y, ymul) ); 
 }
@@ -0,0 +1,68 @@
+/* fade_tap.c
+   dsp
+   aleph
+
+   equal-power crossfade between two taps.
+ */
+
+#include "fix.h"
+#include "fract_math.h"
+#include "fade_tap.h"
+
+// quarter sine, with guard point
+#define FADE_TAP_TAB_BITS 8
+#define FADE_TAP_TAB_SIZE ((1 << FADE_TAP_TAB_BITS) + 1)
+// shift from 1.31 position to table index
+#define FADE_TAP_IDX_SHIFT (31 - FADE_TAP_TAB_BITS)
+#define FADE_TAP_FRACT_MASK ((1 << FADE_TAP_IDX_SHIFT) - 1)
+
+static const fract32 fadeTab[FADE_TAP_TAB_SIZE] = {
+#include "quartersine_257.inc"
+};
+
+// sin(pos * pi / 2) for pos in [0-1]
+static inline fract32 fade_tap_gain(fract32 pos) {
+  const u32 idx = (u32)pos >> FADE_TAP_IDX_SHIFT;
+  const fract32 fr = (pos & FADE_TAP_FRACT_MASK) << (31 - FADE_TAP_IDX_SHIFT);
+  const fract32 a = fadeTab[idx];
+  const fract32 b = fadeTab[idx + 1];
+  return add_fr1x32(a, mult_fr1x32x32(fr, sub_fr1x32(b, a)));
+}
+
+// initialize (idle, at tap 0)
+void fade_tap_init(fadeTap* f) {
+  f->pos = FR32_MAX;
+  f->inc = FR32_MAX;
+  f->target = 0;
+  f->busy = 0;
+}
+
+// set fade length in samples
+void fade_tap_set_len(fadeTap* f, u32 samps) {
+  if(samps == 0) { samps = 1; }
+  f->inc = (fract32)(FR32_MAX / samps);
+  if(f->inc == 0) { f->inc = 1; }
+}
+
+// start fading towards a tap; ignored if busy
+u8 fade_tap_start(fadeTap* f, u8 target) {
+  if(f->busy) {
+    return 0;
+  }
+  f->target = target;
+  f->pos = 0;
+  f->busy = 1;
+  return 1;
+}
+
+// advance a fade in progress and get gains of both taps
+void fade_tap_next(fadeTap* f, fract32* gain) {
+  gain[f->target] = fade_tap_gain(f->pos);
+  gain[f->target ^ 1] = fade_tap_gain(sub_fr1x32(FR32_MAX, f->pos));
+  if(f->pos > sub_fr1x32(FR32_MAX, f->inc)) {
+    f->pos = FR32_MAX;
+    f->busy = 0;
+  } else {
+    f->pos += f->inc;
+  }
+}
@@ -0,0 +1,37 @@
+/* fade_tap.h
+   dsp
+   aleph
+
+   equal-power crossfade between two taps.
+   
+   a fade runs for a set count of samples and then goes idle;
+   while idle, only the target tap needs to be processed.
+ */
+
+#ifndef _ALEPH_DSP_FADE_TAP_H_
+#define _ALEPH_DSP_FADE_TAP_H_
+
+#include "types.h"
+
+typedef struct _fadeTap {
+  // position from source to target [0-1]
+  fract32 pos;
+  // per-sample position increment
+  fract32 inc;
+  // index of tap faded towards (0 or 1)
+  u8 target;
+  // flag if a fade is in progress
+  u8 busy;
+} fadeTap;
+
+// initialize (idle, at tap 0)
+extern void fade_tap_init(fadeTap* f);
+// set fade length in samples
+extern void fade_tap_set_len(fadeTap* f, u32 samps);
+// start fading towards a tap; ignored if busy.
+// returns 1 if the fade started.
+extern u8 fade_tap_start(fadeTap* f, u8 target);
+// advance a fade in progress and get gains of both taps
+extern void fade_tap_next(fadeTap* f, fract32* gain);
+
+#endif
@@ -26,14 +26,13 @@
 //=====================================================
 //===== static functions
 
-static fract32 filter_svf_calc_frame( filter_svf* f, fract32 in) { 
-  fract32 out;
+// one step of the filter state
+static inline void filter_svf_step( filter_svf* f, fract32 in) { 
   f->low = add_fr1x32(f->low, 
 		      mult_fr1x32x32(f->freq, f->band));
 
   f->high = sub_fr1x32(
 		       sub_fr1x32(
-				  // mult_fr1x32x32(in, f->scale),
 				  in, 
 				  shl_fr1x32(mult_fr1x32x32(f->rq, f->band), f->rqShift)
 				  ),
@@ -42,26 +41,126 @@ static fract32 filter_svf_calc_frame( filter_svf* f, fract32 in) {
 
   f->band = add_fr1x32(f->band, 
 		       mult_fr1x32x32(f->freq, f->high) );
+}
+
+//---- kernels.
+// each runs two steps (2x oversampling) and averages the outputs it uses.
+// the mix is linear, so mixing the averages is the same as averaging the mixes,
+// and takes half the multiplies.
+
+// no outputs. the state still follows the input,
+// so raising a mix from zero picks up where the filter would be.
+static fract32 filter_svf_kernel_none( filter_svf* f, fract32 in) {
+  filter_svf_step(f, in);
+  filter_svf_step(f, in);
+  return 0;
+}
+
+// lowpass only
+static fract32 filter_svf_kernel_low( filter_svf* f, fract32 in) {
+  fract32 low;
+  filter_svf_step(f, in);
+  low = shr_fr1x32(f->low, 1);
+  filter_svf_step(f, in);
+  low = add_fr1x32(low, shr_fr1x32(f->low, 1));
+  // lowpass has always been mixed in twice
+  return shl_fr1x32(mult_fr1x32x32(low, f->lowMix), 1);
+}
 
+// highpass only
+static fract32 filter_svf_kernel_high( filter_svf* f, fract32 in) {
+  fract32 high;
+  filter_svf_step(f, in);
+  high = shr_fr1x32(f->high, 1);
+  filter_svf_step(f, in);
+  high = add_fr1x32(high, shr_fr1x32(f->high, 1));
+  return mult_fr1x32x32(high, f->highMix);
+}
+
+// bandpass only
+static fract32 filter_svf_kernel_band( filter_svf* f, fract32 in) {
+  fract32 band;
+  filter_svf_step(f, in);
+  band = shr_fr1x32(f->band, 1);
+  filter_svf_step(f, in);
+  band = add_fr1x32(band, shr_fr1x32(f->band, 1));
+  return mult_fr1x32x32(band, f->bandMix);
+}
+
+// notch only
+static fract32 filter_svf_kernel_notch( filter_svf* f, fract32 in) {
+  fract32 notch;
+  filter_svf_step(f, in);
+  notch = shr_fr1x32(add_fr1x32(f->low, f->high), 1);
+  filter_svf_step(f, in);
   f->notch = add_fr1x32(f->low, f->high);
+  notch = add_fr1x32(notch, shr_fr1x32(f->notch, 1));
+  return mult_fr1x32x32(notch, f->notchMix);
+}
 
-  out = mult_fr1x32x32(f->low, f->lowMix);
-  out = add_fr1x32(out, mult_fr1x32x32(f->low, f->lowMix));
-  out = add_fr1x32(out, mult_fr1x32x32(f->high, f->highMix));
-  out = add_fr1x32(out, mult_fr1x32x32(f->band, f->bandMix));
-  out = add_fr1x32(out, mult_fr1x32x32(f->notch, f->notchMix));
+// any combination
+static fract32 filter_svf_kernel_mix( filter_svf* f, fract32 in) {
+  fract32 low, high, band, notch, out;
+  filter_svf_step(f, in);
+  low = shr_fr1x32(f->low, 1);
+  high = shr_fr1x32(f->high, 1);
+  band = shr_fr1x32(f->band, 1);
+  filter_svf_step(f, in);
+  low = add_fr1x32(low, shr_fr1x32(f->low, 1));
+  high = add_fr1x32(high, shr_fr1x32(f->high, 1));
+  band = add_fr1x32(band, shr_fr1x32(f->band, 1));
+  f->notch = add_fr1x32(f->low, f->high);
+  notch = add_fr1x32(low, high);
 
+  // lowpass has always been mixed in twice
+  out = shl_fr1x32(mult_fr1x32x32(low, f->lowMix), 1);
+  out = add_fr1x32(out, mult_fr1x32x32(high, f->highMix));
+  out = add_fr1x32(out, mult_fr1x32x32(band, f->bandMix));
+  out = add_fr1x32(out, mult_fr1x32x32(notch, f->notchMix));
   return out;
 }
 
+// select the kernel for the outputs with nonzero mix
+static void filter_svf_select( filter_svf* f) {
+  f->outs = (f->lowMix != 0 ? SVF_OUT_LOW : 0)
+    | (f->highMix != 0 ? SVF_OUT_HIGH : 0)
+    | (f->bandMix != 0 ? SVF_OUT_BAND : 0)
+    | (f->notchMix != 0 ? SVF_OUT_NOTCH : 0);
+
+  switch(f->outs) {
+  case 0 :
+    f->kernel = &filter_svf_kernel_none;
+    break;
+  case SVF_OUT_LOW :
+    f->kernel = &filter_svf_kernel_low;
+    break;
+  case SVF_OUT_HIGH :
+    f->kernel = &filter_svf_kernel_high;
+    break;
+  case SVF_OUT_BAND :
+    f->kernel = &filter_svf_kernel_band;
+    break;
+  case SVF_OUT_NOTCH :
+    f->kernel = &filter_svf_kernel_notch;
+    break;
+  default :
+    f->kernel = &filter_svf_kernel_mix;
+    break;
+  }
+}
+
 
 //=============================================
 //===== extern functions
 // init
 extern void filter_svf_init ( filter_svf* f ) {
   f->freq = 0;
+  f->rq = 0;
+  f->rqShift = 0;
+  f->rqIn = 0;
   f->low = f->high = f->band = f->notch = 0;
   f->lowMix = f->highMix = f->bandMix = f->notchMix = f->peakMix = 0;
+  filter_svf_select(f);
 }
 
 // set cutoff coefficient directly
@@ -81,6 +180,10 @@ extern void filter_svf_set_rq( filter_svf* f, fract32 rq) {
   // fract32 positive range is [0, .9999...]
   // so: move the radix to interpret rq as 2.30 
   // and store lshift value
+  if(rq == f->rqIn) {
+    return;
+  }
+  f->rqIn = rq;
   if(rq > 0x3fffffff) {
     f->rqShift = 1;
     // clear the highest non-sign bit before shifting? (probably doesn't matter)
@@ -94,18 +197,22 @@ extern void filter_svf_set_rq( filter_svf* f, fract32 rq) {
 // set output mixes
 extern void filter_svf_set_low   ( filter_svf* f, fract32 mix) {
   f->lowMix = mix;
+  filter_svf_select(f);
 }
 
 extern void filter_svf_set_high  ( filter_svf* f, fract32 mix) {
   f->highMix = mix;
+  filter_svf_select(f);
 }
 
 extern void filter_svf_set_band  ( filter_svf* f, fract32 mix) {
   f->bandMix = mix;
+  filter_svf_select(f);
 }
 
 extern void filter_svf_set_notch ( filter_svf* f, fract32 mix) {
   f->notchMix = mix;
+  filter_svf_select(f);
 }
 
 extern void filter_svf_set_peak ( filter_svf* f, fract32 mix) {
@@ -114,8 +221,14 @@ extern void filter_svf_set_peak ( filter_svf* f, fract32 mix) {
 
 // get next value (with input)
 extern fract32 filter_svf_next( filter_svf* f, fract32 in) {
-  // process 2x and average
-  fract32 out = shr_fr1x32(filter_svf_calc_frame(f, in), 1);
-  out = add_fr1x32(out, shr_fr1x32(filter_svf_calc_frame(f, in), 1));
-  return out;
+  return (*(f->kernel))(f, in);
+}
+
+// process a block of frames
+extern void filter_svf_next_block( filter_svf* f, const fract32* in, fract32* out, u32 n) {
+  const filter_svf_kernel_t kernel = f->kernel;
+  while(n > 0) {
+    *out++ = (*kernel)(f, *in++);
+    --n;
+  }
 }
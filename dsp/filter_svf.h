@@ -16,6 +16,16 @@
 //==============================================
 //===== types
 
+// output-mix flags, selecting a kernel
+#define SVF_OUT_LOW   1
+#define SVF_OUT_HIGH  2
+#define SVF_OUT_BAND  4
+#define SVF_OUT_NOTCH 8
+
+struct _filter_svf;
+// kernel: two oversampled steps and output mix for one frame
+typedef fract32 (*filter_svf_kernel_t)(struct _filter_svf* f, fract32 in);
+
 typedef struct _filter_svf {
   fract32 freq;  // normalized frequency
   fract32 rq;    // reciprocal of q (resonance / bandwidth)
@@ -35,6 +45,13 @@ typedef struct _filter_svf {
   // kinda retarded, but use rshift for rq values >=1
   u8 rqShift;
 
+  // last rq set, to skip recalculation
+  fract32 rqIn;
+  // flags of outputs with nonzero mix
+  u8 outs;
+  // kernel for the active outputs
+  filter_svf_kernel_t kernel;
+
 } filter_svf;
 
 
@@ -57,5 +74,7 @@ extern void filter_svf_set_notch ( filter_svf* f, fract32 mix );
 extern void filter_svf_set_peak ( filter_svf* f, fract32 mix );
 // get next value (with input)
 extern fract32 filter_svf_next( filter_svf* f, fract32 in );
+// process a block of frames
+extern void filter_svf_next_block( filter_svf* f, const fract32* in, fract32* out, u32 n );
 
 #endif // h guard
@@ -0,0 +1,111 @@
+/* mix_matrix.c
+   dsp
+   aleph
+
+   sparse gain matrix between fract32 signals.
+ */
+
+#include <stddef.h>
+
+#include "fract_math.h"
+#include "mix_matrix.h"
+
+//----------------
+//--- static funcs
+
+// rebuild the idle term list of an output from its gains, then switch to it
+static void mix_matrix_build(mixMatrix* mix, u8 out) {
+  mixSum* sum = &(mix->sum[out]);
+  const fract32* gain = mix->gain[out];
+  u8 b = sum->cur ^ 1;
+  u8 i, n = 0;
+
+  for(i=0; i<mix->numIn; i++) {
+    // an unregistered input contributes nothing
+    if( (gain[i] != 0) && (mix->src[i] != NULL) ) {
+      sum->term[b][n].src = mix->src[i];
+      sum->term[b][n].gain = gain[i];
+      n++;
+    }
+  }
+  sum->num[b] = n;
+  sum->cur = b;
+}
+
+//----------------
+//--- extern funcs
+
+// initialize with all gains at zero
+void mix_matrix_init(mixMatrix* mix, u8 numIn, u8 numOut) {
+  u8 i, j;
+  mix->numIn = numIn > MIX_MATRIX_MAX_IN ? MIX_MATRIX_MAX_IN : numIn;
+  mix->numOut = numOut > MIX_MATRIX_MAX_OUT ? MIX_MATRIX_MAX_OUT : numOut;
+  for(i=0; i<MIX_MATRIX_MAX_IN; i++) {
+    mix->src[i] = NULL;
+  }
+  for(j=0; j<MIX_MATRIX_MAX_OUT; j++) {
+    mix->dst[j] = NULL;
+    for(i=0; i<MIX_MATRIX_MAX_IN; i++) {
+      mix->gain[j][i] = 0;
+    }
+    mix->sum[j].num[0] = mix->sum[j].num[1] = 0;
+    mix->sum[j].cur = 0;
+  }
+}
+
+// register the signal read by an input
+void mix_matrix_set_src(mixMatrix* mix, u8 in, const fract32* src) {
+  u8 j;
+  if(in >= mix->numIn) {
+    return;
+  }
+  mix->src[in] = src;
+  for(j=0; j<mix->numOut; j++) {
+    if(mix->gain[j][in] != 0) {
+      mix_matrix_build(mix, j);
+    }
+  }
+}
+
+// register the signal written by an output
+void mix_matrix_set_dst(mixMatrix* mix, u8 out, fract32* dst) {
+  if(out >= mix->numOut) {
+    return;
+  }
+  mix->dst[out] = dst;
+}
+
+// set the gain from an input to an output
+void mix_matrix_set(mixMatrix* mix, u8 in, u8 out, fract32 gain) {
+  if( (in >= mix->numIn) || (out >= mix->numOut) ) {
+    return;
+  }
+  if(mix->gain[out][in] == gain) {
+    return;
+  }
+  mix->gain[out][in] = gain;
+  mix_matrix_build(mix, out);
+}
+
+// compute every output for one frame
+void mix_matrix_next(mixMatrix* mix) {
+  const mixSum* sum;
+  const mixTerm* t;
+  fract32 acc;
+  u8 j, k, b;
+
+  for(j=0; j<mix->numOut; j++) {
+    if(mix->dst[j] == NULL) {
+      continue;
+    }
+    sum = &(mix->sum[j]);
+    b = sum->cur;
+    t = sum->term[b];
+    acc = 0;
+    for(k=0; k<sum->num[b]; k++) {
+      acc = add_fr1x32(acc, mult_fr1x32x32(*(t->src), t->gain));
+      t++;
+    }
+    *(mix->dst[j]) = acc;
+  }
+}
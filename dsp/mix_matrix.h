@@ -0,0 +1,70 @@
+/* mix_matrix.h
+   dsp
+   aleph
+
+   a gain matrix from a set of input signals to a set of output signals,
+   which keeps, for each output, a list of only the inputs with nonzero gain.
+   zero gains cost nothing per frame.
+
+   inputs and outputs are registered as pointers to fract32 values,
+   so signals are read and written in place.
+
+   mix_matrix_set() is called from the param handler,
+   mix_matrix_next() from the frame.
+   the audio interrupt preempts the param interrupt,
+   so each output has two term lists: the param side rebuilds the idle one
+   and then switches the frame over to it with a single byte write.
+ */
+
+#ifndef _ALEPH_DSP_MIX_MATRIX_H_
+#define _ALEPH_DSP_MIX_MATRIX_H_
+
+#include "types.h"
+
+// maximum count of inputs
+#ifndef MIX_MATRIX_MAX_IN
+#define MIX_MATRIX_MAX_IN 12
+#endif
+// maximum count of outputs
+#ifndef MIX_MATRIX_MAX_OUT
+#define MIX_MATRIX_MAX_OUT 4
+#endif
+
+// one nonzero term of an output sum
+typedef struct _mixTerm {
+  const fract32* src;
+  fract32 gain;
+} mixTerm;
+
+// nonzero terms of one output, double-buffered
+typedef struct _mixSum {
+  mixTerm term[2][MIX_MATRIX_MAX_IN];
+  u8 num[2];
+  // index of the list used by the frame
+  volatile u8 cur;
+} mixSum;
+
+typedef struct _mixMatrix {
+  u8 numIn;
+  u8 numOut;
+  // registered signals
+  const fract32* src[MIX_MATRIX_MAX_IN];
+  fract32* dst[MIX_MATRIX_MAX_OUT];
+  // all gains, [out][in]
+  fract32 gain[MIX_MATRIX_MAX_OUT][MIX_MATRIX_MAX_IN];
+  // nonzero terms for each output
+  mixSum sum[MIX_MATRIX_MAX_OUT];
+} mixMatrix;
+
+// initialize with all gains at zero
+extern void mix_matrix_init(mixMatrix* mix, u8 numIn, u8 numOut);
+// register the signal read by an input
+extern void mix_matrix_set_src(mixMatrix* mix, u8 in, const fract32* src);
+// register the signal written by an output
+extern void mix_matrix_set_dst(mixMatrix* mix, u8 out, fract32* dst);
+// set the gain from an input to an output
+extern void mix_matrix_set(mixMatrix* mix, u8 in, u8 out, fract32 gain);
+// compute every output for one frame
+extern void mix_matrix_next(mixMatrix* mix);
+
+#endif
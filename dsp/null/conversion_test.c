@@ -0,0 +1,161 @@
+/* conversion_test.c
+   aleph - (null)
+
+   host test of the time conversions in dsp/conversion.c,
+   checked against double precision.
+
+   build for a given samplerate, e.g. 'make conversion_test_48000'.
+   a rate over 131072 reaches the saturation of sec_to_frames.
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "conversion.h"
+#include "module.h"
+
+// fix16 steps and frame steps between checked values
+#define SEC_STEP 0x1fff
+#define FRAMES_STEP 0x3fff
+
+static u32 fails = 0;
+static u32 checks = 0;
+
+static void check(int ok, const char* what, s64 in, s64 got, s64 want) {
+  checks++;
+  if(!ok) {
+    if(fails < 32) {
+      printf("\r\n FAIL %s(0x%llx): got 0x%llx, want 0x%llx",
+	     what, (long long)in, (long long)got, (long long)want);
+    }
+    fails++;
+  }
+}
+
+// frames for seconds in 16.16, saturated, with given rounding
+static u32 ref_sec_to_frames(fix16 sec, eConvRound round) {
+  // sec * SAMPLERATE < 2^47, exact in double
+  const double x = (double)sec / 65536.0 * (double)SAMPLERATE;
+  double y;
+  if(sec <= 0) { return 0; }
+  if(x >= 4294967295.0) { return 0xffffffff; }
+  switch(round) {
+  case eConvRoundNearest : y = floor(x + 0.5); break;
+  case eConvRoundUp : y = ceil(x); break;
+  default : y = floor(x); break;
+  }
+  return y >= 4294967295.0 ? 0xffffffff : (u32)y;
+}
+
+static void test_sec_to_frames(fix16 sec) {
+  static const char* names[3] = {
+    "sec_to_frames(trunc)", "sec_to_frames(nearest)", "sec_to_frames(up)"
+  };
+  eConvRound r;
+  u32 got, want;
+  for(r = eConvRoundTrunc; r <= eConvRoundUp; r++) {
+    got = sec_to_frames(sec, r);
+    want = ref_sec_to_frames(sec, r);
+    check(got == want, names[r], sec, got, want);
+  }
+  got = sec_to_frames_trunc(sec);
+  want = ref_sec_to_frames(sec, eConvRoundTrunc);
+  check(got == want, "sec_to_frames_trunc", sec, got, want);
+}
+
+static void test_sec_to_frames_fract(fix16 sec) {
+  const double x = (double)sec / 65536.0 * (double)SAMPLERATE;
+  fix16 t = sec;
+  fix32 got;
+  s32 wantI;
+  fract32 wantFr;
+  if(sec <= 0) {
+    wantI = 0;
+    wantFr = 0;
+  } else if(floor(x) > 2147483647.0) {
+    wantI = 0x7fffffff;
+    wantFr = 0;
+  } else {
+    wantI = (s32)floor(x);
+    // fraction is a multiple of 2^-16, exact in 1.31
+    wantFr = (fract32)((x - floor(x)) * 2147483648.0);
+  }
+  sec_to_frames_fract(&t, &got);
+  check(got.i == wantI, "sec_to_frames_fract(i)", sec, got.i, wantI);
+  check(got.fr == wantFr, "sec_to_frames_fract(fr)", sec, got.fr, wantFr);
+}
+
+static void test_frames_to_sec(u32 frames) {
+  static const char* names[3] = {
+    "frames_to_sec(trunc)", "frames_to_sec(nearest)", "frames_to_sec(up)"
+  };
+  // a non-integer quotient is at least 1/SAMPLERATE from an integer,
+  // far above the rounding error of the division.
+  const double x = (double)frames * 65536.0 / (double)SAMPLERATE;
+  eConvRound r;
+  double y;
+  fix16 got, want;
+  for(r = eConvRoundTrunc; r <= eConvRoundUp; r++) {
+    switch(r) {
+    case eConvRoundNearest : y = floor(x + 0.5); break;
+    case eConvRoundUp : y = ceil(x); break;
+    default : y = floor(x); break;
+    }
+    want = y > 2147483647.0 ? 0x7fffffff : (fix16)y;
+    got = frames_to_sec(frames, r);
+    check(got == want, names[r], frames, got, want);
+  }
+}
+
+int main(void) {
+  // last fix16 under the saturation point of sec_to_frames
+  const s64 satSec = (s64)(4294967295.0 / (double)SAMPLERATE * 65536.0);
+  // last fix16 under the saturation point of sec_to_frames_fract
+  const s64 satFract = (s64)(2147483648.0 / (double)SAMPLERATE * 65536.0);
+  // last frame count under the saturation point of frames_to_sec
+  const s64 satFrames = (s64)(2147483647.0 / 65536.0 * (double)SAMPLERATE);
+  s64 i;
+  s32 d;
+
+  printf("\r\n conversion test, samplerate %d", SAMPLERATE);
+
+  //--- seconds to frames
+  for(i = 0; i <= 0x7fffffff; i += SEC_STEP) {
+    test_sec_to_frames((fix16)i);
+    test_sec_to_frames_fract((fix16)i);
+  }
+  // edges: sign, small values, whole seconds, top of range
+  for(d = -2; d <= 2; d++) {
+    test_sec_to_frames((fix16)(0x10000 + d));
+    test_sec_to_frames_fract((fix16)(0x10000 + d));
+    test_sec_to_frames((fix16)(d + 2));
+    test_sec_to_frames_fract((fix16)(d + 2));
+    test_sec_to_frames((fix16)(0x7fffffff - d - 2));
+    test_sec_to_frames_fract((fix16)(0x7fffffff - d - 2));
+    test_sec_to_frames((fix16)(0x80000000 + d + 2));
+    test_sec_to_frames_fract((fix16)(0x80000000 + d + 2));
+  }
+  // around saturation
+  for(i = satSec - 0x100; i <= satSec + 0x100 && i <= 0x7fffffff; i++) {
+    test_sec_to_frames((fix16)i);
+  }
+  for(i = satFract - 0x100; i <= satFract + 0x100 && i <= 0x7fffffff; i++) {
+    test_sec_to_frames_fract((fix16)i);
+  }
+
+  //--- frames to seconds
+  for(i = 0; i <= 0xffffffff; i += FRAMES_STEP) {
+    test_frames_to_sec((u32)i);
+  }
+  for(i = satFrames - 0x100; i <= satFrames + 0x100; i++) {
+    test_frames_to_sec((u32)i);
+  }
+  for(d = 0; d < 0x100; d++) {
+    test_frames_to_sec((u32)d);
+    test_frames_to_sec(0xffffffff - (u32)d);
+    test_frames_to_sec((u32)SAMPLERATE + (u32)d - 0x80);
+  }
+
+  printf("\r\n %u checks, %u failures \r\n", checks, fails);
+  return fails > 0;
+}
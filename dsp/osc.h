@@ -3,6 +3,13 @@
    aleph
 
    a simple wavetable oscillator with phase and shape modulation.
+
+   phase is a u32 accumulator, where the full range is one cycle.
+   it wraps by overflow, and table indices are its top bits.
+
+   band-limiting uses mip-mapped tables.
+   each octave of phase increment above OSC_MIP_INC_BASE
+   crossfades from one level to the next, which has half the harmonics.
  */
 
 #ifndef _ALEPH_DSP_OSC_H_
@@ -20,9 +27,8 @@
 // how many wavetables
 #define WAVE_TAB_NUM 5
 // size of each table
-#define WAVE_TAB_SIZE 	1024
-#define WAVE_TAB_SIZE_1 (WAVE_TAB_SIZE - 1)
-#define WAVE_TAB_MAX16 	(WAVE_TAB_SIZE * FIX16_ONE - 1)
+#define WAVE_TAB_SIZE_LOG2 10
+#define WAVE_TAB_SIZE 	(1 << WAVE_TAB_SIZE_LOG2)
 // rshift from shape variable to get table index
 #define WAVE_TAB_RSHIFT 29
 // mask to get interpolation constant
@@ -30,8 +36,21 @@
 // lshift after mask to get multiplier 
 #define WAVE_TAB_LSHIFT 2
 
+//---- expected parameters for band-limited levels
+// how many levels, not counting the full tables
+#define WAVE_MIP_NUM 4
+// size of each level's tables
+#define WAVE_MIP_SIZE_LOG2 8
+#define WAVE_MIP_SIZE (1 << WAVE_MIP_SIZE_LOG2)
+// phase increment at the bottom of the first crossfade octave.
+// level l is alias-free up to (OSC_MIP_INC_BASE << (l+1)).
+#define OSC_MIP_INC_LOG2 26
+#define OSC_MIP_INC_BASE (1 << OSC_MIP_INC_LOG2)
+
 // wavetable type: pointer to 2d array
 typedef const fract32 (*wavtab_t) [WAVE_TAB_NUM][WAVE_TAB_SIZE];
+// band-limited levels: pointer to 3d array
+typedef const fract32 (*wavtab_mip_t) [WAVE_MIP_NUM][WAVE_TAB_NUM][WAVE_MIP_SIZE];
 
 // class structure
 typedef struct _osc {
@@ -39,6 +58,8 @@ typedef struct _osc {
   fract32 val;
   // wavetable data (pointer to table of tables)
   wavtab_t tab;
+  // band-limited levels of the same tables
+  wavtab_mip_t mip;
   // normalized waveshape
   fract32 shape;
   // smoothed and normalized waveshape
@@ -49,13 +70,13 @@ typedef struct _osc {
   fix16 hz;
   // tuning ratio
   fix16 ratio;
-  // base phase as fractional index
-  fix16 idx;
+  // base phase
+  u32 idx;
   // modulated phase
-  fix16 idxMod;
-  // fixed-point index increment
-  fix16 inc;
-  // bandlimiting coefficient [0-1]
+  u32 idxMod;
+  // phase increment
+  u32 inc;
+  // bandlimiting flag (0 uses only the full tables)
   fract32 bandLim;
   // phase modulation amount [0-1)
   fract32 pmAmt;
@@ -78,8 +99,8 @@ typedef struct _osc {
   //  fix16 invPhase;
 } osc;
 
-// initialize given table data and samplerate
-extern void osc_init(osc* osc, wavtab_t tab, u32 sr);
+// initialize given table data, band-limited levels and samplerate
+extern void osc_init(osc* osc, wavtab_t tab, wavtab_mip_t mip, u32 sr);
 
 // set waveshape (table)
 extern void osc_set_shape(osc* osc, fract32 shape);
@@ -98,7 +119,7 @@ extern void osc_pm_in(osc* osc, fract32 pm);
 // shape modulation input
 extern void osc_wm_in(osc* osc, fract32 wm);
 
-// set bandlimiting coefficient
+// set bandlimiting (0 is off)
 extern void osc_set_bl(osc* osc, fract32 bl);
 
 // compute next value
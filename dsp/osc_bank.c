@@ -0,0 +1,120 @@
+// bfin
+#include <fract2float_conv.h>
+#include "fract_math.h"
+
+// aleph/dsp
+#include "osc_bank.h"
+#include "osc_lookup.h"
+
+//----------------
+//--- static vars
+
+/// assume all banks have the same samplerate
+/// phase increment at 1hz, as fix16 multiplier of hz:
+static fix16 ips;
+
+//------------------
+//---- static functions
+
+// calculate phase increment target
+static inline void osc_bank_calc_inc(oscBank* bank, u8 i) {
+  bank->incTarget[i] = fix16_mul(bank->ratio[i], fix16_mul(bank->hz[i], ips));
+}
+
+// one-pole smoother step, as filter_1p_lo_next
+static inline fract32 osc_bank_slew(fract32 y, fract32 x, fract32 c) {
+  return add_fr1x32(x, mult_fr1x32x32(c, sub_fr1x32(y, x)));
+}
+
+//----------------
+//--- extern funcs
+
+// initialize given table data, band-limited levels and samplerate
+void osc_bank_init(oscBank* bank, wavtab_t tab, wavtab_mip_t mip, u32 sr) {
+  u8 i;
+  bank->tab = tab;
+  bank->mip = mip;
+
+  // 2^32 / sr
+  ips = (fix16)( 4294967296.f / (f32)sr );
+
+  for(i=0; i<OSC_BANK_NUM; i++) {
+    bank->idx[i] = 0;
+    bank->inc[i] = bank->incTarget[i] = FIX16_ONE;
+    bank->shape[i] = bank->shapeTarget[i] = 0;
+    bank->pmAmt[i] = bank->pmTarget[i] = 0;
+    bank->incSlew[i] = bank->shapeSlew[i] = bank->pmSlew[i] = 0;
+    bank->pmIn[i] = 0;
+    bank->wmAmt[i] = 0;
+    bank->wmIn[i] = 0;
+    bank->bandLim[i] = FR32_MAX >> 2;
+    bank->hz[i] = 0;
+    bank->ratio[i] = FIX16_ONE;
+  }
+}
+
+// set waveshape (table)
+void osc_bank_set_shape(oscBank* bank, u8 i, fract32 shape) {
+  bank->shapeTarget[i] = shape;
+}
+
+// set base frequency in hz
+void osc_bank_set_hz(oscBank* bank, u8 i, fix16 hz) {
+  bank->hz[i] = hz;
+  osc_bank_calc_inc(bank, i);
+}
+
+// set fine-tuning ratio
+void osc_bank_set_tune(oscBank* bank, u8 i, fix16 ratio) {
+  bank->ratio[i] = ratio;
+  osc_bank_calc_inc(bank, i);
+}
+
+// phase modulation amount
+void osc_bank_set_pm(oscBank* bank, u8 i, fract32 amt) {
+  bank->pmTarget[i] = amt;
+}
+
+// shape modulation amount
+void osc_bank_set_wm(oscBank* bank, u8 i, fract32 amt) {
+  bank->wmAmt[i] = amt;
+}
+
+// set bandlimiting
+void osc_bank_set_bl(oscBank* bank, u8 i, fract32 bl) {
+  bank->bandLim[i] = bl;
+}
+
+// set smoothing coefficients
+void osc_bank_set_inc_slew(oscBank* bank, u8 i, fract32 slew) {
+  bank->incSlew[i] = slew;
+}
+
+void osc_bank_set_shape_slew(oscBank* bank, u8 i, fract32 slew) {
+  bank->shapeSlew[i] = slew;
+}
+
+void osc_bank_set_pm_slew(oscBank* bank, u8 i, fract32 slew) {
+  bank->pmSlew[i] = slew;
+}
+
+// compute next value of every voice
+void osc_bank_next(oscBank* bank, fract32* out) {
+  u8 i;
+  u32 idxMod;
+
+  // smoothers run unconditionally; no per-voice sync branches
+  for(i=0; i<OSC_BANK_NUM; i++) {
+    bank->inc[i] = osc_bank_slew(bank->inc[i], bank->incTarget[i], bank->incSlew[i]);
+    bank->shape[i] = osc_bank_slew(bank->shape[i], bank->shapeTarget[i], bank->shapeSlew[i]);
+    bank->pmAmt[i] = osc_bank_slew(bank->pmAmt[i], bank->pmTarget[i], bank->pmSlew[i]);
+  }
+
+  for(i=0; i<OSC_BANK_NUM; i++) {
+    // phase modulation is a fraction of the cycle, so it wraps with the phase
+    idxMod = bank->idx[i] + ((u32)mult_fr1x32x32(bank->pmIn[i], bank->pmAmt[i]) << 1);
+    bank->idx[i] += (u32)(bank->inc[i]);
+    out[i] = osc_lookup_mip(bank->tab, bank->mip, bank->shape[i],
+			    (u32)(bank->inc[i]), idxMod, bank->bandLim[i]);
+  }
+}
@@ -0,0 +1,87 @@
+/* osc_bank.h
+   dsp
+   aleph
+
+   a bank of wavetable oscillators, as in osc.h,
+   stored as structure-of-arrays so that one loop runs every voice.
+   each voice has the same parameters as a single osc,
+   with one-pole smoothing of increment, shape and phase modulation.
+ */
+
+#ifndef _ALEPH_DSP_OSC_BANK_H_
+#define _ALEPH_DSP_OSC_BANK_H_
+
+#include "fix.h"
+#include "osc.h"
+#include "types.h"
+
+// count of voices
+#ifndef OSC_BANK_NUM
+#define OSC_BANK_NUM 8
+#endif
+
+// class structure
+typedef struct _oscBank {
+  // wavetable data, shared by all voices
+  wavtab_t tab;
+  // band-limited levels of the same tables
+  wavtab_mip_t mip;
+
+  //-- per-voice state, touched every frame
+  // phase
+  u32 idx[OSC_BANK_NUM];
+  // smoothed phase increment
+  fract32 inc[OSC_BANK_NUM];
+  // smoothed waveshape
+  fract32 shape[OSC_BANK_NUM];
+  // smoothed phase modulation amount
+  fract32 pmAmt[OSC_BANK_NUM];
+  // phase modulation input
+  fract32 pmIn[OSC_BANK_NUM];
+  // bandlimiting flag (0 uses only the full tables)
+  fract32 bandLim[OSC_BANK_NUM];
+
+  //-- smoothing targets and coefficients
+  fract32 incTarget[OSC_BANK_NUM];
+  fract32 shapeTarget[OSC_BANK_NUM];
+  fract32 pmTarget[OSC_BANK_NUM];
+  fract32 incSlew[OSC_BANK_NUM];
+  fract32 shapeSlew[OSC_BANK_NUM];
+  fract32 pmSlew[OSC_BANK_NUM];
+
+  //-- per-voice parameters, touched on change
+  // frequency in hz
+  fix16 hz[OSC_BANK_NUM];
+  // tuning ratio
+  fix16 ratio[OSC_BANK_NUM];
+  // shape modulation amount and input (not applied yet, as in osc)
+  fract32 wmAmt[OSC_BANK_NUM];
+  fract32 wmIn[OSC_BANK_NUM];
+} oscBank;
+
+// initialize given table data, band-limited levels and samplerate
+extern void osc_bank_init(oscBank* bank, wavtab_t tab, wavtab_mip_t mip, u32 sr);
+
+// set waveshape (table)
+extern void osc_bank_set_shape(oscBank* bank, u8 i, fract32 shape);
+// set base frequency in hz
+extern void osc_bank_set_hz(oscBank* bank, u8 i, fix16 hz);
+// set fine-tuning ratio
+extern void osc_bank_set_tune(oscBank* bank, u8 i, fix16 ratio);
+// phase modulation amount
+extern void osc_bank_set_pm(oscBank* bank, u8 i, fract32 amt);
+// shape modulation amount
+extern void osc_bank_set_wm(oscBank* bank, u8 i, fract32 amt);
+// set bandlimiting (0 is off)
+extern void osc_bank_set_bl(oscBank* bank, u8 i, fract32 bl);
+
+// set smoothing coefficients
+extern void osc_bank_set_inc_slew(oscBank* bank, u8 i, fract32 slew);
+extern void osc_bank_set_shape_slew(oscBank* bank, u8 i, fract32 slew);
+extern void osc_bank_set_pm_slew(oscBank* bank, u8 i, fract32 slew);
+
+// compute next value of every voice.
+// phase modulation uses the pmIn values set before the call.
+extern void osc_bank_next(oscBank* bank, fract32* out);
+
+#endif
@@ -0,0 +1,78 @@
+/* osc_lookup.h
+   dsp
+   aleph
+
+   band-limited wavetable lookup, shared by the single oscillator and the bank.
+   these are inline, so each caller keeps them in its own inner loop.
+ */
+
+#ifndef _ALEPH_DSP_OSC_LOOKUP_H_
+#define _ALEPH_DSP_OSC_LOOKUP_H_
+
+#include "fract_math.h"
+#include "osc.h"
+
+// interpolated lookup in adjacent shapes of one level, crossfaded by shape.
+// both shapes share the index and interpolation constant.
+// adjacent shapes can differ by more than 1, so they are each scaled before summing.
+static inline fract32 osc_lookup_level(const fract32* tabA, const fract32* tabB,
+				       const u32 bits, const u32 phase,
+				       const fract32 mul, const fract32 mulInv) {
+  const u32 ia = phase >> (32 - bits);
+  const u32 ib = (ia + 1) & ((1 << bits) - 1);
+  const fract32 f = (fract32)((phase << bits) >> 1);
+  fract32 a, b;
+
+  a = add_fr1x32(tabA[ia], mult_fr1x32x32(f, sub_fr1x32(tabA[ib], tabA[ia])));
+  b = add_fr1x32(tabB[ia], mult_fr1x32x32(f, sub_fr1x32(tabB[ib], tabB[ia])));
+  return add_fr1x32(mult_fr1x32x32(a, mulInv), mult_fr1x32x32(b, mul));
+}
+
+// lookup given shape, phase increment and phase,
+// selecting band-limited levels from phase increment.
+// within each octave of increment, crossfade from one level to the next.
+static inline fract32 osc_lookup_mip(wavtab_t tab, wavtab_mip_t mip,
+				     const fract32 shape, const u32 inc,
+				     const u32 idx, const fract32 bandLim) {
+  const u32 idxA = shape >> WAVE_TAB_RSHIFT;
+  const u32 idxB = idxA + 1;
+  const fract32 mul = (shape & WAVE_TAB_MASK) << WAVE_TAB_LSHIFT;
+  const fract32 mulInv = sub_fr1x32(FR32_MAX, mul);
+  s32 lvl, sh;
+  fract32 w, lo, hi;
+
+  if(bandLim == 0 || inc < OSC_MIP_INC_BASE) {
+    // full tables only
+    return osc_lookup_level( (*tab)[idxA], (*tab)[idxB],
+			     WAVE_TAB_SIZE_LOG2, idx, mul, mulInv );
+  }
+
+  // octave above the base increment, from the position of the top bit,
+  // and position within the octave from the bits below it
+  sh = norm_fr1x32((fract32)inc);
+  lvl = (30 - sh) - OSC_MIP_INC_LOG2;
+  w = (fract32)((inc << (sh + 1)) & 0x7fffffff);
+
+  if(lvl >= WAVE_MIP_NUM) {
+    // past the last crossfade; use the top level only
+    return osc_lookup_level( (*mip)[WAVE_MIP_NUM - 1][idxA],
+			     (*mip)[WAVE_MIP_NUM - 1][idxB],
+			     WAVE_MIP_SIZE_LOG2, idx, mul, mulInv );
+  }
+
+  if(lvl == 0) {
+    lo = osc_lookup_level( (*tab)[idxA], (*tab)[idxB],
+			   WAVE_TAB_SIZE_LOG2, idx, mul, mulInv );
+  } else {
+    lo = osc_lookup_level( (*mip)[lvl - 1][idxA],
+			   (*mip)[lvl - 1][idxB],
+			   WAVE_MIP_SIZE_LOG2, idx, mul, mulInv );
+  }
+  hi = osc_lookup_level( (*mip)[lvl][idxA],
+			 (*mip)[lvl][idxB],
+			 WAVE_MIP_SIZE_LOG2, idx, mul, mulInv );
+
+  return add_fr1x32(lo, mult_fr1x32x32(w, sub_fr1x32(hi, lo)));
+}
+
+#endif
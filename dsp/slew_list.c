@@ -0,0 +1,94 @@
+/* slew_list.c
+   dsp
+   aleph
+
+   one-pole parameter slews, processed only while unsettled.
+ */
+
+#include "slew_list.h"
+
+//----------------
+//--- static funcs
+
+// take indices queued by the param handler onto the active list
+static inline void slew_list_take(slewList* list) {
+  u8 i;
+  while(list->rd != list->wr) {
+    i = list->queue[list->rd];
+    list->rd = (list->rd + 1) & SLEW_LIST_QUEUE_MASK;
+    // clear before activating, so a target set from here on queues again
+    list->queued[i] = 0;
+    if( !(list->isActive[i]) ) {
+      list->isActive[i] = 1;
+      list->active[list->numActive++] = i;
+    }
+  }
+}
+
+//----------------
+//--- extern funcs
+
+// initialize
+void slew_list_init(slewList* list) {
+  u8 i;
+  list->num = 0;
+  list->numActive = 0;
+  list->wr = list->rd = 0;
+  for(i=0; i<SLEW_LIST_MAX; i++) {
+    list->isActive[i] = 0;
+    list->queued[i] = 0;
+  }
+}
+
+// register a slew with setter and destination; returns its index
+u8 slew_list_add(slewList* list, filter_1p_lo* slew, slew_set_t set, void* dst) {
+  u8 i = list->num;
+  if(i == SLEW_LIST_MAX) {
+    return SLEW_LIST_MAX;
+  }
+  list->slew[i] = slew;
+  list->set[i] = set;
+  list->dst[i] = dst;
+  list->num++;
+  (*set)(dst, slew->y);
+  return i;
+}
+
+// set target value of a slew at index
+void slew_list_in(slewList* list, u8 i, fract32 val) {
+  if(i >= list->num) {
+    return;
+  }
+  filter_1p_lo_in(list->slew[i], val);
+  if( !(list->queued[i]) ) {
+    list->queued[i] = 1;
+    list->queue[list->wr] = i;
+    list->wr = (list->wr + 1) & SLEW_LIST_QUEUE_MASK;
+  }
+}
+
+// advance unsettled slews by one frame and call their setters
+void slew_list_next(slewList* list) {
+  u8 k, i;
+  filter_1p_lo* f;
+
+  if(list->rd != list->wr) {
+    slew_list_take(list);
+  }
+
+  k = 0;
+  while(k < list->numActive) {
+    i = list->active[k];
+    f = list->slew[i];
+    if( !(f->sync) ) {
+      (*(list->set[i]))(list->dst[i], filter_1p_lo_next(f));
+    }
+    if(f->sync) {
+      // settled: swap the last entry into this slot
+      list->isActive[i] = 0;
+      list->active[k] = list->active[--(list->numActive)];
+    } else {
+      k++;
+    }
+  }
+}
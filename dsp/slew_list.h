@@ -0,0 +1,65 @@
+/* slew_list.h
+   dsp
+   aleph
+
+   a list of one-pole parameter slews,
+   of which only the unsettled ones are processed.
+
+   each slew is registered with a setter and its destination;
+   the setter is called only on frames where the slewed value changes.
+
+   slew_list_in() is called from the param handler,
+   slew_list_next() from the frame.
+   the audio interrupt preempts the param interrupt,
+   so the param side only queues an index;
+   the active list itself is only touched from the frame.
+ */
+
+#ifndef _ALEPH_DSP_SLEW_LIST_H_
+#define _ALEPH_DSP_SLEW_LIST_H_
+
+#include "filter_1p.h"
+#include "types.h"
+
+// maximum count of slews in a list (power of 2)
+#ifndef SLEW_LIST_MAX
+#define SLEW_LIST_MAX 32
+#endif
+// queue has room for every index, plus the empty slot
+#define SLEW_LIST_QUEUE_SIZE (SLEW_LIST_MAX << 1)
+#define SLEW_LIST_QUEUE_MASK (SLEW_LIST_QUEUE_SIZE - 1)
+
+// setter for a slewed value
+typedef void (*slew_set_t)(void* dst, fract32 val);
+
+typedef struct _slewList {
+  // registered slews
+  filter_1p_lo* slew[SLEW_LIST_MAX];
+  slew_set_t set[SLEW_LIST_MAX];
+  void* dst[SLEW_LIST_MAX];
+  u8 num;
+
+  // indices of unsettled slews, and flags of membership
+  u8 active[SLEW_LIST_MAX];
+  u8 isActive[SLEW_LIST_MAX];
+  u8 numActive;
+
+  // indices with new targets, written by the param handler.
+  // each index is queued at most once at a time, so the queue can't overflow.
+  u8 queue[SLEW_LIST_QUEUE_SIZE];
+  volatile u8 queued[SLEW_LIST_MAX];
+  volatile u8 wr;
+  volatile u8 rd;
+} slewList;
+
+// initialize
+extern void slew_list_init(slewList* list);
+// register a slew with setter and destination; returns its index.
+// the setter is called once with the current value.
+extern u8 slew_list_add(slewList* list, filter_1p_lo* slew, slew_set_t set, void* dst);
+// set target value of a slew at index
+extern void slew_list_in(slewList* list, u8 i, fract32 val);
+// advance unsettled slews by one frame and call their setters
+extern void slew_list_next(slewList* list);
+
+#endif
@@ -23,13 +23,12 @@ typedef union { f32 fl; fract32 fr; } fu;
 ////////////////////
 // lookup given real index in 16.16
 fract32 table_lookup_idx(fract32* tab, u32 size, fix16 idx) {
+  const u32 mask = size - 1;
   fract32 a, b, f;
   u32 ia, ib;
-  // integer part
-  ia = idx >> 16;
-  while(ia > (size - 1)) { ia -= (size); }
-  ib = ia + 1;
-  while(ib > (size - 1)) { ib -= (size); }
+  // integer part, wrapped
+  ia = ((u32)idx >> 16) & mask;
+  ib = (ia + 1) & mask;
   a = tab[ia];
   b = tab[ib];
   f = (fract32)( (idx << 15) & 0x7fffffff );
@@ -37,6 +36,19 @@ fract32 table_lookup_idx(fract32* tab, u32 size, fix16 idx) {
   return add_fr1x32(a, mult_fr1x32x32(f, sub_fr1x32(b, a)));
 }
 
+// lookup given u32 phase in a table of 2^bits points
+fract32 table_lookup_phase(const fract32* tab, u32 bits, u32 phase) {
+  fract32 a, b, f;
+  u32 ia, ib;
+  // top bits are the index, the rest are the interpolation constant
+  ia = phase >> (32 - bits);
+  ib = (ia + 1) & ((1 << bits) - 1);
+  a = tab[ia];
+  b = tab[ib];
+  f = (fract32)( (phase << bits) >> 1 );
+  return add_fr1x32(a, mult_fr1x32x32(f, sub_fr1x32(b, a)));
+}
+
 // lookup given normalized index in [-1, 1]
 fract32 table_lookup_fract_bi(fract32* tab, u32 size, fract32 phase) {
   fix16 idx;
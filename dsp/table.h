@@ -38,8 +38,12 @@
 // de-intialize
 //extern void fixtable_deinit(fract32* tab);
  
-// lookup given 16.16 index in [0, size-1]
+// lookup given 16.16 index. size must be a power of two;
+// the index wraps to [0, size) by masking.
 extern fract32 table_lookup_idx(fract32* tab, u32 size, fix16 idx);
+// lookup given u32 phase, where the full range is one pass of a 2^bits table.
+// the phase wraps by overflow.
+extern fract32 table_lookup_phase(const fract32* tab, u32 bits, u32 phase);
 // lookup given normalized index in [-1, 1]
 extern fract32 table_lookup_fract(fract32* tab, u32 size, fract32 phase);
 
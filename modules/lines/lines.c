@@ -23,9 +23,11 @@
 
 // audio
 #include "buffer.h"
+#include "conversion.h"
 #include "filter_svf.h"
 #include "filter_1p.h"
-#include "filter_ramp.h"
+#include "mix_matrix.h"
+#include "slew_list.h"
 
 #include "delayFadeN.h"
 #include "module.h"
@@ -78,17 +80,15 @@ delayFadeN lines[NLINES];
 filter_svf svf[NLINES];
 
 //---- mix points
-// each input -> one delay
-fract32 mix_adc_del[4][2] = { {0, 0}, {0, 0}, {0, 0}, {0, 0} };
-// each delay -> each delay
-fract32 mix_del_del[2][2] = { { 0, 0 }, { 0, 0 } };
-// each input -> each output
-fract32 mix_adc_dac[4][4] = { { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 } };
-// each delay -> each dac
-fract32 mix_del_dac[2][4] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+// adc and delay outputs -> each delay input
+mixMatrix mixDel;
+// delay outputs and adc -> each dac
+mixMatrix mixDac;
+// input indices in each matrix
+#define LINES_MIX_DEL_ADC(i) (i)
+#define LINES_MIX_DEL_DEL(i) (4 + (i))
+#define LINES_MIX_DAC_DEL(i) (i)
+#define LINES_MIX_DAC_ADC(i) (NLINES + (i))
 
 // svf balance
 fract32 mix_fwet[NLINES] = { 0, 0 };
@@ -106,17 +106,16 @@ fract32 out_svf[NLINES] = { 0, 0 };
 //-- parameter integrators
 filter_1p_lo svfCutSlew[2];
 filter_1p_lo svfRqSlew[2];
+// unsettled integrators, with their indices in the list
+static slewList slews;
+#define LINES_SLEW_CUT(i) (i)
+#define LINES_SLEW_RQ(i) (NLINES + (i))
 
 //--- crossfade stuff
 /// which tap we are fading towards...
 u8 fadeTargetRd[2] = { 0, 0 };
 u8 fadeTargetWr[2] = { 0, 0 };
 
-// crossfade integrators
-/* filter_1p_lo lpFadeRd[2]; */
-/* filter_1p_lo lpFadeWr[2]; */
-filter_ramp_tog lpFadeRd[2];
-filter_ramp_tog lpFadeWr[2];
 
 // 10v dac values (u16, but use fract32 and audio integrators, for now)
 fract32 cvVal[4];
@@ -126,6 +125,15 @@ u8 cvChan = 0;
 ///////////////
 ////////////////
 
+// slew setters
+static void slew_set_cut(void* dst, fract32 val) {
+  filter_svf_set_coeff( (filter_svf*)dst, val );
+}
+
+static void slew_set_rq(void* dst, fract32 val) {
+  filter_svf_set_rq( (filter_svf*)dst, val );
+}
+
 // initial param set
 static inline void param_setup(u32 id, ParamValue v) {
   gModuleData->paramData[id].value = v;
@@ -133,122 +141,6 @@ static inline void param_setup(u32 id, ParamValue v) {
 }
 
 
-// mix delay inputs
-static void mix_del_inputs(void) {
-  //  u8 i, j;
-  //  fract32* pIn;
-  fract32 mul;
-  
-  //--- del 0
-  in_del[0] = 0;
-
-  //adc->del
-  mul = mix_adc_del[0][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_del[1][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_del[2][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_del[3][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(in[3], mul)); 
-
-  // del->del
-  mul = mix_del_del[0][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_del[1][0];
-  in_del[0] = add_fr1x32(in_del[0], mult_fr1x32x32(out_del[1], mul)); 
-
-  //--- del 1
-  in_del[1] = 0;
-  // adc
-  mul = mix_adc_del[0][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_del[1][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_del[2][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_del[3][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(in[3], mul)); 
-  // del 
-  mul = mix_del_del[0][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_del[1][1];
-  in_del[1] = add_fr1x32(in_del[1], mult_fr1x32x32(out_del[1], mul));
-}
-
-static void mix_outputs(void) {
-  fract32 mul;
-  
-  //-- out 0
-  out[0] = 0;
-  // del
-  mul = mix_del_dac[0][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_dac[1][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(out_del[1], mul)); 
-  // adc
-  mul = mix_adc_dac[0][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[3], mul)); 
-
-  //-- out 1
-  out[1] = 0;
-  // del
-  mul = mix_del_dac[0][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_dac[1][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(out_del[1], mul)); 
-  // adc
-  mul = mix_adc_dac[0][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[3], mul)); 
-
-  //-- out 2
-  out[2] = 0;
-  // del
-  mul = mix_del_dac[0][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_dac[1][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(out_del[1], mul)); 
-  // adc
-  mul = mix_adc_dac[0][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[3], mul)); 
-
-  //-- out 3
-  out[3] = 0;
-  // del
-  mul = mix_del_dac[0][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(out_del[0], mul)); 
-  mul = mix_del_dac[1][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(out_del[1], mul)); 
-  // adc
-  mul = mix_adc_dac[0][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[3], mul));
-
-}
-
 //----------------------
 //----- external functions
 
@@ -280,8 +172,6 @@ void module_init(void) {
     filter_1p_lo_init(&(svfCutSlew[i]), 0x3fffffff);
     filter_1p_lo_init(&(svfRqSlew[i]), 0x3fffffff);
 
-    filter_ramp_tog_init(&(lpFadeRd[i]), 0);
-    filter_ramp_tog_init(&(lpFadeWr[i]), 0);
   
     /* filter_svf_set_rq(&(svf[i]), 0x1000); */
     /* filter_svf_set_low(&(svf[i]), 0x4000); */
@@ -292,14 +182,41 @@ void module_init(void) {
     memset(pLinesData->audioBuffer[i], 0, LINES_BUF_FRAMES * 4);
   }
 
+  // register integrators in the order of LINES_SLEW_CUT / LINES_SLEW_RQ
+  slew_list_init(&slews);
+  for(i=0; i<NLINES; i++) {
+    slew_list_add(&slews, &(svfCutSlew[i]), &slew_set_cut, &(svf[i]));
+  }
+  for(i=0; i<NLINES; i++) {
+    slew_list_add(&slews, &(svfRqSlew[i]), &slew_set_rq, &(svf[i]));
+  }
+
+  // register mix signals in the order of LINES_MIX_*
+  mix_matrix_init(&mixDel, 4 + NLINES, NLINES);
+  mix_matrix_init(&mixDac, NLINES + 4, 4);
+  for(i=0; i<4; i++) {
+    mix_matrix_set_src(&mixDel, LINES_MIX_DEL_ADC(i), &(in[i]));
+    mix_matrix_set_src(&mixDac, LINES_MIX_DAC_ADC(i), &(in[i]));
+    mix_matrix_set_dst(&mixDac, i, &(out[i]));
+  }
+  for(i=0; i<NLINES; i++) {
+    mix_matrix_set_src(&mixDel, LINES_MIX_DEL_DEL(i), &(out_del[i]));
+    mix_matrix_set_src(&mixDac, LINES_MIX_DAC_DEL(i), &(out_del[i]));
+    mix_matrix_set_dst(&mixDel, i, &(in_del[i]));
+  }
+
   /// setup params with intial values
 
   param_setup( eParamFade0 , 0x100000 );
   param_setup( eParamFade1 , 0x100000 );
+  param_setup( eParamFadeTime0 , PARAM_FADE_TIME_DEFAULT );
+  param_setup( eParamFadeTime1 , PARAM_FADE_TIME_DEFAULT );
 
   param_setup( 	eParam_loop0,		PARAM_SECONDS_MAX );
   param_setup( 	eParam_rMul0,		0x10000 );
   param_setup( 	eParam_rDiv0,		0x10000 );
+  param_setup( 	eParam_rate0,		0x10000 );
+  param_setup( 	eParam_cubic0,		1 );
   param_setup( 	eParam_write0,		FRACT32_MAX );
   param_setup( 	eParam_pre0,		0 );
   param_setup( 	eParam_pos_write0,		0 );
@@ -313,6 +230,8 @@ void module_init(void) {
   param_setup( 	eParam_loop1,		PARAM_SECONDS_MAX );
   param_setup( 	eParam_rMul1,		0x10000 );
   param_setup( 	eParam_rDiv1,		0x10000 );
+  param_setup( 	eParam_rate1,		0x10000 );
+  param_setup( 	eParam_cubic1,		1 );
   param_setup( 	eParam_write1,		FRACT32_MAX );
   param_setup( 	eParam_pre1,		0 );
   param_setup( 	eParam_pos_write1,		0 );
@@ -390,24 +309,16 @@ void module_process_frame(void) {
   tmpDel = 0;
   tmpSvf = 0;
 
+  // integrators for filter params, while they move
+  slew_list_next(&slews);
+
   // mix inputs to delay lines
-  mix_del_inputs();
+  mix_matrix_next(&mixDel);
 
   for(i=0; i<NLINES; i++) {
-    // process fade integrator
-    //    lines[i].fadeWr = filter_ramp_tog_next(&(lpFadeWr[i]));
-    lines[i].fadeRd = filter_ramp_tog_next(&(lpFadeRd[i]));
-
-    // process delay line
+    // process delay line (including read crossfade)
     tmpDel = delayFadeN_next( &(lines[i]), in_del[i]);	    
     // process filters
-    // check integrators for filter params
-    if( !(svfCutSlew[i].sync) ) {
-      filter_svf_set_coeff( &(svf[i]), filter_1p_lo_next(&(svfCutSlew[i])) );
-    }
-    if( !(svfRqSlew[i].sync) ) {
-      filter_svf_set_rq( &(svf[i]), filter_1p_lo_next(&(svfRqSlew[i])) );
-    }
     tmpSvf = filter_svf_next( &(svf[i]), tmpDel);  
     // mix
     tmpDel = mult_fr1x32x32( tmpDel, mix_fdry[i] );
@@ -418,7 +329,7 @@ void module_process_frame(void) {
   } // end lines loop 
  
     // mix outputs to DACs
-  mix_outputs();
+  mix_matrix_next(&mixDac);
 
   /// do CV output
   if( !(cvSlew[cvChan].sync) ) { 
@@ -2,27 +2,15 @@
 
 // check crossfade status of target
 static void check_fade_rd(u8 id) {
-  u8 newTarget, oldTarget = fadeTargetRd[id];
-  if(lpFadeRd[id].sync) {
-    // not fading right now, so pick different target and start crossfade
-    newTarget =  oldTarget ^ 1;
-    // copy all tap parameters to target
-    buffer_tapN_copy( &(lines[id].tapRd[oldTarget]) ,  &(lines[id].tapRd[newTarget]) );
-    // start the fade
-    filter_ramp_tog_in(&(lpFadeRd[id]), newTarget);
-    fadeTargetRd[id] = newTarget;
-  }
+  // if not fading right now, copy the current tap to the other and fade to it
+  fadeTargetRd[id] = delayFadeN_fade_read(&(lines[id]));
+}
+
+// length in samples of a ramp from 0 to 1 with the given fade param increment
+static u32 fade_inc_samp(ParamValue v) {
+  return (u32)FR32_MAX / (u32)(v + PARAM_FADE_ADD);
 }
 
-/*
-static void check_fade_wr(u8 id) {
-  if(lpFadeWr[id].sync) {
-    // not fading right now, so pick different target and start crossfade
-    fadeTargetWr[id] ^= 1;
-    filter_1p_lo_in(&(lpFadeWr[id]), (fract32)((u32)(fadeTargetWr[id]) << 31) - 1);
-  }
-} 
-*/ 
 
 void module_set_param(u32 idx, ParamValue v) {
   switch(idx) {
@@ -87,6 +75,18 @@ void module_set_param(u32 idx, ParamValue v) {
     check_fade_rd(1);
     delayFadeN_set_div(&(lines[1]), v >> 16 , fadeTargetRd[1]);
     break;
+  case eParam_rate0 :
+    delayFadeN_set_rate(&(lines[0]), v, fadeTargetRd[0]);
+    break;
+  case eParam_rate1 :
+    delayFadeN_set_rate(&(lines[1]), v, fadeTargetRd[1]);
+    break;
+  case eParam_cubic0 :
+    delayFadeN_set_cubic(&(lines[0]), v > 0);
+    break;
+  case eParam_cubic1 :
+    delayFadeN_set_cubic(&(lines[1]), v > 0);
+    break;
   case eParam_write0 :
     /// FIXME: need write level...
     delayFadeN_set_write(&(lines[0]), v > 0);
@@ -114,23 +114,23 @@ void module_set_param(u32 idx, ParamValue v) {
     // filter params
   case eParam_freq0 :
     //    filter_svf_set_coeff(&(svf[0]), v );
-    filter_1p_lo_in(&(svfCutSlew[0]), v);
+    slew_list_in(&slews, LINES_SLEW_CUT(0), v);
     break;
   case eParam_freq1 :
     //    filter_svf_set_coeff(&(svf[1]), v );
-    filter_1p_lo_in(&(svfCutSlew[1]), v);
+    slew_list_in(&slews, LINES_SLEW_CUT(1), v);
     break;
   case eParam_rq0 :
     //    filter_svf_set_rq(&(svf[0]), v);
     // incoming param value is 16.16
     // target is 2.30xs
     //    filter_svf_set_rq(&(svf[0]), v << 14);
-    filter_1p_lo_in(&(svfRqSlew[0]), v << 14);
+    slew_list_in(&slews, LINES_SLEW_RQ(0), v << 14);
     break;
   case eParam_rq1 :
     //    filter_svf_set_rq(&(svf[1]), v);
     //    filter_svf_set_rq(&(svf[1]), v << 14);
-    filter_1p_lo_in(&(svfRqSlew[1]), v << 14);
+    slew_list_in(&slews, LINES_SLEW_RQ(1), v << 14);
     break;
   case eParam_low0 :
     filter_svf_set_low(&(svf[0]), v);
@@ -176,114 +176,114 @@ void module_set_param(u32 idx, ParamValue v) {
 
     /// mix points
   case eParam_adc0_del0 :
-    mix_adc_del[0][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(0), 0, v);
     break;
   case eParam_adc0_del1 :
-    mix_adc_del[0][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(0), 1, v);
     break;
   case eParam_adc1_del0 :
-    mix_adc_del[1][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(1), 0, v);
     break;
   case eParam_adc1_del1 :
-    mix_adc_del[1][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(1), 1, v);
     break;
   case eParam_adc2_del0 :
-    mix_adc_del[2][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(2), 0, v);
     break;
   case eParam_adc2_del1 :
-    mix_adc_del[2][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(2), 1, v);
     break;
   case eParam_adc3_del0 :
-    mix_adc_del[3][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(3), 0, v);
     break;
   case eParam_adc3_del1 :
-    mix_adc_del[3][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_ADC(3), 1, v);
     break;
   case eParam_del0_del0 :
-    mix_del_del[0][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_DEL(0), 0, v);
     break;
   case eParam_del0_del1 :
-    mix_del_del[0][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_DEL(0), 1, v);
     break;
   case eParam_del1_del0 :
-    mix_del_del[1][0] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_DEL(1), 0, v);
     break;
   case eParam_del1_del1 :
-    mix_del_del[1][1] = v;
+    mix_matrix_set(&mixDel, LINES_MIX_DEL_DEL(1), 1, v);
     break;
     // dry :
   case eParam_adc0_dac0 :
-    mix_adc_dac[0][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(0), 0, v);
     break;
   case eParam_adc0_dac1 :
-    mix_adc_dac[0][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(0), 1, v);
     break;
   case eParam_adc0_dac2 :
-    mix_adc_dac[0][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(0), 2, v);
     break;
   case eParam_adc0_dac3 :
-    mix_adc_dac[0][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(0), 3, v);
     break;
   case eParam_adc1_dac0 :
-    mix_adc_dac[1][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(1), 0, v);
     break;
   case eParam_adc1_dac1 :
-    mix_adc_dac[1][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(1), 1, v);
     break;
   case eParam_adc1_dac2 :
-    mix_adc_dac[1][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(1), 2, v);
     break;
   case eParam_adc1_dac3 :
-    mix_adc_dac[1][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(1), 3, v);
     break;
   case eParam_adc2_dac0 :
-    mix_adc_dac[2][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(2), 0, v);
     break;
   case eParam_adc2_dac1 :
-    mix_adc_dac[2][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(2), 1, v);
     break;
   case eParam_adc2_dac2 :
-    mix_adc_dac[2][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(2), 2, v);
     break;
   case eParam_adc2_dac3 :
-    mix_adc_dac[2][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(2), 3, v);
     break;
   case eParam_adc3_dac0 :
-    mix_adc_dac[3][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(3), 0, v);
     break;
   case eParam_adc3_dac1 :
-    mix_adc_dac[3][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(3), 1, v);
     break;
   case eParam_adc3_dac2 :
-    mix_adc_dac[3][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(3), 2, v);
     break;
   case eParam_adc3_dac3 :
-    mix_adc_dac[3][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_ADC(3), 3, v);
     break;
     // wet :
   case eParam_del0_dac0 :
-    mix_del_dac[0][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(0), 0, v);
     break;
   case eParam_del0_dac1 :
-    mix_del_dac[0][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(0), 1, v);
     break;
   case eParam_del0_dac2 :
-    mix_del_dac[0][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(0), 2, v);
     break;
   case eParam_del0_dac3 :
-    mix_del_dac[0][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(0), 3, v);
     break;
   case eParam_del1_dac0 :
-    mix_del_dac[1][0] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(1), 0, v);
     break;
   case eParam_del1_dac1 :
-    mix_del_dac[1][1] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(1), 1, v);
     break;
   case eParam_del1_dac2 :
-    mix_del_dac[1][2] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(1), 2, v);
     break;
   case eParam_del1_dac3 :
-    mix_del_dac[1][3] = v;
+    mix_matrix_set(&mixDac, LINES_MIX_DAC_DEL(1), 3, v);
     break;
 
     // param integrators
@@ -333,15 +333,21 @@ void module_set_param(u32 idx, ParamValue v) {
     filter_1p_lo_set_slew(&(cvSlew[3]), v);
     break;
 
-    // fade times
+    // fade times as ramp increments per sample
     // FIXME: range hack is real dumb
   case eParamFade0 :
-    filter_ramp_tog_set_inc(&(lpFadeRd[0]), v + PARAM_FADE_ADD );
-    filter_ramp_tog_set_inc(&(lpFadeWr[0]), v + PARAM_FADE_ADD);
+    delayFadeN_set_fade_samp(&(lines[0]), fade_inc_samp(v));
     break;
   case eParamFade1 :
-    filter_ramp_tog_set_inc(&(lpFadeRd[1]), v + PARAM_FADE_ADD);
-    filter_ramp_tog_set_inc(&(lpFadeWr[1]), v + PARAM_FADE_ADD);
+    delayFadeN_set_fade_samp(&(lines[1]), fade_inc_samp(v));
+    break;
+
+    // fade times in seconds
+  case eParamFadeTime0 :
+    delayFadeN_set_fade_samp(&(lines[0]), sec_to_frames_trunc(v));
+    break;
+  case eParamFadeTime1 :
+    delayFadeN_set_fade_samp(&(lines[1]), sec_to_frames_trunc(v));
     break;
 
 
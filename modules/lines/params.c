@@ -621,6 +621,47 @@ void fill_param_desc(void) {
   gModuleData->paramDesc[eParamFade1].max = PARAM_FADE_MAX;
   gModuleData->paramDesc[eParamFade1].radix = PARAM_FADE_RADIX;
 
+  // fractional read rate, multiplied by rMul / rDiv
+  strcpy(gModuleData->paramDesc[eParam_rate0].label, "rate0");
+  gModuleData->paramDesc[eParam_rate0].type = eParamTypeFix;
+  gModuleData->paramDesc[eParam_rate0].min = PARAM_RATE_MIN;
+  gModuleData->paramDesc[eParam_rate0].max = PARAM_RATE_MAX;
+  gModuleData->paramDesc[eParam_rate0].radix = PARAM_RATE_RADIX;
+
+  // read interpolation: 0 = linear, 1 = cubic
+  strcpy(gModuleData->paramDesc[eParam_cubic0].label, "cubic0");
+  gModuleData->paramDesc[eParam_cubic0].type = eParamTypeBool;
+  gModuleData->paramDesc[eParam_cubic0].min = 0;
+  gModuleData->paramDesc[eParam_cubic0].max = 1;
+  gModuleData->paramDesc[eParam_cubic0].radix = 2;
+
+  // fractional read rate, multiplied by rMul / rDiv
+  strcpy(gModuleData->paramDesc[eParam_rate1].label, "rate1");
+  gModuleData->paramDesc[eParam_rate1].type = eParamTypeFix;
+  gModuleData->paramDesc[eParam_rate1].min = PARAM_RATE_MIN;
+  gModuleData->paramDesc[eParam_rate1].max = PARAM_RATE_MAX;
+  gModuleData->paramDesc[eParam_rate1].radix = PARAM_RATE_RADIX;
+
+  // read interpolation: 0 = linear, 1 = cubic
+  strcpy(gModuleData->paramDesc[eParam_cubic1].label, "cubic1");
+  gModuleData->paramDesc[eParam_cubic1].type = eParamTypeBool;
+  gModuleData->paramDesc[eParam_cubic1].min = 0;
+  gModuleData->paramDesc[eParam_cubic1].max = 1;
+  gModuleData->paramDesc[eParam_cubic1].radix = 2;
+
+  // crossfade time in seconds
+  strcpy(gModuleData->paramDesc[eParamFadeTime0].label, "fadeTime0");
+  gModuleData->paramDesc[eParamFadeTime0].type = eParamTypeFix;
+  gModuleData->paramDesc[eParamFadeTime0].min = PARAM_FADE_TIME_MIN;
+  gModuleData->paramDesc[eParamFadeTime0].max = PARAM_FADE_TIME_MAX;
+  gModuleData->paramDesc[eParamFadeTime0].radix = PARAM_FADE_TIME_RADIX;
+
+  strcpy(gModuleData->paramDesc[eParamFadeTime1].label, "fadeTime1");
+  gModuleData->paramDesc[eParamFadeTime1].type = eParamTypeFix;
+  gModuleData->paramDesc[eParamFadeTime1].min = PARAM_FADE_TIME_MIN;
+  gModuleData->paramDesc[eParamFadeTime1].max = PARAM_FADE_TIME_MAX;
+  gModuleData->paramDesc[eParamFadeTime1].radix = PARAM_FADE_TIME_RADIX;
+
 }
 
 // EOF
@@ -26,14 +26,21 @@
 #define SMOOTH_FREQ_RADIX 7
 
 /// FIXME: 
-// right now, "fade" is the increment rate of a linear ramp.
-// not very intuitve
+// "fade" is the increment rate of a linear ramp.
+// not very intuitve; kept so old scenes recall the same fades.
+// fadeTime sets the same crossfade in seconds.
 #define PARAM_FADE_MIN 0x20000    // ~3.41s.
 #define PARAM_FADE_MAX 0x20000000 // < 1ms  
 #define PARAM_FADE_RADIX 16
 // fixme: what a stupid hack
 #define PARAM_FADE_ADD 0x20000
 
+// crossfade time in seconds, 16.16
+#define PARAM_FADE_TIME_MIN 0x40       // ~1ms
+#define PARAM_FADE_TIME_MAX 0x40000    // 4s
+#define PARAM_FADE_TIME_DEFAULT 0xa00  // ~40ms
+#define PARAM_FADE_TIME_RADIX 3
+
 // svf cutoff
 #define PARAM_CUT_MAX     0x7fffffff
 #define PARAM_CUT_DEFAULT 0x43D0A8EC
@@ -188,6 +195,16 @@ enum params {
   eParam_write0,	       
   eParam_delay0,	   
 
+  // read rate and interpolation
+  eParam_rate1,
+  eParam_cubic1,
+  eParam_rate0,
+  eParam_cubic0,
+
+  // xfade time in seconds
+  eParamFadeTime0,
+  eParamFadeTime1,
+
   eParamNumParams
 };  
 
@@ -1,83 +1,146 @@
 // set param values.
 // this is a separate file for convenience only.
 
+// set a param of voice 2 and up, given offset from eParamVoice2
+static void voice_set_param(u32 off, ParamValue v) {
+  const u8 i = 2 + (off / eVoiceNumParams);
+  switch(off % eVoiceNumParams) {
+  case eVoiceHz :
+    osc_bank_set_hz( &bank, i, v );
+    break;
+  case eVoiceTune :
+    osc_bank_set_tune( &bank, i, v );
+    break;
+  case eVoiceWave :
+    osc_bank_set_shape( &bank, i, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    break;
+  case eVoiceAmp :
+    slew_list_in( &slews, WAVES_SLEW(i, eSlewAmp), v );
+    break;
+  case eVoiceBl :
+    osc_bank_set_bl( &bank, i, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    break;
+  case eVoicePm :
+    osc_bank_set_pm( &bank, i, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    break;
+  case eVoiceWm :
+    osc_bank_set_wm( &bank, i, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    break;
+  case eVoiceCut :
+    slew_list_in( &slews, WAVES_SLEW(i, eSlewCut), v );
+    break;
+  case eVoiceRq :
+    // incoming param value is 16.16
+    // target is 2.30
+    slew_list_in( &slews, WAVES_SLEW(i, eSlewRq), v << 14 );
+    break;
+  case eVoiceLow :
+    filter_svf_set_low( &(voice[i].svf), v );
+    break;
+  case eVoiceHigh :
+    filter_svf_set_high( &(voice[i].svf), v );
+    break;
+  case eVoiceBand :
+    filter_svf_set_band( &(voice[i].svf), v );
+    break;
+  case eVoiceNotch :
+    filter_svf_set_notch( &(voice[i].svf), v );
+    break;
+  case eVoiceWet :
+    voice[i].fWet = v;
+    break;
+  case eVoiceDry :
+    voice[i].fDry = v;
+    break;
+  case eVoiceDac0 :
+  case eVoiceDac1 :
+  case eVoiceDac2 :
+  case eVoiceDac3 :
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(i), (off % eVoiceNumParams) - eVoiceDac0, v );
+    break;
+  default:
+    break;
+  }
+}
+
 void module_set_param(u32 idx, ParamValue v) {
+  u8 i;
   switch(idx) {
 
   case eParamHz1:
-    osc_set_hz( &(voice[1].osc), v );
+    osc_bank_set_hz( &bank, 1, v );
     break;
   case eParamHz0:
-    osc_set_hz( &(voice[0].osc), v );
+    osc_bank_set_hz( &bank, 0, v );
     break;
 
   case eParamTune1:
-    osc_set_tune( &(voice[1].osc), v );
+    osc_bank_set_tune( &bank, 1, v );
     break;
   case eParamTune0:
-    osc_set_tune( &(voice[0].osc), v );
+    osc_bank_set_tune( &bank, 0, v );
     break;
 
   case eParamWave1:
-    osc_set_shape( &(voice[1].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_shape( &bank, 1, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
   case eParamWave0:
-    osc_set_shape( &(voice[0].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_shape( &bank, 0, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
 
     // FIXME: this is assuming simple fixed x-modulation with 2 voices.
     /// should have a matrix of modulation mix points.
   case eParamPm10:
-    osc_set_pm ( &(voice[0].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_pm( &bank, 0, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
   case eParamPm01:
-    osc_set_pm ( &(voice[1].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_pm( &bank, 1, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
 
   case eParamWm10:
-    osc_set_wm ( &(voice[0].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_wm( &bank, 0, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
   case eParamWm01:
-    osc_set_wm ( &(voice[1].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_wm( &bank, 1, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
 
   case eParamAmp1:
     //     filter_1p_lo_in(amp1Lp, v);
-    filter_1p_lo_in(&(voice[1].ampSlew), v);
+    slew_list_in( &slews, WAVES_SLEW(1, eSlewAmp), v );
     
     break;
   case eParamAmp0:
     //    filter_1p_lo_in(amp0Lp, v);
-    filter_1p_lo_in(&(voice[0].ampSlew), v);
+    slew_list_in( &slews, WAVES_SLEW(0, eSlewAmp), v );
     break;
 
   case eParamBl1 :
-    osc_set_bl( &(voice[1].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_bl( &bank, 1, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
   case eParamBl0 :
-    osc_set_bl( &(voice[0].osc), BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
+    osc_bank_set_bl( &bank, 0, BIT_ABS_32(FIX16_FRACT_TRUNC(v)) );
     break;
 
     //// filter params:
   case eParam_cut1 :
     //    filter_svf_set_coeff(&(voice[1].svf), v );
-    filter_1p_lo_in( &(voice[1].cutSlew), v );
+    slew_list_in( &slews, WAVES_SLEW(1, eSlewCut), v );
     break;
   case eParam_cut0 :
     //    filter_svf_set_coeff(&(voice[0].svf), v );
-    filter_1p_lo_in( &(voice[0].cutSlew), v );
+    slew_list_in( &slews, WAVES_SLEW(0, eSlewCut), v );
     break;
   case eParam_rq1 :
     // incoming param value is 16.16
     // target is 2.30
     //    filter_svf_set_rq(&(voice[1].svf), v);
     //    filter_svf_set_rq(&(voice[1].svf), v << 14);
-    filter_1p_lo_in( &(voice[1].rqSlew), v << 14 );
+    slew_list_in( &slews, WAVES_SLEW(1, eSlewRq), v << 14 );
     break;
   case eParam_rq0 :
     //    filter_svf_set_rq(&(voice[0].svf), v);
     //    filter_svf_set_rq(&(voice[0].svf), v << 14);
-    filter_1p_lo_in( &(voice[0].rqSlew), v << 14 );
+    slew_list_in( &slews, WAVES_SLEW(0, eSlewRq), v << 14 );
 
     break;
   case eParam_low1 :
@@ -125,52 +188,76 @@ void module_set_param(u32 idx, ParamValue v) {
     ///// slewers
 
   case eParamHz1Slew:
-    filter_1p_lo_set_slew( &(voice[1].osc.lpInc), v); 
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_inc_slew( &bank, i, v );
+    }
     break;
   case eParamHz0Slew:
-    filter_1p_lo_set_slew( &(voice[0].osc.lpInc), v); 
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_inc_slew( &bank, i, v );
+    }
     break;
 
   case eParamPm01Slew:
-    filter_1p_lo_set_slew( &(voice[1].osc.lpPm), v); 
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_pm_slew( &bank, i, v );
+    }
     break;
   case eParamPm10Slew:
-    filter_1p_lo_set_slew( &(voice[0].osc.lpPm), v); 
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_pm_slew( &bank, i, v );
+    }
     break;
 
   case eParamWm01Slew:
-    filter_1p_lo_set_slew( &(voice[1].osc.lpWm), v); 
+    // shape modulation isn't smoothed yet
     break;
   case eParamWm10Slew:
-    filter_1p_lo_set_slew( &(voice[0].osc.lpWm), v); 
+    // shape modulation isn't smoothed yet
     break;
 
   case eParamWave1Slew:
-    filter_1p_lo_set_slew( &(voice[1].osc.lpShape), v); 
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_shape_slew( &bank, i, v );
+    }
     break;
   case eParamWave0Slew:
-    filter_1p_lo_set_slew( &(voice[0].osc.lpShape), v); 
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      osc_bank_set_shape_slew( &bank, i, v );
+    }
     break;
   case eParamAmp1Slew:
-    filter_1p_lo_set_slew( &(voice[1].ampSlew), v);
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].ampSlew), v);
+    }
     break;
   case eParamAmp0Slew:
-    filter_1p_lo_set_slew( &(voice[0].ampSlew), v);
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].ampSlew), v);
+    }
     break;
 
     // param integrators
   case eParamCut0Slew :
-    filter_1p_lo_set_slew(&(voice[0].cutSlew), v);
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].cutSlew), v);
+    }
     break;
   case eParamCut1Slew :
-    filter_1p_lo_set_slew(&(voice[1].cutSlew), v);
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].cutSlew), v);
+    }
     break;
 
   case eParamRq0Slew :
-    filter_1p_lo_set_slew(&(voice[0].rqSlew), v);
+    for(i=0; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].rqSlew), v);
+    }
     break;
   case eParamRq1Slew :
-    filter_1p_lo_set_slew(&(voice[1].rqSlew), v);
+    for(i=1; i<WAVES_NVOICES; i+=2) {
+      filter_1p_lo_set_slew(&(voice[i].rqSlew), v);
+    }
     break;
 
     // cv values
@@ -206,85 +293,88 @@ void module_set_param(u32 idx, ParamValue v) {
 
    // i/o mix:
   case eParam_adc0_dac0 :
-    mix_adc_dac[0][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(0), 0, v );
     //    ioAmp0 = v;
     break;
   case eParam_adc0_dac1 :
-    mix_adc_dac[0][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(0), 1, v );
     break;
   case eParam_adc0_dac2 :
-    mix_adc_dac[0][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(0), 2, v );
     break;
   case eParam_adc0_dac3 :
-    mix_adc_dac[0][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(0), 3, v );
     break;
   case eParam_adc1_dac0 :
-    mix_adc_dac[1][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(1), 0, v );
     break;
   case eParam_adc1_dac1 :
-    mix_adc_dac[1][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(1), 1, v );
     //    ioAmp1 = v;
     break;
   case eParam_adc1_dac2 :
-    mix_adc_dac[1][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(1), 2, v );
     break;
   case eParam_adc1_dac3 :
-    mix_adc_dac[1][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(1), 3, v );
     break;
   case eParam_adc2_dac0 :
-    mix_adc_dac[2][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(2), 0, v );
     break;
   case eParam_adc2_dac1 :
-    mix_adc_dac[2][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(2), 1, v );
     break;
   case eParam_adc2_dac2 :
-    mix_adc_dac[2][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(2), 2, v );
     //    ioAmp2 = v;
     break;
   case eParam_adc2_dac3 :
-    mix_adc_dac[2][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(2), 3, v );
     break;
   case eParam_adc3_dac0 :
-    mix_adc_dac[3][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(3), 0, v );
     break;
   case eParam_adc3_dac1 :
-    mix_adc_dac[3][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(3), 1, v );
     break;
   case eParam_adc3_dac2 :
-    mix_adc_dac[3][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(3), 2, v );
     break;
   case eParam_adc3_dac3 :
-    mix_adc_dac[3][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_ADC(3), 3, v );
     //    ioAmp3 = v;
     break;
     // osc mix:
   case eParam_osc0_dac0 :
-    mix_osc_dac[0][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(0), 0, v );
     break;
   case eParam_osc0_dac1 :
-    mix_osc_dac[0][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(0), 1, v );
     break;
   case eParam_osc0_dac2 :
-    mix_osc_dac[0][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(0), 2, v );
     break;
   case eParam_osc0_dac3 :
-    mix_osc_dac[0][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(0), 3, v );
     break;
   case eParam_osc1_dac0 :
-    mix_osc_dac[1][0] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(1), 0, v );
     break;
   case eParam_osc1_dac1 :
-    mix_osc_dac[1][1] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(1), 1, v );
     break;
   case eParam_osc1_dac2 :
-    mix_osc_dac[1][2] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(1), 2, v );
     break;
   case eParam_osc1_dac3 :
-    mix_osc_dac[1][3] = v;
+    mix_matrix_set( &mixDac, WAVES_MIX_OSC(1), 3, v );
     break;
 
 
   default:
+    if(idx >= eParamVoice2) {
+      voice_set_param(idx - eParamVoice2, v);
+    }
     break;
   }
 
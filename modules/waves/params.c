@@ -9,6 +9,79 @@
 #include "osc.h"
 #include "params.h" 
 
+// fill one descriptor of an added voice.
+// the label is a name, the voice number, and an optional suffix and digit.
+static void fill_voice_desc(u32 id, const char* name, u8 v,
+			    const char* suffix, s8 d,
+			    ParamType type, s32 min, s32 max, u8 radix) {
+  ParamDesc* desc = &(gModuleData->paramDesc[id]);
+  char* c;
+  strcpy(desc->label, name);
+  c = desc->label + strlen(desc->label);
+  *c++ = '0' + v;
+  *c = '\0';
+  if(suffix != NULL) {
+    strcpy(c, suffix);
+    c += strlen(suffix);
+  }
+  if(d >= 0) {
+    *c++ = '0' + d;
+    *c = '\0';
+  }
+  desc->type = type;
+  desc->min = min;
+  desc->max = max;
+  desc->radix = radix;
+}
+
+// fill descriptors of voices 2 and up
+static void fill_voice_descs(void) {
+  u32 id;
+  u8 v;
+  for(v=2; v<WAVES_NVOICES; v++) {
+    id = eParamVoice2 + ((v - 2) * eVoiceNumParams);
+    fill_voice_desc(id + eVoiceHz, "hz", v, NULL, -1,
+		    eParamTypeNote, OSC_HZ_MIN, OSC_HZ_MAX, OSC_HZ_RADIX);
+    fill_voice_desc(id + eVoiceTune, "tune", v, NULL, -1,
+		    eParamTypeFix, RATIO_MIN, RATIO_MAX, RATIO_RADIX);
+    fill_voice_desc(id + eVoiceWave, "wave", v, NULL, -1,
+		    eParamTypeFix, 0, FRACT32_MAX, 1);
+    fill_voice_desc(id + eVoiceAmp, "amp", v, NULL, -1,
+		    eParamTypeAmp, 0, FRACT32_MAX >> 1, 1);
+    fill_voice_desc(id + eVoiceBl, "bl", v, NULL, -1,
+		    eParamTypeFix, 0, FRACT32_MAX, 1);
+    // modulation labels name the source first, as pm10 and wm10
+    fill_voice_desc(id + eVoicePm, "pm", v ^ 1, NULL, v,
+		    eParamTypeFix, 0, FRACT32_MAX, 1);
+    fill_voice_desc(id + eVoiceWm, "wm", v ^ 1, NULL, v,
+		    eParamTypeFix, 0, FRACT32_MAX, 1);
+    fill_voice_desc(id + eVoiceCut, "cut", v, NULL, -1,
+		    eParamTypeSvfFreq, 0, PARAM_CUT_MAX, 32);
+    fill_voice_desc(id + eVoiceRq, "rq", v, NULL, -1,
+		    eParamTypeFix, PARAM_RQ_MIN, PARAM_RQ_MAX, 2);
+    fill_voice_desc(id + eVoiceLow, "low", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceHigh, "high", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceBand, "band", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceNotch, "notch", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceWet, "fwet", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceDry, "fdry", v, NULL, -1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceDac0, "osc", v, "_dac", 0,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceDac1, "osc", v, "_dac", 1,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceDac2, "osc", v, "_dac", 2,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+    fill_voice_desc(id + eVoiceDac3, "osc", v, "_dac", 3,
+		    eParamTypeAmp, 0, FR32_MAX, 1);
+  }
+}
+
 void fill_param_desc(void) {
 
   strcpy(gModuleData->paramDesc[eParamHz0].label, "hz0");
@@ -601,5 +674,5 @@ void fill_param_desc(void) {
   gModuleData->paramDesc[eParamMixSlew].max = FR32_MAX;
   gModuleData->paramDesc[eParamMixSlew].radix = 32;
 
-
+  fill_voice_descs();
 }
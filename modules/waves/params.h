@@ -55,6 +55,44 @@
 
 #define NUM_PARAMS eParamNumParams
 
+// count of voices.
+// voices run in pairs, each voice phase-modulated by its partner.
+//
+// frame cost at 8 voices is estimated by counting, not measured on the blackfin:
+// per voice, 3 smoother + 1 pm + 4 to 9 lookup + 7 to 10 filter + 3 amp
+// fract32 multiplies, so 144 to 208 for the bank, plus one per nonzero mix send
+// (36 at the defaults, 48 at most). at about 3 cycles per multiply
+// and as much again for loads, stores and loops, that is 1100 to 1600 cycles,
+// against a budget of (core clock / samplerate) per frame.
+// table reads all hit L1, so there are no external memory stalls to add.
+#define WAVES_NVOICES 8
+
+// parameters of each voice after the first two,
+// which have their own named parameters.
+// slews are shared with voice 0 (even voices) or voice 1 (odd voices).
+enum voiceParams {
+  eVoiceHz,
+  eVoiceTune,
+  eVoiceWave,
+  eVoiceAmp,
+  eVoiceBl,
+  eVoicePm,
+  eVoiceWm,
+  eVoiceCut,
+  eVoiceRq,
+  eVoiceLow,
+  eVoiceHigh,
+  eVoiceBand,
+  eVoiceNotch,
+  eVoiceWet,
+  eVoiceDry,
+  eVoiceDac0,
+  eVoiceDac1,
+  eVoiceDac2,
+  eVoiceDac3,
+  eVoiceNumParams
+};
+
 
 // parameters
 enum params {
@@ -183,7 +221,10 @@ enum params {
   eParamHz1,
   eParamHz0,
 
-  eParamNumParams
+  // voices 2 and up, in blocks of eVoiceNumParams
+  eParamVoice2,
+
+  eParamNumParams = eParamVoice2 + ((WAVES_NVOICES - 2) * eVoiceNumParams)
 };
 
 
@@ -13,7 +13,10 @@
 // audio lib
 #include "filter_1p.h"
 #include "filter_svf.h"
+#include "mix_matrix.h"
 #include "osc.h"
+#include "osc_bank.h"
+#include "slew_list.h"
 #include "table.h"
 #include "conversion.h"
 // bfin
@@ -28,7 +31,9 @@
 #include "types.h"
 
 
-#define WAVES_NVOICES 2
+#if WAVES_NVOICES != OSC_BANK_NUM
+#error "waves: voice count must match the oscillator bank"
+#endif
 
 //-------- data types
 
@@ -44,16 +49,13 @@ typedef struct _wavesData {
 } wavesData;
 
 
-// single "voice" structure
+// single "voice" structure.
+// oscillators are in the bank, which runs all voices in one loop.
 typedef struct _waveVoice { 
-  // oscillator
-  osc osc;
   // filter
   filter_svf svf;
   // osc amp
   fract32 amp;
-  // osc output bus
-  fract32 oscOut;
   // filter output bus
   fract32 svfOut;
   // mixed output
@@ -68,15 +70,28 @@ typedef struct _waveVoice {
   filter_1p_lo cutSlew;
   // rq smoother
   filter_1p_lo rqSlew;
-  // PM input
-  fract32 pmIn;
-  // shape mod input
-  fract32 wmIn;
 } wavesVoice;
 
 
 wavesVoice voice[WAVES_NVOICES];
 
+// parameter slews of each voice, in the slew list
+enum { eSlewAmp, eSlewCut, eSlewRq };
+#define WAVES_VOICE_SLEWS 3
+#define WAVES_SLEW(i, s) ((i) * WAVES_VOICE_SLEWS + (s))
+#if WAVES_NVOICES * WAVES_VOICE_SLEWS > SLEW_LIST_MAX
+#error "waves: too many voice slews for the slew list"
+#endif
+
+// unsettled parameter slews
+static slewList slews;
+
+// oscillators
+oscBank bank;
+
+// osc output busses
+static fract32 oscOut[WAVES_NVOICES];
+
 //-------------------------
 //----- extern vars (initialized here)
 moduleData * gModuleData; // module data
@@ -95,6 +110,12 @@ static const fract32 wavtab[WAVE_TAB_NUM][WAVE_TAB_SIZE] = {
 #include "wavtab_data_inc.c" 
 };
 
+// band-limited levels of the same tables, in the other L1 data bank
+static const fract32 wavtabMip[WAVE_MIP_NUM][WAVE_TAB_NUM][WAVE_MIP_SIZE]
+__attribute__ ((l1_data_B)) = {
+#include "wavtab_mip_data_inc.c"
+};
+
 // static u32 sr;
 
 /* // oscillators */
@@ -137,16 +158,20 @@ static const fract32 wavtab[WAVE_TAB_NUM][WAVE_TAB_SIZE] = {
 /* static fract32 ioAmp3; */
 
 /// mixes
-// each input -> each output
-static fract32 mix_adc_dac[4][4] = { { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 },
-			      { 0, 0, 0, 0 } };
-
-
-// each osc -> each output
-static fract32 mix_osc_dac[2][4] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
-
+// each osc and input -> each output
+static mixMatrix mixDac;
+// input indices in the matrix
+#define WAVES_MIX_OSC(i) (i)
+#define WAVES_MIX_ADC(i) (WAVES_NVOICES + (i))
+// each output has its own sends
+#define WAVES_MIX_NOUT 4
+
+#if WAVES_NVOICES + 4 > MIX_MATRIX_MAX_IN
+#error "waves: too many mix inputs for MIX_MATRIX_MAX_IN"
+#endif
+#if WAVES_MIX_NOUT > MIX_MATRIX_MAX_OUT
+#error "waves: too many mix outputs for MIX_MATRIX_MAX_OUT"
+#endif
 
 /// FIXME
 // static fract32 frameVal;
@@ -161,93 +186,28 @@ static u8 cvChan = 0;
 // frame calculation
 static void calc_frame(void);
 
+// slew setters
+static void slew_set_amp(void* dst, fract32 val) {
+  *((fract32*)dst) = val;
+}
+
+static void slew_set_cut(void* dst, fract32 val) {
+  filter_svf_set_coeff( (filter_svf*)dst, val );
+}
+
+static void slew_set_rq(void* dst, fract32 val) {
+  filter_svf_set_rq( (filter_svf*)dst, val );
+}
+
 // initial param set
 static inline void param_setup(u32 id, ParamValue v) {
   gModuleData->paramData[id].value = v;
   module_set_param(id, v);
 }
 
+// zero sends are skipped, so outs 3+4 cost only the sends in use
 static void mix_outputs(void) {
-  fract32 mul;
-  //fract32 oscs;
-  
-  //-- out 0
-  out[0] = 0;
-  // osc
-  mul = mix_osc_dac[0][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(voice[0].out, mul)); 
-  mul = mix_osc_dac[1][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(voice[1].out, mul)); 
-  // adc
-  mul = mix_adc_dac[0][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[2], mul));
-  mul = mix_adc_dac[3][0];
-  out[0] = add_fr1x32(out[0], mult_fr1x32x32(in[3], mul));
-
-  //-- out 1
-  out[1] = 0;
-  // osc
-  mul = mix_osc_dac[0][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(voice[0].out, mul)); 
-  mul = mix_osc_dac[1][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(voice[1].out, mul)); 
-  // adc
-  mul = mix_adc_dac[0][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[2], mul));
-  mul = mix_adc_dac[3][1];
-  out[1] = add_fr1x32(out[1], mult_fr1x32x32(in[3], mul));
-
-
-  //////////////////
-  /// TEST: skip outs 3+4, see where we run out of CPU...
-  out[2] = out[0];
-  out[3] = out[1];
-  return;
-  /////////////
-  ////////////
-  
-  //-- out 2
-  out[2] = 0;
-  // osc
-  mul = mix_osc_dac[0][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(voice[0].out, mul)); 
-  mul = mix_osc_dac[1][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(voice[1].out, mul)); 
-  // adc
-  mul = mix_adc_dac[0][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][2];
-  out[2] = add_fr1x32(out[2], mult_fr1x32x32(in[3], mul)); 
-
-  //-- out 3
-  out[3] = 0;
-  // osc
-  mul = mix_osc_dac[0][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(voice[0].out, mul)); 
-  mul = mix_osc_dac[1][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(voice[1].out, mul)); 
-  // adc
-  mul = mix_adc_dac[0][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[0], mul)); 
-  mul = mix_adc_dac[1][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[1], mul)); 
-  mul = mix_adc_dac[2][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[2], mul)); 
-  mul = mix_adc_dac[3][3];
-  out[3] = add_fr1x32(out[3], mult_fr1x32x32(in[3], mul));
-
+  mix_matrix_next(&mixDac);
 }
 
 
@@ -257,40 +217,33 @@ static void calc_frame(void) {
   u8 i;
   wavesVoice* v;
 
+  // amp and filter integrators that are still moving
+  slew_list_next(&slews);
+
+  // oscillator bank includes hz and mod integrators
+  osc_bank_next(&bank, oscOut);
+
   for(i=0; i<WAVES_NVOICES; i++) {
     v = &(voice[i]);
-    // oscillator class includes hz and mod integrators
-    v->oscOut = shr_fr1x32( osc_next( &(v->osc) ), 2);
-    // phase mod with fixed 1-frame delay
-    osc_pm_in( &(v->osc), v->pmIn );
-    // shape mod with fixed 1-frame delay
-    osc_wm_in( &(v->osc), v->wmIn );
-    // process filter integrators and set 
-    filter_svf_set_coeff( &(v->svf), filter_1p_lo_next( &(v->cutSlew) ) );
-    filter_svf_set_rq( &(v->svf), filter_1p_lo_next( &(v->rqSlew) ) );
+    oscOut[i] = shr_fr1x32(oscOut[i], 2);
     // process filter
-    v->svfOut = filter_svf_next( &(v->svf), shr_fr1x32(v->oscOut, 1) );
-    // process amp smoother
-    v->amp  = filter_1p_lo_next( &(v->ampSlew) );
+    v->svfOut = filter_svf_next( &(v->svf), shr_fr1x32(oscOut[i], 1) );
     // mix to output bus
     v->out = mult_fr1x32x32(v->amp,
-			    add_fr1x32(mult_fr1x32x32( v->oscOut, v->fDry),
+			    add_fr1x32(mult_fr1x32x32( oscOut[i], v->fDry),
 				       mult_fr1x32x32( v->svfOut, v->fWet)
 				       )
 			    );
   } // end voice loop
 
-  /// FIXME: later, more voices, mod matrix, arbitrary mod delay.
-  /// for now, simple direct mod feedback routing and 1-frame delay.
-  voice[0].pmIn = voice[1].oscOut;
-  //  voice[0].wmIn = voice[1].oscOut << 1;
-  voice[1].pmIn = voice[0].oscOut;
-  //  voice[1].wmIn = voice[0].oscOut << 1;
+  /// FIXME: later, mod matrix, arbitrary mod delay.
+  /// for now, each pair of voices modulates each other with 1-frame delay.
+  for(i=0; i<WAVES_NVOICES; i++) {
+    bank.pmIn[i] = oscOut[i ^ 1];
+  }
   
   // mix outputs using matrix
-    mix_outputs();
-  
-  
+  mix_outputs();
 
 #else
   /* //  fract32 out1, out0; */
@@ -371,14 +324,30 @@ void module_init(void) {
   }
 
 
+  osc_bank_init( &bank, &wavtab, &wavtabMip, SAMPLERATE );
+  slew_list_init( &slews );
   for(i=0; i<WAVES_NVOICES; i++) {
-    fract32 tmp = FRACT32_MAX >> 2;
-    osc_init( &(voice[i].osc), &wavtab, SAMPLERATE );
     filter_svf_init( &(voice[i].svf) );
-    voice[i].amp = tmp;
     filter_1p_lo_init(&(voice[i].ampSlew), 0xf);
     filter_1p_lo_init(&(voice[i].cutSlew), 0xf);
     filter_1p_lo_init(&(voice[i].rqSlew), 0xf);
+    // registering sets amp and filter to the initial values,
+    // in the order of WAVES_SLEW
+    slew_list_add( &slews, &(voice[i].ampSlew), &slew_set_amp, &(voice[i].amp) );
+    slew_list_add( &slews, &(voice[i].cutSlew), &slew_set_cut, &(voice[i].svf) );
+    slew_list_add( &slews, &(voice[i].rqSlew), &slew_set_rq, &(voice[i].svf) );
+  }
+
+  // register mix signals in the order of WAVES_MIX_*
+  mix_matrix_init( &mixDac, WAVES_NVOICES + 4, WAVES_MIX_NOUT );
+  for(i=0; i<WAVES_NVOICES; i++) {
+    mix_matrix_set_src( &mixDac, WAVES_MIX_OSC(i), &(voice[i].out) );
+  }
+  for(i=0; i<4; i++) {
+    mix_matrix_set_src( &mixDac, WAVES_MIX_ADC(i), &(in[i]) );
+  }
+  for(i=0; i<WAVES_MIX_NOUT; i++) {
+    mix_matrix_set_dst( &mixDac, i, &(out[i]) );
   }
 
   //  oscAmp1 = oscAmp0 = INT32_MAX >> 2;
@@ -485,6 +454,30 @@ void module_init(void) {
   param_setup(  eParam_cvSlew2, 	PARAM_SLEW_DEFAULT );
   param_setup(  eParam_cvSlew3, 	PARAM_SLEW_DEFAULT );
 
+  // added voices are silent until their amp is raised
+  for(i=2; i<WAVES_NVOICES; i++) {
+    u32 id = eParamVoice2 + ((i - 2) * eVoiceNumParams);
+    param_setup( id + eVoiceHz,		220 << 16 );
+    param_setup( id + eVoiceTune,	FIX16_ONE );
+    param_setup( id + eVoiceWave,	0 );
+    param_setup( id + eVoiceAmp,	0 );
+    param_setup( id + eVoiceBl,		0 );
+    param_setup( id + eVoicePm,		0 );
+    param_setup( id + eVoiceWm,		0 );
+    param_setup( id + eVoiceCut,	PARAM_CUT_DEFAULT );
+    param_setup( id + eVoiceRq,		PARAM_RQ_DEFAULT );
+    param_setup( id + eVoiceLow,	PARAM_AMP_6 );
+    param_setup( id + eVoiceHigh,	0 );
+    param_setup( id + eVoiceBand,	0 );
+    param_setup( id + eVoiceNotch,	0 );
+    param_setup( id + eVoiceWet,	PARAM_AMP_6 );
+    param_setup( id + eVoiceDry,	PARAM_AMP_6 );
+    param_setup( id + eVoiceDac0,	FRACT32_MAX );
+    param_setup( id + eVoiceDac1,	FRACT32_MAX );
+    param_setup( id + eVoiceDac2,	FRACT32_MAX );
+    param_setup( id + eVoiceDac3,	FRACT32_MAX );
+  }
+
   
 
 }
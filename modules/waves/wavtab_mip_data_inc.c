@@ -0,0 +1,96 @@
+ // level 1 : harmonics up to 8
+ { 
+  // sine : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // odd : 
+  { 
+0x00000000, 0x0A161734, 0x141A1188, 0x1DFA0A71, 0x27A48D46, 0x3108CB3E, 0x3A16CF1D, 0x42BFADE5, 0x4AF5B3C7, 0x52AC8CCF, 0x59D968AF, 0x60731930, 0x66722AE1, 0x6BD0F7AF, 0x708BB333, 0x74A07086, 0x780F2193, 0x7AD98FF8, 0x7D034F93, 0x7E91AAF2, 0x7F8B8A05, 0x7FF95368, 0x7FE4C8D0, 0x7F58DF0D, 0x7E619260, 0x7D0BB7A8, 0x7B64CB37, 0x797ABDF4, 0x775BC199, 0x751614CC, 0x72B7CFCF, 0x704EB28D, 0x6DE7F4BC, 0x6B9018BE, 0x6952C1ED, 0x673A8EDC, 0x6550F825, 0x639E3424, 0x6229200B, 0x60F72E98, 0x600C5CA0, 0x5F6B2B86, 0x5F14A1B5, 0x5F0850FA, 0x5F4462A0, 0x5FC5A90D, 0x6087B68B, 0x6184F8DB, 0x62B6D90E, 0x6415DF27, 0x6599D8E0, 0x673A02F8, 0x68ED345C, 0x6AAA0A6A, 0x6C6715AD, 0x6E1B0645, 0x6FBCD748, 0x7143F879, 0x72A87594, 0x73E31A9F, 0x74ED94A1, 0x75C28E45, 0x765DC7EB, 0x76BC2AC2, 0x76DBD6B2, 0x76BC2AC2, 0x765DC7EB, 0x75C28E45, 0x74ED94A1, 0x73E31A9F, 0x72A87594, 0x7143F879, 0x6FBCD748, 0x6E1B0645, 0x6C6715AD, 0x6AAA0A6A, 0x68ED345C, 0x673A02F8, 0x6599D8E0, 0x6415DF27, 0x62B6D90E, 0x6184F8DB, 0x6087B68B, 0x5FC5A90D, 0x5F4462A0, 0x5F0850FA, 0x5F14A1B5, 0x5F6B2B86, 0x600C5CA0, 0x60F72E98, 0x6229200B, 0x639E3424, 0x6550F825, 0x673A8EDC, 0x6952C1ED, 0x6B9018BE, 0x6DE7F4BC, 0x704EB28D, 0x72B7CFCF, 0x751614CC, 0x775BC199, 0x797ABDF4, 0x7B64CB37, 0x7D0BB7A8, 0x7E619260, 0x7F58DF0D, 0x7FE4C8D0, 0x7FF95368, 0x7F8B8A05, 0x7E91AAF2, 0x7D034F93, 0x7AD98FF8, 0x780F2193, 0x74A07086, 0x708BB333, 0x6BD0F7AF, 0x66722AE1, 0x60731930, 0x59D968AF, 0x52AC8CCF, 0x4AF5B3C7, 0x42BFADE5, 0x3A16CF1D, 0x3108CB3E, 0x27A48D46, 0x1DFA0A71, 0x141A1188, 0x0A161734, 0x00000000, 0xF5E9E8CB, 0xEBE5EE77, 0xE205F58E, 0xD85B72B9, 0xCEF734C1, 0xC5E930E2, 0xBD40521A, 0xB50A4C38, 0xAD537330, 0xA6269750, 0x9F8CE6CF, 0x998DD51E, 0x942F0850, 0x8F744CCC, 0x8B5F8F79, 0x87F0DE6C, 0x85267007, 0x82FCB06C, 0x816E550D, 0x807475FA, 0x8006AC97, 0x801B372F, 0x80A720F2, 0x819E6D9F, 0x82F44857, 0x849B34C8, 0x8685420B, 0x88A43E66, 0x8AE9EB33, 0x8D483030, 0x8FB14D72, 0x92180B43, 0x946FE741, 0x96AD3E12, 0x98C57123, 0x9AAF07DA, 0x9C61CBDB, 0x9DD6DFF4, 0x9F08D167, 0x9FF3A35F, 0xA094D479, 0xA0EB5E4A, 0xA0F7AF05, 0xA0BB9D5F, 0xA03A56F2, 0x9F784974, 0x9E7B0724, 0x9D4926F1, 0x9BEA20D8, 0x9A66271F, 0x98C5FD07, 0x9712CBA3, 0x9555F595, 0x9398EA52, 0x91E4F9BA, 0x904328B7, 0x8EBC0786, 0x8D578A6B, 0x8C1CE560, 0x8B126B5E, 0x8A3D71BA, 0x89A23814, 0x8943D53D, 0x8924294D, 0x8943D53D, 0x89A23814, 0x8A3D71BA, 0x8B126B5E, 0x8C1CE560, 0x8D578A6B, 0x8EBC0786, 0x904328B7, 0x91E4F9BA, 0x9398EA52, 0x9555F595, 0x9712CBA3, 0x98C5FD07, 0x9A66271F, 0x9BEA20D8, 0x9D4926F1, 0x9E7B0724, 0x9F784974, 0xA03A56F2, 0xA0BB9D5F, 0xA0F7AF05, 0xA0EB5E4A, 0xA094D479, 0x9FF3A35F, 0x9F08D167, 0x9DD6DFF4, 0x9C61CBDB, 0x9AAF07DA, 0x98C57123, 0x96AD3E12, 0x946FE741, 0x92180B43, 0x8FB14D72, 0x8D483030, 0x8AE9EB33, 0x88A43E66, 0x8685420B, 0x849B34C8, 0x82F44857, 0x819E6D9F, 0x80A720F2, 0x801B372F, 0x8006AC97, 0x807475FA, 0x816E550D, 0x82FCB06C, 0x85267007, 0x87F0DE6C, 0x8B5F8F79, 0x8F744CCC, 0x942F0850, 0x998DD51E, 0x9F8CE6CF, 0xA6269750, 0xAD537330, 0xB50A4C38, 0xBD40521A, 0xC5E930E2, 0xCEF734C1, 0xD85B72B9, 0xE205F58E, 0xEBE5EE77, 0xF5E9E8CB, 
+  } , 
+  // even : 
+  { 
+0x00000000, 0x0ABFD5B3, 0x15681C8F, 0x1FE1A982, 0x2A161710, 0x33F0234E, 0x3D5C0833, 0x4647CC85, 0x4EA38BE2, 0x5661B46D, 0x5D77391A, 0x63DBB789, 0x698990DD, 0x6E7DF51E, 0x72B8E10A, 0x763D0E76, 0x790FD7B0, 0x7B390E8B, 0x7CC2C810, 0x7DB91DEA, 0x7E29E6F8, 0x7E246888, 0x7DB901E6, 0x7CF8D405, 0x7BF5671D, 0x7AC05010, 0x796AD787, 0x7805A47C, 0x76A06BF3, 0x7549A77E, 0x740E53E9, 0x72F9B961, 0x72153E07, 0x716843CF, 0x70F81229, 0x70C7CBC3, 0x70D8706D, 0x7128EAE0, 0x71B629E5, 0x727B4431, 0x7371A5EA, 0x749146C1, 0x75D0E741, 0x772653DA, 0x7886AC0F, 0x79E6AC22, 0x7B3AF786, 0x7C786261, 0x7D943876, 0x7E847FDC, 0x7F403608, 0x7FBF85D6, 0x7FFBF555, 0x7FF08A71, 0x7F99E5A8, 0x7EF6524B, 0x7E05CC01, 0x7CC9F97C, 0x7B461CA8, 0x797EF8AF, 0x777AAEA2, 0x7540918F, 0x72D8F336, 0x704CEA95, 0x6DA615B9, 0x6AEE5851, 0x682F98AB, 0x65737CA5, 0x62C32843, 0x6026FF82, 0x5DA66CDA, 0x5B47ADF3, 0x590FA7BA, 0x5701C2FE, 0x551FD273, 0x536A02D7, 0x51DED5A2, 0x507B2680, 0x4F3A3B87, 0x4E15DFE6, 0x4D06887F, 0x4C0381AC, 0x4B03253B, 0x49FB1769, 0x48E0898F, 0x47A880F8, 0x4648205A, 0x44B4F236, 0x42E53271, 0x40D01572, 0x3E6E0B20, 0x3BB8FC18, 0x38AC7FB5, 0x35460985, 0x31850D0C, 0x2D6B16D9, 0x28FBDA36, 0x243D32F5, 0x1F371B1D, 0x19F3947A, 0x147E8663, 0x0EE59039, 0x0937D171, 0x0385A826, 0xFDE06785, 0xF85A0769, 0xF304CED1, 0xEDF2FAD6, 0xE93663FD, 0xE4E023B5, 0xE1003BE7, 0xDDA54262, 0xDADC11FF, 0xD8AF830D, 0xD7282CAA, 0xD64C304B, 0xD61F10AF, 0xD6A19520, 0xD7D1B9B8, 0xD9AAAD0E, 0xDC24DB7C, 0xDF3607D0, 0xE2D17113, 0xE6E804A6, 0xEB689BDA, 0xF04043D2, 0xF55A8E55, 0xFAA1E9F9, 0xFFFFFFFF, 0x055E1606, 0x0AA571AA, 0x0FBFBC2D, 0x14976425, 0x1917FB59, 0x1D2E8EEC, 0x20C9F82F, 0x23DB2483, 0x265552F1, 0x282E4647, 0x295E6ADF, 0x29E0EF50, 0x29B3CFB4, 0x28D7D355, 0x27507CF2, 0x2523EE00, 0x225ABD9D, 0x1EFFC418, 0x1B1FDC4A, 0x16C99C02, 0x120D0529, 0x0CFB312E, 0x07A5F896, 0x021F987A, 0xFC7A57D9, 0xF6C82E8E, 0xF11A6FC6, 0xEB81799C, 0xE60C6B85, 0xE0C8E4E2, 0xDBC2CD0A, 0xD70425C9, 0xD294E926, 0xCE7AF2F3, 0xCAB9F67A, 0xC753804A, 0xC44703E7, 0xC191F4DF, 0xBF2FEA8D, 0xBD1ACD8E, 0xBB4B0DC9, 0xB9B7DFA5, 0xB8577F07, 0xB71F7670, 0xB604E896, 0xB4FCDAC4, 0xB3FC7E53, 0xB2F97780, 0xB1EA2019, 0xB0C5C478, 0xAF84D97F, 0xAE212A5D, 0xAC95FD28, 0xAAE02D8C, 0xA8FE3D01, 0xA6F05845, 0xA4B8520C, 0xA2599325, 0x9FD9007D, 0x9D3CD7BC, 0x9A8C835A, 0x97D06754, 0x9511A7AE, 0x9259EA46, 0x8FB3156A, 0x8D270CC9, 0x8ABF6E70, 0x8885515D, 0x86810750, 0x84B9E357, 0x83360683, 0x81FA33FE, 0x8109ADB4, 0x80661A57, 0x800F758E, 0x80040AAA, 0x80407A29, 0x80BFC9F7, 0x817B8023, 0x826BC789, 0x83879D9E, 0x84C50879, 0x861953DD, 0x877953F0, 0x88D9AC25, 0x8A2F18BE, 0x8B6EB93E, 0x8C8E5A15, 0x8D84BBCE, 0x8E49D61A, 0x8ED7151F, 0x8F278F92, 0x8F38343C, 0x8F07EDD6, 0x8E97BC30, 0x8DEAC1F8, 0x8D06469E, 0x8BF1AC16, 0x8AB65881, 0x895F940C, 0x87FA5B83, 0x86952878, 0x853FAFEF, 0x840A98E2, 0x83072BFA, 0x8246FE19, 0x81DB9777, 0x81D61907, 0x8246E215, 0x833D37EF, 0x84C6F174, 0x86F0284F, 0x89C2F189, 0x8D471EF5, 0x91820AE1, 0x96766F22, 0x9C244876, 0xA288C6E5, 0xA99E4B92, 0xB15C741D, 0xB9B8337A, 0xC2A3F7CC, 0xCC0FDCB1, 0xD5E9E8EF, 0xE01E567D, 0xEA97E370, 0xF5402A4C, 
+  } , 
+  // even + odd, order 7 : 
+  { 
+0x00000000, 0x0D4A09B5, 0x1A6B3658, 0x273B7AB4, 0x33946A53, 0x3F51FA89, 0x4A533712, 0x547AE3FA, 0x5DB00928, 0x65DE6440, 0x6CF6BE69, 0x72EF2428, 0x77C2FE30, 0x7B730AF9, 0x7E053993, 0x7F8466FB, 0x7FFFFFFE, 0x7F8B8A4B, 0x7E3E17FE, 0x7C31A966, 0x79828139, 0x764E6F9C, 0x72B418B0, 0x6ED23B47, 0x6AC6FC59, 0x66AF3BA3, 0x62A5F581, 0x5EC3B5B7, 0x5B1E1E47, 0x57C784FA, 0x54CEA983, 0x523E857D, 0x501E36D9, 0x4E710494, 0x4D367CD0, 0x4C6AAAD5, 0x4C0662E4, 0x4BFFA11C, 0x4C49F86F, 0x4CD70E19, 0x4D971DE8, 0x4E798361, 0x4F6D43EA, 0x50619609, 0x51466204, 0x520CB887, 0x52A73C35, 0x530A7B85, 0x532D38D9, 0x53089F3E, 0x529862DB, 0x51DACCBC, 0x50D0B237, 0x4F7D58BE, 0x4DE64787, 0x4C1308E4, 0x4A0CDDA5, 0x47DE6528, 0x45933D11, 0x43379BC7, 0x40D7E8EC, 0x3E805701, 0x3C3C815F, 0x3A17114C, 0x38196CF3, 0x364B725D, 0x34B3406A, 0x33550F15, 0x323317FB, 0x314D8F81, 0x30A2AE79, 0x302ECBAA, 0x2FEC8416, 0x2FD4F07F, 0x2FDFE637, 0x300440F9, 0x30383363, 0x30719B56, 0x30A6578C, 0x30CC9BB6, 0x30DB4068, 0x30CA0C7D, 0x3091F598, 0x302D55FC, 0x2F981613, 0x2ECFC88D, 0x2DD3B867, 0x2CA4E884, 0x2B46052E, 0x29BB4800, 0x280A4F66, 0x2639EB16, 0x2451DF50, 0x225AA0EE, 0x205D0C80, 0x1E621AEB, 0x1C7295DE, 0x1A96CEA3, 0x18D65993, 0x1737D056, 0x15C09CD9, 0x1474CEA4, 0x1356FBC4, 0x12682E48, 0x11A7DEBE, 0x1113FBCC, 0x10A8FE8C, 0x10620AE7, 0x10391AD5, 0x1027330D, 0x10249F56, 0x10293489, 0x102C9615, 0x10267CB9, 0x100EFC39, 0x0FDEC5C5, 0x0F8F64E9, 0x0F1B752A, 0x0E7ECE79, 0x0DB6A73C, 0x0CC1AAB7, 0x0BA0033A, 0x0A5357C5, 0x08DEBD36, 0x07469B89, 0x0590880B, 0x03C315C3, 0x01E59D95, 0x00000000, 0xFE1A626A, 0xFC3CEA3C, 0xFA6F77F4, 0xF8B96476, 0xF72142C9, 0xF5ACA83A, 0xF45FFCC5, 0xF33E5548, 0xF24958C3, 0xF1813186, 0xF0E48AD5, 0xF0709B16, 0xF0213A3A, 0xEFF103C6, 0xEFD98346, 0xEFD369EA, 0xEFD6CB76, 0xEFDB60A9, 0xEFD8CCF2, 0xEFC6E52A, 0xEF9DF518, 0xEF570173, 0xEEEC0433, 0xEE582141, 0xED97D1B7, 0xECA9043B, 0xEB8B315B, 0xEA3F6326, 0xE8C82FA9, 0xE729A66C, 0xE569315C, 0xE38D6A21, 0xE19DE514, 0xDFA2F37F, 0xDDA55F11, 0xDBAE20AF, 0xD9C614E9, 0xD7F5B099, 0xD644B7FF, 0xD4B9FAD1, 0xD35B177B, 0xD22C4798, 0xD1303772, 0xD067E9EC, 0xCFD2AA03, 0xCF6E0A67, 0xCF35F382, 0xCF24BF97, 0xCF336449, 0xCF59A873, 0xCF8E64A9, 0xCFC7CC9C, 0xCFFBBF06, 0xD02019C8, 0xD02B0F80, 0xD0137BE9, 0xCFD13455, 0xCF5D5186, 0xCEB2707E, 0xCDCCE804, 0xCCAAF0EA, 0xCB4CBF95, 0xC9B48DA2, 0xC7E6930C, 0xC5E8EEB3, 0xC3C37EA0, 0xC17FA8FE, 0xBF281713, 0xBCC86438, 0xBA6CC2EE, 0xB8219AD7, 0xB5F3225A, 0xB3ECF71B, 0xB219B878, 0xB082A741, 0xAF2F4DC8, 0xAE253343, 0xAD679D24, 0xACF760C1, 0xACD2C726, 0xACF5847A, 0xAD58C3CA, 0xADF34778, 0xAEB99DFB, 0xAF9E69F6, 0xB092BC15, 0xB1867C9E, 0xB268E217, 0xB328F1E6, 0xB3B60790, 0xB4005EE3, 0xB3F99D1B, 0xB395552A, 0xB2C9832F, 0xB18EFB6B, 0xAFE1C926, 0xADC17A82, 0xAB31567C, 0xA8387B05, 0xA4E1E1B8, 0xA13C4A48, 0x9D5A0A7E, 0x9950C45C, 0x953903A6, 0x912DC4B8, 0x8D4BE74F, 0x89B19063, 0x867D7EC6, 0x83CE5699, 0x81C1E801, 0x807475B4, 0x80000001, 0x807B9904, 0x81FAC66C, 0x848CF506, 0x883D01CF, 0x8D10DBD7, 0x93094196, 0x9A219BBF, 0xA24FF6D7, 0xAB851C05, 0xB5ACC8ED, 0xC0AE0576, 0xCC6B95AC, 0xD8C4854B, 0xE594C9A7, 0xF2B5F64A, 
+  } , 
+  // even + odd, order 11 : 
+  { 
+0x00000000, 0x0E95065C, 0x1CF0EE47, 0x2ADC12A9, 0x3821B58F, 0x44915745, 0x4FFFEC58, 0x5A48E92E, 0x634F1B44, 0x6AFD49E3, 0x714699D1, 0x7626B1A7, 0x79A19E6C, 0x7BC37A29, 0x7C9FD82D, 0x7C50FC84, 0x7AF6E5CF, 0x78B63209, 0x75B6E7DD, 0x72232EED, 0x6E2601C4, 0x69E9E44C, 0x6597A91C, 0x61554F7A, 0x5D4502A5, 0x598441F3, 0x562B3795, 0x534C423C, 0x50F3B3F6, 0x4F27C6D7, 0x4DE8C603, 0x4D316819, 0x4CF75631, 0x4D2BD95C, 0x4DBCA74F, 0x4E94C5FC, 0x4F9D7D66, 0x50BF4E87, 0x51E2E667, 0x52F204BD, 0x53D84E40, 0x548403AD, 0x54E697D0, 0x54F5201B, 0x54A89CFC, 0x53FE1899, 0x52F69C30, 0x5196FDEC, 0x4FE78A6F, 0x4DF38E7A, 0x4BC8C663, 0x4976B9A6, 0x470E09AC, 0x449FBAF7, 0x423C8020, 0x3FF40D9D, 0x3DD47CEC, 0x3BE9C4D6, 0x3A3D4B9D, 0x38D596CC, 0x37B61B00, 0x36DF2CD7, 0x364E12BE, 0x35FD362A, 0x35E4716E, 0x35F97670, 0x36304983, 0x367BCAF8, 0x36CE498F, 0x371A1798, 0x37521CC1, 0x376A5E97, 0x37587A80, 0x37140C60, 0x3696FE2B, 0x35DDBD8C, 0x34E755F0, 0x33B56E54, 0x324C2B7A, 0x30B1F836, 0x2EEF367B, 0x2D0DDCDC, 0x2B1904CE, 0x291C6EA0, 0x27240068, 0x253B454C, 0x236CF274, 0x21C276AD, 0x20439931, 0x1EF62B74, 0x1DDDD0E6, 0x1CFBDEC6, 0x1C4F5508, 0x1BD4F049, 0x1B8753DA, 0x1B5F49CD, 0x1B541623, 0x1B5BD979, 0x1B6BFEEB, 0x1B79B07B, 0x1B7A4D1B, 0x1B63DB68, 0x1B2D7457, 0x1ACFA169, 0x1A44AAA3, 0x1988D118, 0x189A73CC, 0x177A1D77, 0x162A7AD3, 0x14B039F4, 0x1311D43B, 0x1157453C, 0x0F89B1C7, 0x0DB302E3, 0x0BDD7909, 0x0A133C2D, 0x085DED54, 0x06C63E54, 0x0553940B, 0x040BB706, 0x02F295CF, 0x020A1B71, 0x01521BE3, 0x00C8571C, 0x006892A2, 0x002CC878, 0x000D696D, 0x0001AFF1, 0x00000000, 0xFFFE500E, 0xFFF29692, 0xFFD33787, 0xFF976D5D, 0xFF37A8E3, 0xFEADE41C, 0xFDF5E48E, 0xFD0D6A30, 0xFBF448F9, 0xFAAC6BF4, 0xF939C1AB, 0xF7A212AB, 0xF5ECC3D2, 0xF42286F6, 0xF24CFD1C, 0xF0764E38, 0xEEA8BAC3, 0xECEE2BC4, 0xEB4FC60B, 0xE9D5852C, 0xE885E288, 0xE7658C33, 0xE6772EE7, 0xE5BB555C, 0xE5305E96, 0xE4D28BA8, 0xE49C2497, 0xE485B2E4, 0xE4864F84, 0xE4940114, 0xE4A42686, 0xE4ABE9DC, 0xE4A0B632, 0xE478AC25, 0xE42B0FB6, 0xE3B0AAF7, 0xE3042139, 0xE2222F19, 0xE109D48B, 0xDFBC66CE, 0xDE3D8952, 0xDC930D8B, 0xDAC4BAB3, 0xD8DBFF97, 0xD6E3915F, 0xD4E6FB31, 0xD2F22323, 0xD110C984, 0xCF4E07C9, 0xCDB3D485, 0xCC4A91AB, 0xCB18AA0F, 0xCA224273, 0xC96901D4, 0xC8EBF39F, 0xC8A7857F, 0xC895A168, 0xC8ADE33E, 0xC8E5E867, 0xC931B670, 0xC9843507, 0xC9CFB67C, 0xCA06898F, 0xCA1B8E91, 0xCA02C9D5, 0xC9B1ED41, 0xC920D328, 0xC849E4FF, 0xC72A6933, 0xC5C2B462, 0xC4163B29, 0xC22B8313, 0xC00BF262, 0xBDC37FDF, 0xBB604508, 0xB8F1F653, 0xB6894659, 0xB437399C, 0xB20C7185, 0xB0187590, 0xAE690213, 0xAD0963CF, 0xAC01E766, 0xAB576303, 0xAB0ADFE4, 0xAB19682F, 0xAB7BFC52, 0xAC27B1BF, 0xAD0DFB42, 0xAE1D1998, 0xAF40B178, 0xB0628299, 0xB16B3A03, 0xB24358B0, 0xB2D426A3, 0xB308A9CE, 0xB2CE97E6, 0xB21739FC, 0xB0D83928, 0xAF0C4C09, 0xACB3BDC3, 0xA9D4C86A, 0xA67BBE0C, 0xA2BAFD5A, 0x9EAAB085, 0x9A6856E3, 0x96161BB3, 0x91D9FE3B, 0x8DDCD112, 0x8A491822, 0x8749CDF6, 0x85091A30, 0x83AF037B, 0x836027D2, 0x843C85D6, 0x865E6193, 0x89D94E58, 0x8EB9662E, 0x9502B61C, 0x9CB0E4BB, 0xA5B716D1, 0xB00013A7, 0xBB6EA8BA, 0xC7DE4A70, 0xD523ED56, 0xE30F11B8, 0xF16AF9A3, 
+  } , 
+ } , 
+
+ // level 2 : harmonics up to 4
+ { 
+  // sine : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // odd : 
+  { 
+0x00000000, 0x06A935F8, 0x0D4D4A14, 0x13E720F4, 0x1A71AC27, 0x20E7F090, 0x27450CAB, 0x2D843EAF, 0x33A0EA8E, 0x39969FB1, 0x3F611E87, 0x44FC5DCB, 0x4A648F7B, 0x4F962588, 0x548DD627, 0x59489FC4, 0x5DC3CC95, 0x61FCF5C7, 0x65F2063B, 0x69A13CD3, 0x6D092E4D, 0x7028C6AE, 0x72FF4A2C, 0x758C55A7, 0x77CFDEA4, 0x79CA32D5, 0x7B7BF722, 0x7CE62640, 0x7E0A0ED2, 0x7EE95115, 0x7F85DC26, 0x7FE1EAD0, 0x7FFFFFFE, 0x7FE2E2CA, 0x7F8D9A2A, 0x7F03684E, 0x7E47C5B0, 0x7D5E5BD0, 0x7C4AFFBE, 0x7B11AC60, 0x79B67C8B, 0x783DA4F4, 0x76AB6DFC, 0x75042D66, 0x734C4003, 0x7188034E, 0x6FBBCF12, 0x6DEBEF18, 0x6C1C9CEA, 0x6A51F9B6, 0x6890084D, 0x66DAA75F, 0x65358BDB, 0x63A43B9D, 0x622A0857, 0x60CA0AC8, 0x5F871E48, 0x5E63DCAD, 0x5D629A8D, 0x5C8563E4, 0x5BCDF922, 0x5B3DCCAA, 0x5AD600BF, 0x5A9765DE, 0x5A827999, 0x5A9765DE, 0x5AD600BF, 0x5B3DCCAA, 0x5BCDF922, 0x5C8563E4, 0x5D629A8D, 0x5E63DCAD, 0x5F871E48, 0x60CA0AC8, 0x622A0857, 0x63A43B9D, 0x65358BDB, 0x66DAA75F, 0x6890084D, 0x6A51F9B6, 0x6C1C9CEA, 0x6DEBEF18, 0x6FBBCF12, 0x7188034E, 0x734C4003, 0x75042D66, 0x76AB6DFC, 0x783DA4F4, 0x79B67C8B, 0x7B11AC60, 0x7C4AFFBE, 0x7D5E5BD0, 0x7E47C5B0, 0x7F03684E, 0x7F8D9A2A, 0x7FE2E2CA, 0x7FFFFFFE, 0x7FE1EAD0, 0x7F85DC26, 0x7EE95115, 0x7E0A0ED2, 0x7CE62640, 0x7B7BF722, 0x79CA32D5, 0x77CFDEA4, 0x758C55A7, 0x72FF4A2C, 0x7028C6AE, 0x6D092E4D, 0x69A13CD3, 0x65F2063B, 0x61FCF5C7, 0x5DC3CC95, 0x59489FC4, 0x548DD627, 0x4F962588, 0x4A648F7B, 0x44FC5DCB, 0x3F611E87, 0x39969FB1, 0x33A0EA8E, 0x2D843EAF, 0x27450CAB, 0x20E7F090, 0x1A71AC27, 0x13E720F4, 0x0D4D4A14, 0x06A935F8, 0x00000000, 0xF956CA07, 0xF2B2B5EB, 0xEC18DF0B, 0xE58E53D8, 0xDF180F6F, 0xD8BAF354, 0xD27BC150, 0xCC5F1571, 0xC669604E, 0xC09EE178, 0xBB03A234, 0xB59B7084, 0xB069DA77, 0xAB7229D8, 0xA6B7603B, 0xA23C336A, 0x9E030A38, 0x9A0DF9C4, 0x965EC32C, 0x92F6D1B2, 0x8FD73951, 0x8D00B5D3, 0x8A73AA58, 0x8830215B, 0x8635CD2A, 0x848408DD, 0x8319D9BF, 0x81F5F12D, 0x8116AEEA, 0x807A23D9, 0x801E152F, 0x80000001, 0x801D1D35, 0x807265D5, 0x80FC97B1, 0x81B83A4F, 0x82A1A42F, 0x83B50041, 0x84EE539F, 0x86498374, 0x87C25B0B, 0x89549203, 0x8AFBD299, 0x8CB3BFFC, 0x8E77FCB1, 0x904430ED, 0x921410E7, 0x93E36315, 0x95AE0649, 0x976FF7B2, 0x992558A0, 0x9ACA7424, 0x9C5BC462, 0x9DD5F7A8, 0x9F35F537, 0xA078E1B7, 0xA19C2352, 0xA29D6572, 0xA37A9C1B, 0xA43206DD, 0xA4C23355, 0xA529FF40, 0xA5689A21, 0xA57D8666, 0xA5689A21, 0xA529FF40, 0xA4C23355, 0xA43206DD, 0xA37A9C1B, 0xA29D6572, 0xA19C2352, 0xA078E1B7, 0x9F35F537, 0x9DD5F7A8, 0x9C5BC462, 0x9ACA7424, 0x992558A0, 0x976FF7B2, 0x95AE0649, 0x93E36315, 0x921410E7, 0x904430ED, 0x8E77FCB1, 0x8CB3BFFC, 0x8AFBD299, 0x89549203, 0x87C25B0B, 0x86498374, 0x84EE539F, 0x83B50041, 0x82A1A42F, 0x81B83A4F, 0x80FC97B1, 0x807265D5, 0x801D1D35, 0x80000001, 0x801E152F, 0x807A23D9, 0x8116AEEA, 0x81F5F12D, 0x8319D9BF, 0x848408DD, 0x8635CD2A, 0x8830215B, 0x8A73AA58, 0x8D00B5D3, 0x8FD73951, 0x92F6D1B2, 0x965EC32C, 0x9A0DF9C4, 0x9E030A38, 0xA23C336A, 0xA6B7603B, 0xAB7229D8, 0xB069DA77, 0xB59B7084, 0xBB03A234, 0xC09EE178, 0xC669604E, 0xCC5F1571, 0xD27BC150, 0xD8BAF354, 0xDF180F6F, 0xE58E53D8, 0xEC18DF0B, 0xF2B2B5EB, 0xF956CA07, 
+  } , 
+  // even : 
+  { 
+0x00000000, 0x07B78781, 0x0F66BD21, 0x17055FA4, 0x1E8B4EFD, 0x25F09C7E, 0x2D2D9A96, 0x343AEC00, 0x3B119226, 0x41AAFAB3, 0x48010C22, 0x4E0E3133, 0x53CD632A, 0x593A32C6, 0x5E50CFD0, 0x630E0F3D, 0x676F6FD0, 0x6B731D30, 0x6F17F175, 0x725D7518, 0x7543DD5E, 0x77CC0934, 0x79F77C85, 0x7BC85A20, 0x7D415C38, 0x7E65CB8E, 0x7F397564, 0x7FC0A04E, 0x7FFFFFFE, 0x7FFCA829, 0x7FBBFEA3, 0x7F43ACE2, 0x7E9990F7, 0x7DC3AE3A, 0x7CC81DB5, 0x7BACFE8F, 0x7A786689, 0x793052BF, 0x77DA98CE, 0x767CD882, 0x751C6E35, 0x73BE65F6, 0x72676FA3, 0x711BD40C, 0x6FDF6B39, 0x6EB593EA, 0x6DA12C6C, 0x6CA48CC9, 0x6BC18266, 0x6AF94D1E, 0x6A4C9DD7, 0x69BB9693, 0x6945CC04, 0x68EA489E, 0x68A7910C, 0x687BAA14, 0x68641FCC, 0x685E0E0F, 0x68662A19, 0x6878CD39, 0x68920076, 0x68AD8908, 0x68C6F589, 0x68D9ABBC, 0x68E0F6BC, 0x68D8157E, 0x68BA4977, 0x6882E53E, 0x682D5B09, 0x67B54AE5, 0x6716906E, 0x664D5006, 0x65560345, 0x642D849A, 0x62D119F7, 0x613E7E66, 0x5F73EA7A, 0x5D701B7A, 0x5B325936, 0x58BA7A81, 0x5608E82A, 0x531E9E8D, 0x4FFD2D97, 0x4CA6B750, 0x491DECE5, 0x45660A3A, 0x4182D00F, 0x3D787CC0, 0x394BC3BA, 0x3501C3AE, 0x309FFBA5, 0x2C2C3F05, 0x27ACA8AA, 0x23278D2C, 0x1EA36C80, 0x1A26E308, 0x15B89A3B, 0x115F3912, 0x0D215458, 0x09055F04, 0x05119ACB, 0x014C0904, 0xFDBA5C0D, 0xFA61E954, 0xF7479C23, 0xF46FE951, 0xF1DEC3FA, 0xEF979353, 0xED9D29C2, 0xEBF1BD3E, 0xEA96E117, 0xE98D8135, 0xE8D5DED8, 0xE86F8EDF, 0xE85979A6, 0xE891DC6D, 0xE9164C58, 0xE9E3BAEB, 0xEAF67C15, 0xEC4A4DA0, 0xEDDA6005, 0xEFA16092, 0xF19984BE, 0xF3BC9699, 0xF604023D, 0xF868E419, 0xFAE417F8, 0xFD6E48A6, 0xFFFFFFFF, 0x0291B759, 0x051BE807, 0x07971BE6, 0x09FBFDC2, 0x0C436966, 0x0E667B41, 0x105E9F6D, 0x12259FFA, 0x13B5B25F, 0x150983EA, 0x161C4514, 0x16E9B3A7, 0x176E2392, 0x17A68659, 0x17907120, 0x172A2127, 0x16727ECA, 0x15691EE8, 0x140E42C1, 0x1262D63D, 0x10686CAC, 0x0E213C05, 0x0B9016AE, 0x08B863DC, 0x059E16AB, 0x0245A3F2, 0xFEB3F6FB, 0xFAEE6534, 0xF6FAA0FB, 0xF2DEABA7, 0xEEA0C6ED, 0xEA4765C4, 0xE5D91CF7, 0xE15C937F, 0xDCD872D3, 0xD8535755, 0xD3D3C0FA, 0xCF60045A, 0xCAFE3C51, 0xC6B43C45, 0xC287833F, 0xBE7D2FF0, 0xBA99F5C5, 0xB6E2131A, 0xB35948AF, 0xB002D268, 0xACE16172, 0xA9F717D5, 0xA745857E, 0xA4CDA6C9, 0xA28FE485, 0xA08C1585, 0x9EC18199, 0x9D2EE608, 0x9BD27B65, 0x9AA9FCBA, 0x99B2AFF9, 0x98E96F91, 0x984AB51A, 0x97D2A4F6, 0x977D1AC1, 0x9745B688, 0x9727EA81, 0x971F0943, 0x97265443, 0x97390A76, 0x975276F7, 0x976DFF89, 0x978732C6, 0x9799D5E6, 0x97A1F1F0, 0x979BE033, 0x978455EB, 0x97586EF3, 0x9715B761, 0x96BA33FB, 0x9644696C, 0x95B36228, 0x9506B2E1, 0x943E7D99, 0x935B7336, 0x925ED393, 0x914A6C15, 0x902094C6, 0x8EE42BF3, 0x8D98905C, 0x8C419A09, 0x8AE391CA, 0x8983277D, 0x88256731, 0x86CFAD40, 0x85879976, 0x84530170, 0x8337E24A, 0x823C51C5, 0x81666F08, 0x80BC531D, 0x8044015C, 0x800357D6, 0x80000001, 0x803F5FB1, 0x80C68A9B, 0x819A3471, 0x82BEA3C7, 0x8437A5DF, 0x8608837A, 0x8833F6CB, 0x8ABC22A1, 0x8DA28AE7, 0x90E80E8A, 0x948CE2CF, 0x9890902F, 0x9CF1F0C2, 0xA1AF302F, 0xA6C5CD39, 0xAC329CD5, 0xB1F1CECC, 0xB7FEF3DD, 0xBE55054C, 0xC4EE6DD9, 0xCBC513FF, 0xD2D26569, 0xDA0F6381, 0xE174B102, 0xE8FAA05B, 0xF09942DE, 0xF848787E, 
+  } , 
+  // even + odd, order 7 : 
+  { 
+0x00000000, 0x079A767F, 0x0F2C2408, 0x16AC4F9C, 0x1E12600C, 0x2555EB89, 0x2C6EC6D6, 0x335513EC, 0x3A015002, 0x406C60D2, 0x468FA0FA, 0x4C64EB73, 0x51E6A5E8, 0x570FC9FB, 0x5BDBED42, 0x6047480E, 0x644EBACF, 0x67EFD224, 0x6B28C985, 0x6DF88C7F, 0x705EB68C, 0x725B9183, 0x73F012A6, 0x751DD656, 0x75E71A7E, 0x764EB7BE, 0x76581961, 0x7607344B, 0x75607CD0, 0x7468DBAD, 0x7325A22A, 0x719C7D8D, 0x6FD369E9, 0x6DD0A485, 0x6B9A9DD9, 0x6937EB5C, 0x66AF3931, 0x64073BDF, 0x6146A22C, 0x5E740740, 0x5B95E52B, 0x58B287EA, 0x55D0010D, 0x52F41C0F, 0x50245386, 0x4D65C72F, 0x4ABD32F7, 0x482EE717, 0x45BEC13C, 0x437026E3, 0x414600D8, 0x3F42B7F7, 0x3D683320, 0x3BB7D663, 0x3A32836A, 0x38D89B13, 0x37AA0034, 0x36A61B7F, 0x35CBE077, 0x3519D372, 0x348E107A, 0x3426531B, 0x33DFFEF1, 0x33B828E4, 0x33ABA0FB, 0x33B6FCAD, 0x33D6A191, 0x3406D050, 0x3443AFC5, 0x34895824, 0x34D3DE14, 0x351F5D9C, 0x356804CB, 0x35AA1DFF, 0x35E219AD, 0x360C97A6, 0x36266FA5, 0x362CB92E, 0x361CD29B, 0x35F46755, 0x35B17517, 0x3552504A, 0x34D5A75E, 0x343A8524, 0x33805220, 0x32A6D4D8, 0x31AE3123, 0x3096E672, 0x2F61CD29, 0x2E101309, 0x2CA336B8, 0x2B1D0276, 0x297F8613, 0x27CD1032, 0x260826F0, 0x24338003, 0x2251F870, 0x20668BDA, 0x1E744BA0, 0x1C7E55C6, 0x1A87CBD8, 0x1893C9D5, 0x16A55D39, 0x14BF7C45, 0x12E4FD9B, 0x11189040, 0x0F5CB41D, 0x0DB3B313, 0x0C1F9AB3, 0x0AA236A7, 0x093D0BE2, 0x07F1549D, 0x06BFFD31, 0x05A9A1C6, 0x04AE8CFB, 0x03CEB763, 0x0309C7FB, 0x025F157D, 0x01CDA89E, 0x01543F1E, 0x00F14FB7, 0x00A30EC8, 0x006773BF, 0x003C3F2F, 0x001F017E, 0x000D2214, 0x0003E707, 0x00007D17, 0xFFFFFFFF, 0xFFFF82E8, 0xFFFC18F8, 0xFFF2DDEB, 0xFFE0FE81, 0xFFC3C0D0, 0xFF988C40, 0xFF5CF137, 0xFF0EB048, 0xFEABC0E1, 0xFE325761, 0xFDA0EA82, 0xFCF63804, 0xFC31489C, 0xFB517304, 0xFA565E39, 0xF94002CE, 0xF80EAB62, 0xF6C2F41D, 0xF55DC958, 0xF3E0654C, 0xF24C4CEC, 0xF0A34BE2, 0xEEE76FBF, 0xED1B0264, 0xEB4083BA, 0xE95AA2C6, 0xE76C362A, 0xE5783427, 0xE381AA39, 0xE18BB45F, 0xDF997425, 0xDDAE078F, 0xDBCC7FFC, 0xD9F7D90F, 0xD832EFCD, 0xD68079EC, 0xD4E2FD89, 0xD35CC947, 0xD1EFECF6, 0xD09E32D6, 0xCF69198D, 0xCE51CEDC, 0xCD592B27, 0xCC7FADDF, 0xCBC57ADB, 0xCB2A58A1, 0xCAADAFB5, 0xCA4E8AE8, 0xCA0B98AA, 0xC9E32D64, 0xC9D346D1, 0xC9D9905A, 0xC9F36859, 0xCA1DE652, 0xCA55E200, 0xCA97FB34, 0xCAE0A263, 0xCB2C21EB, 0xCB76A7DB, 0xCBBC503A, 0xCBF92FAF, 0xCC295E6E, 0xCC490352, 0xCC545F04, 0xCC47D71B, 0xCC20010E, 0xCBD9ACE4, 0xCB71EF85, 0xCAE62C8D, 0xCA341F88, 0xC959E480, 0xC855FFCB, 0xC72764EC, 0xC5CD7C95, 0xC448299C, 0xC297CCDF, 0xC0BD4808, 0xBEB9FF27, 0xBC8FD91C, 0xBA413EC3, 0xB7D118E8, 0xB542CD08, 0xB29A38D0, 0xAFDBAC79, 0xAD0BE3F0, 0xAA2FFEF2, 0xA74D7815, 0xA46A1AD4, 0xA18BF8BF, 0x9EB95DD3, 0x9BF8C420, 0x9950C6CE, 0x96C814A3, 0x94656226, 0x922F5B7A, 0x902C9616, 0x8E638272, 0x8CDA5DD5, 0x8B972452, 0x8A9F832F, 0x89F8CBB4, 0x89A7E69E, 0x89B14841, 0x8A18E581, 0x8AE229A9, 0x8C0FED59, 0x8DA46E7C, 0x8FA14973, 0x92077380, 0x94D7367A, 0x98102DDB, 0x9BB14530, 0x9FB8B7F1, 0xA42412BD, 0xA8F03604, 0xAE195A17, 0xB39B148C, 0xB9705F05, 0xBF939F2D, 0xC5FEAFFD, 0xCCAAEC13, 0xD3913929, 0xDAAA1476, 0xE1ED9FF3, 0xE953B063, 0xF0D3DBF7, 0xF8658980, 
+  } , 
+  // even + odd, order 11 : 
+  { 
+0x00000000, 0x074DE374, 0x0E93566B, 0x15C7F7BF, 0x1CE384DA, 0x23DDE8A8, 0x2AAF4A31, 0x31501AA9, 0x37B922ED, 0x3DE3903D, 0x43C90028, 0x49638B87, 0x4EADD074, 0x53A2FB2B, 0x583ECDBC, 0x5C7DA688, 0x605C8574, 0x63D90FCF, 0x66F192DC, 0x69A50509, 0x6BF305C5, 0x6DDBDBFF, 0x6F607352, 0x708257E8, 0x7143B117, 0x71A73AD3, 0x71B03DFC, 0x71628799, 0x70C25F24, 0x6FD47BE8, 0x6E9DF9A1, 0x6D244C66, 0x6B6D3408, 0x697EAEF5, 0x675EECCC, 0x651440B6, 0x62A513A2, 0x6017D690, 0x5D72F4F8, 0x5ABCC77D, 0x57FB86F1, 0x55353FE8, 0x526FC6D4, 0x4FB0ACD4, 0x4CFD3550, 0x4A5A4C69, 0x47CC7E62, 0x4557F000, 0x43005802, 0x40C8F9AF, 0x3EB4A089, 0x3CC59D26, 0x3AFDC33D, 0x395E68DE, 0x37E866D3, 0x369C1A29, 0x357966DB, 0x347FBB90, 0x33AE165C, 0x33030A82, 0x327CC717, 0x32191E7F, 0x31D58E9F, 0x31AF49C3, 0x31A3400E, 0x31AE295C, 0x31CC8F8F, 0x31FAD90E, 0x32355374, 0x32783E4B, 0x32BFD5B3, 0x33085CE2, 0x334E285E, 0x338DA7E2, 0x33C36FC1, 0x33EC41C8, 0x34051581, 0x340B1FB8, 0x33FBD949, 0x33D50513, 0x3394B50E, 0x33394E75, 0x32C18D00, 0x322C8524, 0x3179A55C, 0x30A8B670, 0x2FB9DACF, 0x2EAD8CE5, 0x2D849C94, 0x2C402BBD, 0x2AE1A9F9, 0x296ACF81, 0x27DD9762, 0x263C3901, 0x24892110, 0x22C6E9FC, 0x20F853F3, 0x1F203C8D, 0x1D419643, 0x1B5F5FB6, 0x197C9AE8, 0x179C4488, 0x15C14B52, 0x13EE87B5, 0x1226B3BB, 0x106C6364, 0x0EC1FD6A, 0x0D29B4A4, 0x0BA581F4, 0x0A371EEF, 0x08E0013C, 0x07A156B7, 0x067C026B, 0x05709A5F, 0x047F663E, 0x03A85EE9, 0x02EB2EDC, 0x0247337B, 0x01BB7F33, 0x0146DC75, 0x00E7D171, 0x009CA49C, 0x006361DE, 0x0039E06F, 0x001DC93A, 0x000C9DD0, 0x0003BFB9, 0x0000782B, 0xFFFFFFFF, 0xFFFF87D4, 0xFFFC4046, 0xFFF3622F, 0xFFE236C5, 0xFFC61F90, 0xFF9C9E21, 0xFF635B63, 0xFF182E8E, 0xFEB9238A, 0xFE4480CC, 0xFDB8CC84, 0xFD14D123, 0xFC57A116, 0xFB8099C1, 0xFA8F65A0, 0xF983FD94, 0xF85EA948, 0xF71FFEC3, 0xF5C8E110, 0xF45A7E0B, 0xF2D64B5B, 0xF13E0295, 0xEF939C9B, 0xEDD94C44, 0xEC11784A, 0xEA3EB4AD, 0xE863BB77, 0xE6836517, 0xE4A0A049, 0xE2BE69BC, 0xE0DFC372, 0xDF07AC0C, 0xDD391603, 0xDB76DEEF, 0xD9C3C6FE, 0xD822689D, 0xD695307E, 0xD51E5606, 0xD3BFD442, 0xD27B636B, 0xD152731A, 0xD0462530, 0xCF57498F, 0xCE865AA3, 0xCDD37ADB, 0xCD3E72FF, 0xCCC6B18A, 0xCC6B4AF1, 0xCC2AFAEC, 0xCC0426B6, 0xCBF4E047, 0xCBFAEA7E, 0xCC13BE37, 0xCC3C903E, 0xCC72581D, 0xCCB1D7A1, 0xCCF7A31D, 0xCD402A4C, 0xCD87C1B4, 0xCDCAAC8B, 0xCE0526F1, 0xCE337070, 0xCE51D6A3, 0xCE5CBFF1, 0xCE50B63C, 0xCE2A7160, 0xCDE6E180, 0xCD8338E8, 0xCCFCF57D, 0xCC51E9A3, 0xCB80446F, 0xCA869924, 0xC963E5D6, 0xC817992C, 0xC6A19721, 0xC5023CC2, 0xC33A62D9, 0xC14B5F76, 0xBF370650, 0xBCFFA7FD, 0xBAA80FFF, 0xB833819D, 0xB5A5B396, 0xB302CAAF, 0xB04F532B, 0xAD90392B, 0xAACAC017, 0xA804790E, 0xA5433882, 0xA28D0B07, 0x9FE8296F, 0x9D5AEC5D, 0x9AEBBF49, 0x98A11333, 0x9681510A, 0x9492CBF7, 0x92DBB399, 0x9162065E, 0x902B8417, 0x8F3DA0DB, 0x8E9D7866, 0x8E4FC203, 0x8E58C52C, 0x8EBC4EE8, 0x8F7DA817, 0x909F8CAD, 0x92242400, 0x940CFA3A, 0x965AFAF6, 0x990E6D23, 0x9C26F030, 0x9FA37A8B, 0xA3825977, 0xA7C13243, 0xAC5D04D4, 0xB1522F8B, 0xB69C7478, 0xBC36FFD7, 0xC21C6FC2, 0xC846DD12, 0xCEAFE556, 0xD550B5CE, 0xDC221757, 0xE31C7B25, 0xEA380840, 0xF16CA994, 0xF8B21C8B, 
+  } , 
+ } , 
+
+ // level 3 : harmonics up to 2
+ { 
+  // sine : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // odd : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // even : 
+  { 
+0x00000000, 0x04D5FE09, 0x09AA1EEA, 0x0E7A8673, 0x13455A68, 0x1808C37C, 0x1CC2EE40, 0x21720C20, 0x2614544F, 0x2AA804B7, 0x2F2B62E3, 0x339CBCE5, 0x37FA6A36, 0x3C42CC90, 0x407450C8, 0x448D6F94, 0x488CAE5D, 0x4C709FF5, 0x5037E557, 0x53E12E53, 0x576B3A34, 0x5AD4D863, 0x5E1CE8F7, 0x61425D42, 0x64443852, 0x67218F65, 0x69D98A59, 0x6C6B6408, 0x6ED66AA2, 0x7119FFF6, 0x733599AF, 0x7528C18A, 0x76F3157E, 0x789447D8, 0x7A0C1F48, 0x7B5A76EA, 0x7C7F3E3C, 0x7D7A790E, 0x7E4C3F5D, 0x7EF4BD31, 0x7F743260, 0x7FCAF24F, 0x7FF963A7, 0x7FFFFFFF, 0x7FDF5372, 0x7F97FC3E, 0x7F2AAA42, 0x7E981E86, 0x7DE12AAA, 0x7D06B056, 0x7C09A09D, 0x7AEAFB57, 0x79ABCE75, 0x784D354A, 0x76D057D1, 0x753669EB, 0x7380AA92, 0x71B0630D, 0x6FC6E61E, 0x6DC58F22, 0x6BADC13B, 0x6980E66B, 0x67406EB1, 0x64EDCF22, 0x628A8101, 0x601800D4, 0x5D97CD78, 0x5B0B6737, 0x58744EDB, 0x55D404C6, 0x532C0806, 0x507DD56E, 0x4DCAE6B3, 0x4B14B189, 0x485CA6C2, 0x45A43179, 0x42ECB639, 0x4037922A, 0x3D861A4C, 0x3AD99AAD, 0x383355AC, 0x35948344, 0x32FE5057, 0x3071DE0C, 0x2DF04128, 0x2B7A817D, 0x2911995A, 0x26B67501, 0x2469F234, 0x222CDFBC, 0x1FFFFD06, 0x1DE3F9C3, 0x1BD97599, 0x19E0FFD7, 0x17FB173C, 0x162829C3, 0x1468947C, 0x12BCA375, 0x112491A3, 0x0FA088E4, 0x0E30A1FF, 0x0CD4E4BE, 0x0B8D4801, 0x0A59B1F0, 0x0939F826, 0x082DDFF5, 0x07351EA9, 0x064F59E2, 0x057C27E9, 0x04BB1020, 0x040B8B6C, 0x036D04B3, 0x02DED95F, 0x026059EB, 0x01F0CA76, 0x018F6363, 0x013B51F9, 0x00F3B914, 0x00B7B1D4, 0x00864C55, 0x005E9070, 0x003F7E80, 0x00281028, 0x00173920, 0x000BE809, 0x0005073F, 0x00017DB1, 0x00002FBB, 0x00000000, 0xFFFFD044, 0xFFFE824E, 0xFFFAF8C0, 0xFFF417F6, 0xFFE8C6DF, 0xFFD7EFD7, 0xFFC0817F, 0xFFA16F8F, 0xFF79B3AA, 0xFF484E2B, 0xFF0C46EB, 0xFEC4AE06, 0xFE709C9C, 0xFE0F3589, 0xFD9FA614, 0xFD2126A0, 0xFC92FB4C, 0xFBF47493, 0xFB44EFDF, 0xFA83D816, 0xF9B0A61D, 0xF8CAE156, 0xF7D2200A, 0xF6C607D9, 0xF5A64E0F, 0xF472B7FE, 0xF32B1B41, 0xF1CF5E00, 0xF05F771B, 0xEEDB6E5C, 0xED435C8A, 0xEB976B83, 0xE9D7D63C, 0xE804E8C3, 0xE61F0028, 0xE4268A66, 0xE21C063C, 0xE00002F9, 0xDDD32043, 0xDB960DCB, 0xD9498AFE, 0xD6EE66A5, 0xD4857E82, 0xD20FBED7, 0xCF8E21F3, 0xCD01AFA8, 0xCA6B7CBB, 0xC7CCAA53, 0xC5266552, 0xC279E5B3, 0xBFC86DD5, 0xBD1349C6, 0xBA5BCE86, 0xB7A3593D, 0xB4EB4E76, 0xB235194C, 0xAF822A91, 0xACD3F7F9, 0xAA2BFB39, 0xA78BB124, 0xA4F498C8, 0xA2683287, 0x9FE7FF2B, 0x9D757EFE, 0x9B1230DD, 0x98BF914E, 0x967F1994, 0x94523EC4, 0x923A70DD, 0x903919E1, 0x8E4F9CF2, 0x8C7F556D, 0x8AC99614, 0x892FA82E, 0x87B2CAB5, 0x8654318A, 0x851504A8, 0x83F65F62, 0x82F94FA9, 0x821ED555, 0x8167E179, 0x80D555BD, 0x806803C1, 0x8020AC8D, 0x80000001, 0x80069C58, 0x80350DB0, 0x808BCD9F, 0x810B42CE, 0x81B3C0A2, 0x828586F1, 0x8380C1C3, 0x84A58915, 0x85F3E0B7, 0x876BB827, 0x890CEA81, 0x8AD73E75, 0x8CCA6650, 0x8EE60009, 0x9129955D, 0x93949BF7, 0x962675A6, 0x98DE709A, 0x9BBBC7AD, 0x9EBDA2BD, 0xA1E31708, 0xA52B279C, 0xA894C5CB, 0xAC1ED1AC, 0xAFC81AA8, 0xB38F600A, 0xB77351A2, 0xBB72906B, 0xBF8BAF37, 0xC3BD336F, 0xC80595C9, 0xCC63431A, 0xD0D49D1C, 0xD557FB48, 0xD9EBABB0, 0xDE8DF3DF, 0xE33D11BF, 0xE7F73C83, 0xECBAA597, 0xF185798C, 0xF655E115, 0xFB2A01F6, 
+  } , 
+  // even + odd, order 7 : 
+  { 
+0x00000000, 0x03CDB85A, 0x0799F967, 0x0B634C9F, 0x0F283D01, 0x12E757DB, 0x169F2D88, 0x1A4E5231, 0x1DF35E8E, 0x218CF09C, 0x2519AC5A, 0x28983C7B, 0x2C075317, 0x2F65AA59, 0x32B20523, 0x35EB2FB7, 0x3910004A, 0x3C1F57A6, 0x3F1821B3, 0x41F95604, 0x44C1F85C, 0x47711928, 0x4A05D5F5, 0x4C7F59DD, 0x4EDCDDED, 0x511DA980, 0x53411297, 0x55467E22, 0x572D6047, 0x58F53C97, 0x5A9DA647, 0x5C264053, 0x5D8EBD9E, 0x5ED6E10B, 0x5FFE7D87, 0x6105760D, 0x61EBBDA3, 0x62B15747, 0x635655D8, 0x63DADBF7, 0x643F1BD9, 0x64835717, 0x64A7DE70, 0x64AD1184, 0x64935E89, 0x645B41F2, 0x64054616, 0x639202C6, 0x63021CE3, 0x625645EA, 0x618F3B78, 0x60ADC6C7, 0x5FB2BC28, 0x5E9EFA73, 0x5D736A75, 0x5C30FE56, 0x5AD8B0F7, 0x596B8558, 0x57EA85E7, 0x5656C3DC, 0x54B1568A, 0x52FB5AAC, 0x5135F1B2, 0x4F62410D, 0x4D817178, 0x4B94AE3E, 0x499D2481, 0x479C0282, 0x459276E9, 0x4381B008, 0x416ADB2A, 0x3F4F23D5, 0x3D2FB31E, 0x3B0DAEF1, 0x38EA3969, 0x36C6701A, 0x34A36B74, 0x32823E16, 0x3063F436, 0x2E499300, 0x2C341801, 0x2A24789C, 0x281BA177, 0x261A7601, 0x2421CFE9, 0x22327EB0, 0x204D4736, 0x1E72E350, 0x1CA40166, 0x1AE1441F, 0x192B420A, 0x17828558, 0x15E78B98, 0x145AC585, 0x12DC96CD, 0x116D55F1, 0x100D4C25, 0x0EBCB539, 0x0D7BBF8D, 0x0C4A8C0E, 0x0B292E3C, 0x0A17AC33, 0x0915FEC9, 0x082411A8, 0x0741C37A, 0x066EE616, 0x05AB3EBC, 0x04F68655, 0x045069BC, 0x03B88A13, 0x032E7D14, 0x02B1CD7C, 0x0241FB68, 0x01DE7CCC, 0x0186BDE2, 0x013A21A8, 0x00F80263, 0x00BFB221, 0x00907B4D, 0x0069A138, 0x004A60B4, 0x0031F0AE, 0x001F82CA, 0x00124407, 0x00095D60, 0x0003F475, 0x00012C36, 0x0000258B, 0x00000000, 0xFFFFDA74, 0xFFFED3C9, 0xFFFC0B8A, 0xFFF6A29F, 0xFFEDBBF8, 0xFFE07D35, 0xFFCE0F51, 0xFFB59F4B, 0xFF965EC7, 0xFF6F84B2, 0xFF404DDE, 0xFF07FD9C, 0xFEC5DE57, 0xFE79421D, 0xFE218333, 0xFDBE0497, 0xFD4E3283, 0xFCD182EB, 0xFC4775EC, 0xFBAF9643, 0xFB0979AA, 0xFA54C143, 0xF99119E9, 0xF8BE3C85, 0xF7DBEE57, 0xF6EA0136, 0xF5E853CC, 0xF4D6D1C3, 0xF3B573F1, 0xF2844072, 0xF1434AC6, 0xEFF2B3DA, 0xEE92AA0E, 0xED236932, 0xEBA53A7A, 0xEA187467, 0xE87D7AA7, 0xE6D4BDF5, 0xE51EBBE0, 0xE35BFE99, 0xE18D1CAF, 0xDFB2B8C9, 0xDDCD814F, 0xDBDE3016, 0xD9E589FE, 0xD7E45E88, 0xD5DB8763, 0xD3CBE7FE, 0xD1B66CFF, 0xCF9C0BC9, 0xCD7DC1E9, 0xCB5C948B, 0xC9398FE5, 0xC715C696, 0xC4F2510E, 0xC2D04CE1, 0xC0B0DC2A, 0xBE9524D5, 0xBC7E4FF7, 0xBA6D8916, 0xB863FD7D, 0xB662DB7E, 0xB46B51C1, 0xB27E8E87, 0xB09DBEF2, 0xAECA0E4D, 0xAD04A553, 0xAB4EA975, 0xA9A93C23, 0xA8157A18, 0xA6947AA7, 0xA5274F08, 0xA3CF01A9, 0xA28C958A, 0xA161058C, 0xA04D43D7, 0x9F523938, 0x9E70C487, 0x9DA9BA15, 0x9CFDE31C, 0x9C6DFD39, 0x9BFAB9E9, 0x9BA4BE0D, 0x9B6CA176, 0x9B52EE7B, 0x9B58218F, 0x9B7CA8E8, 0x9BC0E426, 0x9C252408, 0x9CA9AA27, 0x9D4EA8B8, 0x9E14425C, 0x9EFA89F2, 0xA0018278, 0xA1291EF4, 0xA2714261, 0xA3D9BFAC, 0xA56259B8, 0xA70AC368, 0xA8D29FB8, 0xAAB981DD, 0xACBEED68, 0xAEE2567F, 0xB1232212, 0xB380A622, 0xB5FA2A0A, 0xB88EE6D7, 0xBB3E07A3, 0xBE06A9FB, 0xC0E7DE4C, 0xC3E0A859, 0xC6EFFFB5, 0xCA14D048, 0xCD4DFADC, 0xD09A55A6, 0xD3F8ACE8, 0xD767C384, 0xDAE653A5, 0xDE730F63, 0xE20CA171, 0xE5B1ADCE, 0xE960D277, 0xED18A824, 0xF0D7C2FE, 0xF49CB360, 0xF8660698, 0xFC3247A5, 
+  } , 
+  // even + odd, order 11 : 
+  { 
+0x00000000, 0x03A769E8, 0x074D6B48, 0x0AF09C51, 0x0E8F96B1, 0x1228F64A, 0x15BB59EE, 0x19456418, 0x1CC5BB9F, 0x203B0C70, 0x23A40839, 0x26FF671C, 0x2A4BE852, 0x2D8852D9, 0x30B3760D, 0x33CC2A48, 0x36D1517B, 0x39C1D7B9, 0x3C9CB3C7, 0x3F60E7A1, 0x420D80F4, 0x44A1999B, 0x471C580C, 0x497CEFC0, 0x4BC2A198, 0x4DECBC33, 0x4FFA9C42, 0x51EBACCE, 0x53BF677E, 0x557554C8, 0x570D0C29, 0x58863445, 0x59E08308, 0x5B1BBDBE, 0x5C37B917, 0x5D345935, 0x5E11919F, 0x5ECF6535, 0x5F6DE619, 0x5FED358E, 0x604D83D0, 0x608F0FE4, 0x60B2275A, 0x60B72611, 0x609E75E7, 0x60688E6C, 0x6015F484, 0x5FA73A07, 0x5F1CFD5B, 0x5E77E900, 0x5DB8B31E, 0x5CE01D04, 0x5BEEF2A9, 0x5AE60A22, 0x59C64311, 0x58908618, 0x5745C43C, 0x55E6F648, 0x54751C32, 0x52F13C72, 0x515C635D, 0x4FB7A27B, 0x4E040FD9, 0x4C42C55D, 0x4A74E015, 0x489B7F85, 0x46B7C4F8, 0x44CAD2CB, 0x42D5CBBC, 0x40D9D23A, 0x3ED807B5, 0x3CD18BEA, 0x3AC77C3F, 0x38BAF311, 0x36AD070E, 0x349ECA90, 0x32914AFF, 0x3085902C, 0x2E7C9BBF, 0x2C77689D, 0x2A76EA5D, 0x287C0CB6, 0x2687B303, 0x249AB7BD, 0x22B5EC05, 0x20DA1732, 0x1F07F663, 0x1D403C20, 0x1B838FF4, 0x19D28E1F, 0x182DC745, 0x1695C025, 0x150AF161, 0x138DC742, 0x121EA18A, 0x10BDD355, 0x0F6BA2F3, 0x0E2849DC, 0x0CF3F49C, 0x0BCEC2D4, 0x0AB8C740, 0x09B207BE, 0x08BA7D6D, 0x07D214C4, 0x06F8ADBC, 0x062E1BFC, 0x05722715, 0x04C48ABC, 0x0424F712, 0x039310F1, 0x030E7246, 0x0296AA68, 0x022B3E7C, 0x01CBA9E5, 0x01775EAE, 0x012DC601, 0x00EE40A8, 0x00B8278A, 0x008ACC36, 0x00657968, 0x004773A3, 0x002FF9BA, 0x001E4571, 0x00118C12, 0x0008FF10, 0x0003CCA1, 0x00012067, 0x00002411, 0x00000000, 0xFFFFDBEE, 0xFFFEDF98, 0xFFFC335E, 0xFFF700EF, 0xFFEE73ED, 0xFFE1BA8E, 0xFFD00645, 0xFFB88C5C, 0xFF9A8697, 0xFF7533C9, 0xFF47D875, 0xFF11BF57, 0xFED239FE, 0xFE88A151, 0xFE34561A, 0xFDD4C183, 0xFD695597, 0xFCF18DB9, 0xFC6CEF0E, 0xFBDB08ED, 0xFB3B7543, 0xFA8DD8EA, 0xF9D1E403, 0xF9075243, 0xF82DEB3B, 0xF7458292, 0xF64DF841, 0xF54738BF, 0xF4313D2B, 0xF30C0B63, 0xF1D7B623, 0xF0945D0C, 0xEF422CAA, 0xEDE15E75, 0xEC7238BD, 0xEAF50E9E, 0xE96A3FDA, 0xE7D238BA, 0xE62D71E0, 0xE47C700B, 0xE2BFC3DF, 0xE0F8099C, 0xDF25E8CD, 0xDD4A13FA, 0xDB654842, 0xD9784CFC, 0xD783F349, 0xD58915A2, 0xD3889762, 0xD1836440, 0xCF7A6FD3, 0xCD6EB500, 0xCB61356F, 0xC952F8F1, 0xC7450CEE, 0xC53883C0, 0xC32E7415, 0xC127F84A, 0xBF262DC5, 0xBD2A3443, 0xBB352D34, 0xB9483B07, 0xB764807A, 0xB58B1FEA, 0xB3BD3AA2, 0xB1FBF026, 0xB0485D84, 0xAEA39CA2, 0xAD0EC38D, 0xAB8AE3CD, 0xAA1909B7, 0xA8BA3BC3, 0xA76F79E7, 0xA639BCEE, 0xA519F5DD, 0xA4110D56, 0xA31FE2FB, 0xA2474CE1, 0xA18816FF, 0xA0E302A4, 0xA058C5F8, 0x9FEA0B7B, 0x9F977193, 0x9F618A18, 0x9F48D9EE, 0x9F4DD8A5, 0x9F70F01B, 0x9FB27C2F, 0xA012CA71, 0xA09219E6, 0xA1309ACA, 0xA1EE6E60, 0xA2CBA6CA, 0xA3C846E8, 0xA4E44241, 0xA61F7CF7, 0xA779CBBA, 0xA8F2F3D6, 0xAA8AAB37, 0xAC409881, 0xAE145331, 0xB00563BD, 0xB21343CC, 0xB43D5E67, 0xB683103F, 0xB8E3A7F3, 0xBB5E6664, 0xBDF27F0B, 0xC09F185E, 0xC3634C38, 0xC63E2846, 0xC92EAE84, 0xCC33D5B7, 0xCF4C89F2, 0xD277AD26, 0xD5B417AD, 0xD90098E3, 0xDC5BF7C6, 0xDFC4F38F, 0xE33A4460, 0xE6BA9BE7, 0xEA44A611, 0xEDD709B5, 0xF170694E, 0xF50F63AE, 0xF8B294B7, 0xFC589617, 
+  } , 
+ } , 
+
+ // level 4 : harmonics up to 1
+ { 
+  // sine : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // odd : 
+  { 
+0x00000000, 0x03242ABE, 0x0647D97C, 0x096A9049, 0x0C8BD35D, 0x0FAB272B, 0x12C8106E, 0x15E21444, 0x18F8B83C, 0x1C0B826A, 0x1F19F97A, 0x2223A4C5, 0x25280C5D, 0x2826B927, 0x2B1F34EB, 0x2E110A61, 0x30FBC54C, 0x33DEF286, 0x36BA2013, 0x398CDD31, 0x3C56BA6F, 0x3F1749B7, 0x41CE1E64, 0x447ACD4F, 0x471CECE6, 0x49B41532, 0x4C3FDFF2, 0x4EBFE8A3, 0x5133CC93, 0x539B2AEE, 0x55F5A4D1, 0x5842DD53, 0x5A827999, 0x5CB420DF, 0x5ED77C88, 0x60EC382F, 0x62F201AB, 0x64E88925, 0x66CF811F, 0x68A69E80, 0x6A6D98A3, 0x6C24295F, 0x6DCA0D13, 0x6F5F02B0, 0x70E2CBC5, 0x72552C83, 0x73B5EBD0, 0x7504D344, 0x7641AF3B, 0x776C4EDA, 0x78848412, 0x798A23B0, 0x7A7D055A, 0x7B5D039C, 0x7C29FBED, 0x7CE3CEB0, 0x7D8A5F3E, 0x7E1D93E8, 0x7E9D55FB, 0x7F0991C2, 0x7F62368E, 0x7FA736B3, 0x7FD8878C, 0x7FF62181, 0x7FFFFFFF, 0x7FF62181, 0x7FD8878C, 0x7FA736B3, 0x7F62368E, 0x7F0991C2, 0x7E9D55FB, 0x7E1D93E8, 0x7D8A5F3E, 0x7CE3CEB0, 0x7C29FBED, 0x7B5D039C, 0x7A7D055A, 0x798A23B0, 0x78848412, 0x776C4EDA, 0x7641AF3B, 0x7504D344, 0x73B5EBD0, 0x72552C83, 0x70E2CBC5, 0x6F5F02B0, 0x6DCA0D13, 0x6C24295F, 0x6A6D98A3, 0x68A69E80, 0x66CF811F, 0x64E88925, 0x62F201AB, 0x60EC382F, 0x5ED77C88, 0x5CB420DF, 0x5A827999, 0x5842DD53, 0x55F5A4D1, 0x539B2AEE, 0x5133CC93, 0x4EBFE8A3, 0x4C3FDFF2, 0x49B41532, 0x471CECE6, 0x447ACD4F, 0x41CE1E64, 0x3F1749B7, 0x3C56BA6F, 0x398CDD31, 0x36BA2013, 0x33DEF286, 0x30FBC54C, 0x2E110A61, 0x2B1F34EB, 0x2826B927, 0x25280C5D, 0x2223A4C5, 0x1F19F97A, 0x1C0B826A, 0x18F8B83C, 0x15E21444, 0x12C8106E, 0x0FAB272B, 0x0C8BD35D, 0x096A9049, 0x0647D97C, 0x03242ABE, 0x00000000, 0xFCDBD541, 0xF9B82683, 0xF6956FB6, 0xF3742CA2, 0xF054D8D4, 0xED37EF91, 0xEA1DEBBB, 0xE70747C3, 0xE3F47D95, 0xE0E60685, 0xDDDC5B3A, 0xDAD7F3A2, 0xD7D946D8, 0xD4E0CB14, 0xD1EEF59E, 0xCF043AB3, 0xCC210D79, 0xC945DFEC, 0xC67322CE, 0xC3A94590, 0xC0E8B648, 0xBE31E19B, 0xBB8532B0, 0xB8E31319, 0xB64BEACD, 0xB3C0200D, 0xB140175C, 0xAECC336C, 0xAC64D511, 0xAA0A5B2E, 0xA7BD22AC, 0xA57D8666, 0xA34BDF20, 0xA1288377, 0x9F13C7D0, 0x9D0DFE54, 0x9B1776DA, 0x99307EE0, 0x9759617F, 0x9592675C, 0x93DBD6A0, 0x9235F2EC, 0x90A0FD4F, 0x8F1D343A, 0x8DAAD37C, 0x8C4A142F, 0x8AFB2CBB, 0x89BE50C4, 0x8893B125, 0x877B7BED, 0x8675DC4F, 0x8582FAA5, 0x84A2FC63, 0x83D60412, 0x831C314F, 0x8275A0C1, 0x81E26C17, 0x8162AA04, 0x80F66E3D, 0x809DC971, 0x8058C94C, 0x80277873, 0x8009DE7E, 0x80000001, 0x8009DE7E, 0x80277873, 0x8058C94C, 0x809DC971, 0x80F66E3D, 0x8162AA04, 0x81E26C17, 0x8275A0C1, 0x831C314F, 0x83D60412, 0x84A2FC63, 0x8582FAA5, 0x8675DC4F, 0x877B7BED, 0x8893B125, 0x89BE50C4, 0x8AFB2CBB, 0x8C4A142F, 0x8DAAD37C, 0x8F1D343A, 0x90A0FD4F, 0x9235F2EC, 0x93DBD6A0, 0x9592675C, 0x9759617F, 0x99307EE0, 0x9B1776DA, 0x9D0DFE54, 0x9F13C7D0, 0xA1288377, 0xA34BDF20, 0xA57D8666, 0xA7BD22AC, 0xAA0A5B2E, 0xAC64D511, 0xAECC336C, 0xB140175C, 0xB3C0200D, 0xB64BEACD, 0xB8E31319, 0xBB8532B0, 0xBE31E19B, 0xC0E8B648, 0xC3A94590, 0xC67322CE, 0xC945DFEC, 0xCC210D79, 0xCF043AB3, 0xD1EEF59E, 0xD4E0CB14, 0xD7D946D8, 0xDAD7F3A2, 0xDDDC5B3A, 0xE0E60685, 0xE3F47D95, 0xE70747C3, 0xEA1DEBBB, 0xED37EF91, 0xF054D8D4, 0xF3742CA2, 0xF6956FB6, 0xF9B82683, 0xFCDBD541, 
+  } , 
+  // even : 
+  { 
+0x00000000, 0x02B0DFD6, 0x05615572, 0x0810F6AA, 0x0ABF5975, 0x0D6C13FA, 0x1016BCA3, 0x12BEEA2B, 0x156433AF, 0x180630BE, 0x1AA47969, 0x1D3EA655, 0x1FD450C6, 0x226512B4, 0x24F086DA, 0x277648C2, 0x29F5F4D7, 0x2C6F2877, 0x2EE181FC, 0x314CA0D0, 0x33B0257A, 0x360BB1AF, 0x385EE85C, 0x3AA96DB7, 0x3CEAE751, 0x3F22FC1B, 0x4151547C, 0x43759A5B, 0x458F792B, 0x479E9DFC, 0x49A2B783, 0x4B9B762B, 0x4D888C1F, 0x4F69AD54, 0x513E8F9B, 0x5306EAA4, 0x54C27811, 0x5670F37C, 0x58121A83, 0x59A5ACD2, 0x5B2B6C2D, 0x5CA31C7C, 0x5E0C83CE, 0x5F676A69, 0x60B39ACF, 0x61F0E1C6, 0x631F0E60, 0x643DF206, 0x654D607A, 0x664D2FE1, 0x673D38C8, 0x681D562B, 0x68ED657C, 0x69AD46A4, 0x6A5CDC0E, 0x6AFC0AA5, 0x6B8AB9DE, 0x6C08D3B8, 0x6C7644C1, 0x6CD2FC18, 0x6D1EEB73, 0x6D5A071A, 0x6D8445F1, 0x6D9DA173, 0x6DA615B9, 0x6D9DA173, 0x6D8445F1, 0x6D5A071A, 0x6D1EEB73, 0x6CD2FC18, 0x6C7644C1, 0x6C08D3B8, 0x6B8AB9DE, 0x6AFC0AA5, 0x6A5CDC0E, 0x69AD46A4, 0x68ED657C, 0x681D562B, 0x673D38C8, 0x664D2FE1, 0x654D607A, 0x643DF206, 0x631F0E60, 0x61F0E1C6, 0x60B39ACF, 0x5F676A69, 0x5E0C83CE, 0x5CA31C7C, 0x5B2B6C2D, 0x59A5ACD2, 0x58121A83, 0x5670F37C, 0x54C27811, 0x5306EAA4, 0x513E8F9B, 0x4F69AD54, 0x4D888C1F, 0x4B9B762B, 0x49A2B783, 0x479E9DFC, 0x458F792B, 0x43759A5B, 0x4151547C, 0x3F22FC1B, 0x3CEAE751, 0x3AA96DB7, 0x385EE85C, 0x360BB1AF, 0x33B0257A, 0x314CA0D0, 0x2EE181FC, 0x2C6F2877, 0x29F5F4D7, 0x277648C2, 0x24F086DA, 0x226512B4, 0x1FD450C6, 0x1D3EA655, 0x1AA47969, 0x180630BE, 0x156433AF, 0x12BEEA2B, 0x1016BCA3, 0x0D6C13FA, 0x0ABF5975, 0x0810F6AA, 0x05615572, 0x02B0DFD6, 0x00000000, 0xFD4F2029, 0xFA9EAA8D, 0xF7EF0955, 0xF540A68A, 0xF293EC05, 0xEFE9435C, 0xED4115D4, 0xEA9BCC50, 0xE7F9CF41, 0xE55B8696, 0xE2C159AA, 0xE02BAF39, 0xDD9AED4B, 0xDB0F7925, 0xD889B73D, 0xD60A0B28, 0xD390D788, 0xD11E7E03, 0xCEB35F2F, 0xCC4FDA85, 0xC9F44E50, 0xC7A117A3, 0xC5569248, 0xC31518AE, 0xC0DD03E4, 0xBEAEAB83, 0xBC8A65A4, 0xBA7086D4, 0xB8616203, 0xB65D487C, 0xB46489D4, 0xB27773E0, 0xB09652AB, 0xAEC17064, 0xACF9155B, 0xAB3D87EE, 0xA98F0C83, 0xA7EDE57C, 0xA65A532D, 0xA4D493D2, 0xA35CE383, 0xA1F37C31, 0xA0989596, 0x9F4C6530, 0x9E0F1E39, 0x9CE0F19F, 0x9BC20DF9, 0x9AB29F85, 0x99B2D01E, 0x98C2C737, 0x97E2A9D4, 0x97129A83, 0x9652B95B, 0x95A323F1, 0x9503F55A, 0x94754621, 0x93F72C47, 0x9389BB3E, 0x932D03E7, 0x92E1148C, 0x92A5F8E5, 0x927BBA0E, 0x92625E8C, 0x9259EA46, 0x92625E8C, 0x927BBA0E, 0x92A5F8E5, 0x92E1148C, 0x932D03E7, 0x9389BB3E, 0x93F72C47, 0x94754621, 0x9503F55A, 0x95A323F1, 0x9652B95B, 0x97129A83, 0x97E2A9D4, 0x98C2C737, 0x99B2D01E, 0x9AB29F85, 0x9BC20DF9, 0x9CE0F19F, 0x9E0F1E39, 0x9F4C6530, 0xA0989596, 0xA1F37C31, 0xA35CE383, 0xA4D493D2, 0xA65A532D, 0xA7EDE57C, 0xA98F0C83, 0xAB3D87EE, 0xACF9155B, 0xAEC17064, 0xB09652AB, 0xB27773E0, 0xB46489D4, 0xB65D487C, 0xB8616203, 0xBA7086D4, 0xBC8A65A4, 0xBEAEAB83, 0xC0DD03E4, 0xC31518AE, 0xC5569248, 0xC7A117A3, 0xC9F44E50, 0xCC4FDA85, 0xCEB35F2F, 0xD11E7E03, 0xD390D788, 0xD60A0B28, 0xD889B73D, 0xDB0F7925, 0xDD9AED4B, 0xE02BAF39, 0xE2C159AA, 0xE55B8696, 0xE7F9CF41, 0xEA9BCC50, 0xED4115D4, 0xEFE9435C, 0xF293EC05, 0xF540A68A, 0xF7EF0955, 0xFA9EAA8D, 0xFD4F2029, 
+  } , 
+  // even + odd, order 7 : 
+  { 
+0x00000000, 0x01E6EEF2, 0x03CD92CF, 0x05B3A08A, 0x0798CD30, 0x097CCDF1, 0x0B5F5829, 0x0D40216F, 0x0F1EDFA1, 0x10FB48EA, 0x12D513D3, 0x14ABF74E, 0x167FAABD, 0x184FE600, 0x1A1C6183, 0x1BE4D641, 0x1DA8FDD9, 0x1F689291, 0x21234F64, 0x22D8F00B, 0x2489310C, 0x2633CFBF, 0x27D88A59, 0x29771FFA, 0x2B0F50B4, 0x2CA0DD94, 0x2E2B88B0, 0x2FAF152B, 0x312B4741, 0x329FE453, 0x340CB2EA, 0x35717AC6, 0x36CE04E1, 0x38221B7E, 0x396D8A2A, 0x3AB01DC9, 0x3BE9A49E, 0x3D19EE4F, 0x3E40CBF1, 0x3F5E100B, 0x40718E9F, 0x417B1D33, 0x427A92D3, 0x436FC81A, 0x445A9739, 0x453ADBF9, 0x461073C7, 0x46DB3DB1, 0x479B1A72, 0x484FEC75, 0x48F997D7, 0x4998026F, 0x4A2B13CE, 0x4AB2B546, 0x4B2ED1EF, 0x4B9F56A4, 0x4C04320B, 0x4C5D5496, 0x4CAAB088, 0x4CEC39F2, 0x4D21E6BA, 0x4D4BAE97, 0x4D698B19, 0x4D7B77A6, 0x4D817178, 0x4D7B77A6, 0x4D698B19, 0x4D4BAE97, 0x4D21E6BA, 0x4CEC39F2, 0x4CAAB088, 0x4C5D5496, 0x4C04320B, 0x4B9F56A4, 0x4B2ED1EF, 0x4AB2B546, 0x4A2B13CE, 0x4998026F, 0x48F997D7, 0x484FEC75, 0x479B1A72, 0x46DB3DB1, 0x461073C7, 0x453ADBF9, 0x445A9739, 0x436FC81A, 0x427A92D3, 0x417B1D33, 0x40718E9F, 0x3F5E100B, 0x3E40CBF1, 0x3D19EE4F, 0x3BE9A49E, 0x3AB01DC9, 0x396D8A2A, 0x38221B7E, 0x36CE04E1, 0x35717AC6, 0x340CB2EA, 0x329FE453, 0x312B4741, 0x2FAF152B, 0x2E2B88B0, 0x2CA0DD94, 0x2B0F50B4, 0x29771FFA, 0x27D88A59, 0x2633CFBF, 0x2489310C, 0x22D8F00B, 0x21234F64, 0x1F689291, 0x1DA8FDD9, 0x1BE4D641, 0x1A1C6183, 0x184FE600, 0x167FAABD, 0x14ABF74E, 0x12D513D3, 0x10FB48EA, 0x0F1EDFA1, 0x0D40216F, 0x0B5F5829, 0x097CCDF1, 0x0798CD30, 0x05B3A08A, 0x03CD92CF, 0x01E6EEF2, 0x00000000, 0xFE19110D, 0xFC326D30, 0xFA4C5F75, 0xF86732CF, 0xF683320E, 0xF4A0A7D6, 0xF2BFDE90, 0xF0E1205E, 0xEF04B715, 0xED2AEC2C, 0xEB5408B1, 0xE9805542, 0xE7B019FF, 0xE5E39E7C, 0xE41B29BE, 0xE2570226, 0xE0976D6E, 0xDEDCB09B, 0xDD270FF4, 0xDB76CEF3, 0xD9CC3040, 0xD82775A6, 0xD688E005, 0xD4F0AF4B, 0xD35F226B, 0xD1D4774F, 0xD050EAD4, 0xCED4B8BE, 0xCD601BAC, 0xCBF34D15, 0xCA8E8539, 0xC931FB1E, 0xC7DDE481, 0xC69275D5, 0xC54FE236, 0xC4165B61, 0xC2E611B0, 0xC1BF340E, 0xC0A1EFF4, 0xBF8E7160, 0xBE84E2CC, 0xBD856D2C, 0xBC9037E5, 0xBBA568C6, 0xBAC52406, 0xB9EF8C38, 0xB924C24E, 0xB864E58D, 0xB7B0138A, 0xB7066828, 0xB667FD90, 0xB5D4EC31, 0xB54D4AB9, 0xB4D12E10, 0xB460A95B, 0xB3FBCDF4, 0xB3A2AB69, 0xB3554F77, 0xB313C60D, 0xB2DE1945, 0xB2B45168, 0xB29674E6, 0xB2848859, 0xB27E8E87, 0xB2848859, 0xB29674E6, 0xB2B45168, 0xB2DE1945, 0xB313C60D, 0xB3554F77, 0xB3A2AB69, 0xB3FBCDF4, 0xB460A95B, 0xB4D12E10, 0xB54D4AB9, 0xB5D4EC31, 0xB667FD90, 0xB7066828, 0xB7B0138A, 0xB864E58D, 0xB924C24E, 0xB9EF8C38, 0xBAC52406, 0xBBA568C6, 0xBC9037E5, 0xBD856D2C, 0xBE84E2CC, 0xBF8E7160, 0xC0A1EFF4, 0xC1BF340E, 0xC2E611B0, 0xC4165B61, 0xC54FE236, 0xC69275D5, 0xC7DDE481, 0xC931FB1E, 0xCA8E8539, 0xCBF34D15, 0xCD601BAC, 0xCED4B8BE, 0xD050EAD4, 0xD1D4774F, 0xD35F226B, 0xD4F0AF4B, 0xD688E005, 0xD82775A6, 0xD9CC3040, 0xDB76CEF3, 0xDD270FF4, 0xDEDCB09B, 0xE0976D6E, 0xE2570226, 0xE41B29BE, 0xE5E39E7C, 0xE7B019FF, 0xE9805542, 0xEB5408B1, 0xED2AEC2C, 0xEF04B715, 0xF0E1205E, 0xF2BFDE90, 0xF4A0A7D6, 0xF683320E, 0xF86732CF, 0xFA4C5F75, 0xFC326D30, 0xFE19110D, 
+  } , 
+  // even + odd, order 11 : 
+  { 
+0x00000000, 0x01D3C6FC, 0x03A745D7, 0x057A3479, 0x074C4AE0, 0x091D412E, 0x0AECCFB0, 0x0CBAAEE9, 0x0E8697A1, 0x105042EC, 0x12176A37, 0x13DBC753, 0x159D147D, 0x175B0C6D, 0x19156A5D, 0x1ACBEA17, 0x1C7E47FC, 0x1E2C4110, 0x1FD59307, 0x2179FC49, 0x23193C03, 0x24B3122C, 0x26473F91, 0x27D585DE, 0x295DA7AA, 0x2ADF687C, 0x2C5A8CD8, 0x2DCEDA46, 0x2F3C175F, 0x30A20BCE, 0x32008062, 0x33573F10, 0x34A612FE, 0x35ECC889, 0x372B2D51, 0x3861103C, 0x398E4180, 0x3AB292AD, 0x3BCDD6AF, 0x3CDFE1D7, 0x3DE889E2, 0x3EE7A602, 0x3FDD0EDF, 0x40C89EA1, 0x41AA30F6, 0x4281A314, 0x434ED3C3, 0x4411A35F, 0x44C9F3DC, 0x4577A8CF, 0x461AA76E, 0x46B2D698, 0x47401ED4, 0x47C26A59, 0x4839A50F, 0x48A5BC95, 0x4906A03E, 0x495C4119, 0x49A691F3, 0x49E58756, 0x4A19178D, 0x4A413AA3, 0x4A5DEA68, 0x4A6F2271, 0x4A74E015, 0x4A6F2271, 0x4A5DEA68, 0x4A413AA3, 0x4A19178D, 0x49E58756, 0x49A691F3, 0x495C4119, 0x4906A03E, 0x48A5BC95, 0x4839A50F, 0x47C26A59, 0x47401ED4, 0x46B2D698, 0x461AA76E, 0x4577A8CF, 0x44C9F3DC, 0x4411A35F, 0x434ED3C3, 0x4281A314, 0x41AA30F6, 0x40C89EA1, 0x3FDD0EDF, 0x3EE7A602, 0x3DE889E2, 0x3CDFE1D7, 0x3BCDD6AF, 0x3AB292AD, 0x398E4180, 0x3861103C, 0x372B2D51, 0x35ECC889, 0x34A612FE, 0x33573F10, 0x32008062, 0x30A20BCE, 0x2F3C175F, 0x2DCEDA46, 0x2C5A8CD8, 0x2ADF687C, 0x295DA7AA, 0x27D585DE, 0x26473F91, 0x24B3122C, 0x23193C03, 0x2179FC49, 0x1FD59307, 0x1E2C4110, 0x1C7E47FC, 0x1ACBEA17, 0x19156A5D, 0x175B0C6D, 0x159D147D, 0x13DBC753, 0x12176A37, 0x105042EC, 0x0E8697A1, 0x0CBAAEE9, 0x0AECCFB0, 0x091D412E, 0x074C4AE0, 0x057A3479, 0x03A745D7, 0x01D3C6FC, 0x00000000, 0xFE2C3903, 0xFC58BA28, 0xFA85CB86, 0xF8B3B51F, 0xF6E2BED1, 0xF513304F, 0xF3455116, 0xF179685E, 0xEFAFBD13, 0xEDE895C8, 0xEC2438AC, 0xEA62EB82, 0xE8A4F392, 0xE6EA95A2, 0xE53415E8, 0xE381B803, 0xE1D3BEEF, 0xE02A6CF8, 0xDE8603B6, 0xDCE6C3FC, 0xDB4CEDD3, 0xD9B8C06E, 0xD82A7A21, 0xD6A25855, 0xD5209783, 0xD3A57327, 0xD23125B9, 0xD0C3E8A0, 0xCF5DF431, 0xCDFF7F9D, 0xCCA8C0EF, 0xCB59ED01, 0xCA133776, 0xC8D4D2AE, 0xC79EEFC3, 0xC671BE7F, 0xC54D6D52, 0xC4322950, 0xC3201E28, 0xC217761D, 0xC11859FD, 0xC022F120, 0xBF37615E, 0xBE55CF09, 0xBD7E5CEB, 0xBCB12C3C, 0xBBEE5CA0, 0xBB360C23, 0xBA885730, 0xB9E55891, 0xB94D2967, 0xB8BFE12B, 0xB83D95A6, 0xB7C65AF0, 0xB75A436A, 0xB6F95FC1, 0xB6A3BEE6, 0xB6596E0C, 0xB61A78A9, 0xB5E6E872, 0xB5BEC55C, 0xB5A21597, 0xB590DD8E, 0xB58B1FEA, 0xB590DD8E, 0xB5A21597, 0xB5BEC55C, 0xB5E6E872, 0xB61A78A9, 0xB6596E0C, 0xB6A3BEE6, 0xB6F95FC1, 0xB75A436A, 0xB7C65AF0, 0xB83D95A6, 0xB8BFE12B, 0xB94D2967, 0xB9E55891, 0xBA885730, 0xBB360C23, 0xBBEE5CA0, 0xBCB12C3C, 0xBD7E5CEB, 0xBE55CF09, 0xBF37615E, 0xC022F120, 0xC11859FD, 0xC217761D, 0xC3201E28, 0xC4322950, 0xC54D6D52, 0xC671BE7F, 0xC79EEFC3, 0xC8D4D2AE, 0xCA133776, 0xCB59ED01, 0xCCA8C0EF, 0xCDFF7F9D, 0xCF5DF431, 0xD0C3E8A0, 0xD23125B9, 0xD3A57327, 0xD5209783, 0xD6A25855, 0xD82A7A21, 0xD9B8C06E, 0xDB4CEDD3, 0xDCE6C3FC, 0xDE8603B6, 0xE02A6CF8, 0xE1D3BEEF, 0xE381B803, 0xE53415E8, 0xE6EA95A2, 0xE8A4F392, 0xEA62EB82, 0xEC2438AC, 0xEDE895C8, 0xEFAFBD13, 0xF179685E, 0xF3455116, 0xF513304F, 0xF6E2BED1, 0xF8B3B51F, 0xFA85CB86, 0xFC58BA28, 0xFE2C3903, 
+  } , 
+ } , 
+
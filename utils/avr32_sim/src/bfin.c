@@ -96,6 +96,30 @@ void bfin_load_buf(void) {
 #endif
 }
 
+// stream a bfin executable from a reader.
+// no dsp here, so just fill the RAM buffer.
+u32 bfin_load_stream(bfin_read_t read, void* src, u32 size) {
+  u32 n, got;
+  u32 pos = 0;
+  if(size > BFIN_LDR_MAX_BYTES) {
+    size = BFIN_LDR_MAX_BYTES;
+  }
+  while(pos < size) {
+    n = size - pos;
+    if(n > BFIN_LDR_CHUNK_BYTES) { n = BFIN_LDR_CHUNK_BYTES; }
+    got = (*read)(bfinLdrData + pos, n, src);
+    pos += got;
+    if(got != n) { break; }
+  }
+  bfinLdrSize = pos;
+  return pos;
+}
+
+// dsp is held in reset after a failed load
+u8 bfin_halted(void) {
+  return 0;
+}
+
 //void bfin_set_param(u8 idx, f32 x ) {
 void bfin_set_param(u8 idx, fix16_t x ) {
 #if 1
@@ -21,12 +21,24 @@
 //// actually, the ldr itself can be bigger than the bfin's sram...??
 #define BFIN_LDR_MAX_BYTES 0x12000
 
+// chunk size for streamed loads
+#define BFIN_LDR_CHUNK_BYTES 0x1000
+
+// reader for streamed loads: fill dst with up to size bytes, return count
+typedef u32 (*bfin_read_t)(volatile u8* dst, u32 size, void* src);
+
 // wait for busy pin to clear
 void bfin_wait(void);
 
 // load bfin from RAM buffer
 void bfin_load_buf(void);
 
+// load bfin while streaming the executable from a reader.
+// on failure the dsp is held in reset and 0 is returned.
+u32 bfin_load_stream(bfin_read_t read, void* src, u32 size);
+// dsp is held in reset after a failed load
+u8 bfin_halted(void);
+
 // set a parameter
 void bfin_set_param(u8 idx, fix16_t val);
 
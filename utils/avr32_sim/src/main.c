@@ -50,6 +50,7 @@
 #include "init.h"
 #include "interrupts.h"
 #include "memory.h"
+#include "midi.h"
 #include "monome.h"
 #include "serial.h"
 #include "switches.h"
@@ -108,7 +109,10 @@ static u8 launch = 0;
 // flags for device connection events.
 // need to re-send after app launch.
 static u8 ftdiConnect = 0;
+// bitfield of connected monome devices,
+// with the connection event data for each
 static u8 monomeConnect = 0;
+static s32 monomeConnectData[MONOME_MAX_DEVICES];
 static u8 hidConnect = 0;
 static u8 midiConnect = 0;
 
@@ -141,28 +145,33 @@ static void handler_Switch5(s32 data) { ;; }
 static void handler_Switch6(s32 data) { ;; }
 static void handler_Switch7(s32 data) { ;; }
 static void handler_FtdiConnect(s32 data) {
-  ftdi_setup();
+  ftdi_setup((u8)data);
 }
 static void handler_FtdiDisconnect(s32 data) { 
   /// FIXME: assuming that FTDI == monome
   event_t e = { .type = kEventMonomeDisconnect };
+  monome_disconnect((u8)data);
+  monomeConnect &= ~(1 << data);
+  e.data = data;
   event_post(&e);
 }
 
 static void handler_MonomeConnect(s32 data) {
   // this just stores a flag to re-send connection event to app
   if(!launch) {
-    monomeConnect = 1;
+    u8 dev = monome_event_device(data);
+    if(dev >= MONOME_MAX_DEVICES) { return; }
+    monomeConnect |= (1 << dev);
+    monomeConnectData[dev] = data;
   }
 }
 
 static void handler_MonomeDisconnect(s32 data) { ;; }
 static void handler_MonomePoll(s32 data) {
-  monome_read_serial();
+  monome_read_serial((u8)data);
 }
 static void handler_MonomeRefresh(s32 data) {
-  (*monome_refresh)();
-  // FIXME: arc?
+  monome_refresh((u8)data);
 }
 
 static void handler_MonomeGridKey(s32 data) { ;; }
@@ -177,7 +186,7 @@ static void handler_MidiConnect(s32 data) {
 static void handler_MidiDisconnect(s32 data) { ;; }
 static void handler_MidiPacket(s32 data) { ;; }
 static void handler_MidiRefresh(s32 data) {
-  // TODO
+  midi_refresh();
 }
 static void handler_HidConnect(s32 data) { 
   if(!launch) {
@@ -315,6 +324,7 @@ static void init_ctl(void) {
 // launch application
 void check_startup(void) {
   event_t e = { .data = 0 };
+  u8 i;
 
   if(!launch) {
     //// haven't launched yet
@@ -337,9 +347,12 @@ void check_startup(void) {
 	e.type = kEventFtdiConnect;
 	event_post(&e);
       } 
-      if(monomeConnect) {
-	e.type = kEventMonomeConnect;
-	event_post(&e);
+      for(i=0; i<MONOME_MAX_DEVICES; ++i) {
+	if(monomeConnect & (1 << i)) {
+	  e.type = kEventMonomeConnect;
+	  e.data = monomeConnectData[i];
+	  event_post(&e);
+	}
       } 
       if(hidConnect) {
 	e.type = kEventHidConnect;
@@ -19,11 +19,17 @@
 
 ////// data sizes
 
-/// maximum unpacked size of led buffer,
-/// all frames/elements, 1 byte per led.
+/// maximum count of leds, all frames/elements.
 // arc4 and 256 are tied.
 #define MONOME_MAX_LED_BYTES 256
 
+// the led buffer is packed, 4-bit level per led.
+// even leds are in the high nibble, as in mext level maps.
+#define MONOME_LED_BUF_BYTES (MONOME_MAX_LED_BYTES >> 1)
+
+// brightest level
+#define MONOME_LED_MAX_LEVEL 15
+
 // how many leds on each side of a quad
 #define MONOME_QUAD_LEDS 8
 
@@ -31,6 +37,8 @@
 #define MONOME_LED_ROW_BYTES 16
 // define mul as lshift
 #define MONOME_LED_ROW_LS 4
+// packed bytes in 1 row of the buffer
+#define MONOME_LED_ROW_PACKED_BYTES 8
 
 //-- sizes for the actual data to be send over usb
 // one frame is an 8x8 quadrant; 256 has 4.
@@ -38,15 +46,21 @@
 
 // map stores binary data for each led in 8x8
 #define MONOME_GRID_MAP_BYTES 8
-// level map stores 8b level data for each led in 8x8
-/// TODO:
-//#define MONOME_GRID_LEVEL_MAP_SIZE 64
+// level map stores 4b level data for each led in 8x8
+#define MONOME_GRID_LEVEL_MAP_BYTES 32
 
 // a frame is one knob, max is arc4
 #define MONOME_RING_MAX_FRAMES 4
 
-// map is varibright, 4 bytes per led, 64 leds
+// map is varibright, 4 bits per led, 64 leds
 #define MONOME_RING_MAP_SIZE  32
+// leds in a ring
+#define MONOME_RING_LEDS 64
+
+// max simultaneous devices; index matches the FTDI device index
+#define MONOME_MAX_DEVICES 2
+// device index for ops not bound to any device
+#define MONOME_NO_DEVICE 0xff
 
 // device enumeration
 typedef enum {
@@ -58,78 +72,86 @@ typedef enum {
 //--------------------------------
 //------- variables
 
-// connected flag ( TODO: device id? )
-//== use events instead
-// extern u8 monomeConnect;
-
-// dirt flags for each frame, as bitfield
-extern u8 monomeFrameDirty;
+// dirt flags for each frame, as bitfield, per device
+extern u8 monomeFrameDirty[MONOME_MAX_DEVICES];
+// dirt flags for each grid row, as bitfield, per device
+extern u16 monomeRowDirty[MONOME_MAX_DEVICES];
 
-// a buffer big enough to hold all led data for 256 or arc4
-// each led gets a full byte
-extern u8 monomeLedBuffer[MONOME_MAX_LED_BYTES];
+// per-device buffers big enough to hold all led data for 256 or arc4.
+// packed, 4 bits per led; use the led functions below to access them.
+extern u8 monomeLedBuffer[MONOME_MAX_DEVICES][MONOME_LED_BUF_BYTES];
 
 //---- function types
 /*
   define protocol-agnostic function types
-  function pointers of the appropriate types will be maintained
-  and assigned according to protocol selection.
+  each device keeps function pointers of the appropriate types,
+  assigned according to its protocol.
+  each takes the device it acts on, since rx parsing (usb interrupt)
+  and refresh (main loop) can be servicing different devices at once.
  */
 
+// per-device state, private to the driver
+typedef struct e_monomeDev monomeDev;
+
 ////// read raw serial data (all devices)
-typedef void(*read_serial_t)(void);
+typedef void(*read_serial_t)(monomeDev* md);
 //// set intensity
 // set led intensity of connected device
-typedef void(*set_intense_t)(u8 level);
+typedef void(*set_intense_t)(monomeDev* md, u8 level);
 
 ///// write (grid)extern 
 // single led
-typedef void(*grid_led_t)(u8 x, u8 y, u8 val);
-// binary 8x8 frame
-typedef void(*grid_map_t)(u8 x, u8 y, const u8* data);
-// 8x8x8b varibright frame
-typedef void(*grid_level_map_t)(u8 x, u8 y, const u8* data);
+typedef void(*grid_led_t)(monomeDev* md, u8 x, u8 y, u8 val);
+// binary 8x8 frame, from packed level data
+typedef void(*grid_map_t)(monomeDev* md, u8 x, u8 y, const u8* data);
+// 8x8x4b varibright frame, from packed level data
+typedef void(*grid_level_map_t)(monomeDev* md, u8 x, u8 y, const u8* data);
 
 ///// write (ring)
 // set single led in ring with 4b value
-typedef void(*ring_set_t)(u8 n, u8 rho, u8 val);
+typedef void(*ring_set_t)(monomeDev* md, u8 n, u8 rho, u8 val);
 // set all leds in ring 
-typedef void(*ring_map_t)(u8 n, u8* data);
+typedef void(*ring_map_t)(monomeDev* md, u8 n, u8* data);
 
 //// refresh (grid vs arc)
-typedef void(*refresh_t)(void);
-
-// global pointers to function types defined above.
-// assigned according to detected device protocol.
-/// FIXME: will need multiple device support eventually.
-extern read_serial_t monome_read_serial;
-extern set_intense_t monome_set_intense;
-extern grid_led_t monome_grid_led;
-extern grid_map_t monome_grid_map;
-extern grid_level_map_t monome_grid_level_map;
-extern ring_map_t monome_ring_map;
-extern refresh_t monome_refresh;
+typedef void(*refresh_t)(u8 dev);
 
 //-------------------------------------
 //------ functions
 
 // initialize
 extern void init_monome(void);
-// check monome device  from FTDI string descriptors
-extern u8 check_monome_device_desc(char* mstr, char* pstr, char* sstr);
+// check monome device from FTDI string descriptors, for a given device index
+extern u8 check_monome_device_desc(u8 dev, char* mstr, char* pstr, char* sstr);
+// forget a device after it is unplugged
+extern void monome_disconnect(u8 dev);
+// device type, or eDeviceNumDevices if nothing is connected at this index
+extern eMonomeDevice monome_device_type(u8 dev);
+
+// parse serial input from a device, after a read completes
+extern void monome_read_serial(u8 dev);
+// set led intensity of a device
+extern void monome_set_intense(u8 dev, u8 level);
+
+// check dirty flags and refresh leds (grid or arc)
+extern void monome_refresh(u8 dev);
 
 // check dirty flags and refresh leds
-extern void monome_grid_refresh(void);
+extern void monome_grid_refresh(u8 dev);
 
 // check dirty flags and refresh leds
-extern void monome_arc_refresh(void);
+extern void monome_arc_refresh(u8 dev);
 
 /*
   monome_*_parse_event_data :
   convert event data as handled by the event queue,
   into useful parameters, depending on the type of event.
+  the source device index is in the top byte of all monome events.
  */
 
+// source device of any monome event
+extern u8 monome_event_device(u32 data);
+
 // connection event
 // parameters: device id, size a. size b
 // (a, b) = (width, height) for grids
@@ -157,17 +179,24 @@ extern void monome_ring_enc_parse_event_data(u32 data, u8* n, s8* delta);
 extern void monome_ring_key_parse_event_data(u32 data, u8* n, u8* val);
 
 /*
-  led_set, led_toggle
+  led_set, led_toggle, led_level_set
   these are top-level functions to set or toggle a single led.
-  apps can use these, or directly manipulate led/dirty buffers.
-  there's no great speed difference so use whichever suits the situation.
-  TODO: make cleaner interfaces for direct manipulation. 
-  apps shouldn't have to e.g. manage frame-dirty flags 
+  they set the row and frame dirty flags.
+  on/off functions use full brightness for on.
+  calls with an out-of-range device index (e.g. MONOME_NO_DEVICE) do nothing.
  */
-// top-level led/set function
-extern void monome_led_set(u8 x, u8 y, u8 val);
-// top-level led/toggle function
-extern void monome_led_toggle(u8 x, u8 y);
+// top-level led/set function (on/off)
+extern void monome_led_set(u8 dev, u8 x, u8 y, u8 val);
+// top-level led/toggle function (off / full)
+extern void monome_led_toggle(u8 dev, u8 x, u8 y);
+// top-level led/level/set function, 0-15
+extern void monome_led_level_set(u8 dev, u8 x, u8 y, u8 level);
+// get led level, 0-15
+extern u8 monome_led_get(u8 dev, u8 x, u8 y);
+// set led level in an arc ring, 0-15
+extern void monome_ring_set(u8 dev, u8 n, u8 rho, u8 level);
+// get led level in an arc ring
+extern u8 monome_ring_get(u8 dev, u8 n, u8 rho);
 
 /// TODO: add these row functions,
 /// and abstract some of the stuff in e.g. dsyn/grid.c
@@ -188,9 +217,11 @@ extern void monome_led_toggle(u8 x, u8 y);
  */
 
 // set quadrant dirty flag from (x,y)
-extern void monome_calc_quadrant_flag(u8 x, u8 y);
-// set given quadrant dirty flag
-extern void monome_set_quadrant_flag(u8 q);
+extern void monome_calc_quadrant_flag(u8 dev, u8 x, u8 y);
+// set given quadrant dirty flag (and its rows)
+extern void monome_set_quadrant_flag(u8 dev, u8 q);
+// set dirty flags for a whole grid row
+extern void monome_set_row_flag(u8 dev, u8 y);
 
 // convert flat framebuffer idx to x,y
 extern void monome_idx_xy(u32 idx, u8* x, u8* y);
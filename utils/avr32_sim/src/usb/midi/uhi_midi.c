@@ -188,7 +188,7 @@ void uhi_midi_enable(uhc_device_t* dev) {
   /* 		   NULL); */
   
   //  UHI_MIDI_CHANGE(dev, true);
-  midi_change(dev, true);  
+  midi_change(true);  
   print_dbg("\r\n finished uhi_midi_enable");
 }
 
@@ -198,7 +198,7 @@ void uhi_midi_uninstall(uhc_device_t* dev) {
   }
   uhi_midi_dev.dev = NULL;
   Assert(uhi_midi_dev.report!=NULL);
-  midi_change(dev, false);  
+  midi_change(false);  
 }
 
 bool uhi_midi_in_run(uint8_t * buf, iram_size_t buf_size,
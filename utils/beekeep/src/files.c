@@ -116,12 +116,12 @@ void files_init(void) {
 //// modules
 
 // return filename for DSP given index in list
-const volatile char* files_get_dsp_name(u8 idx) {
+const volatile char* files_get_dsp_name(u16 idx) {
   return list_get_name(&dspList, idx);
 }
 
 // load a blacfkin executable by index */
-u8 files_load_dsp(u8 idx) {  
+u8 files_load_dsp(u16 idx) {  
   //  app_notify("loading dsp...");
   return files_load_dsp_name((const char*)files_get_dsp_name(idx));
 }
@@ -173,7 +173,7 @@ u8 files_load_dsp_name(const char* name) {
 
 // store .ldr as default in internal flash, given index
 #if 0
-void files_store_default_dsp(u8 idx) {
+void files_store_default_dsp(u16 idx) {
   files_store_default_dsp_name((const char*)files_get_dsp_name(idx));
   /* const char* name; */
   /* void* fp;	   */
@@ -245,7 +245,7 @@ void files_store_default_dsp_name(const char* name) {
 
 
 // return count of dsp files
-u8 files_get_dsp_count(void) {
+u16 files_get_dsp_count(void) {
   return dspList.num;
 }
 
@@ -253,12 +253,12 @@ u8 files_get_dsp_count(void) {
 //// scenes
 
 // return filename for scene given index in list
-const volatile char* files_get_scene_name(u8 idx) {
+const volatile char* files_get_scene_name(u16 idx) {
   return list_get_name(&sceneList, idx);
 }
 
 // load scene by index */
-u8 files_load_scene(u8 idx) {  
+u8 files_load_scene(u16 idx) {  
   return files_load_scene_name((const char*)files_get_scene_name(idx));
 }
 
@@ -298,7 +298,7 @@ u8 files_load_scene_name(const char* name) {
 
 
 // store scene to sdcard at idx
-void files_store_scene(u8 idx) {
+void files_store_scene(u16 idx) {
   files_store_scene_name((const char*)files_get_scene_name(idx), 0);
 }
 
@@ -335,7 +335,7 @@ void files_store_scene_name(const char* name, u8 ext) {
 
 
 // return count of scene files
-u8 files_get_scene_count(void) {
+u16 files_get_scene_count(void) {
   return sceneList.num;
 }
 
@@ -344,7 +344,7 @@ u8 files_get_scene_count(void) {
 
 
 // return filename for scaler given index in list
-const volatile char* files_get_scaler_name(u8 idx) {
+const volatile char* files_get_scaler_name(u16 idx) {
   return list_get_name(&scalerList, idx);
 }
 